@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstring>
 #include "opentelemetry/context/context_value.h"
 #include "opentelemetry/nostd/shared_ptr.h"
@@ -17,6 +18,14 @@ namespace context
 // of DataList nodes and each context holds a shared_ptr to a place within
 // the list that determines which keys and values it has access to. All that
 // come before and none that come after.
+//
+// With ABI version 2, the values of the well-known keys (the active span, the
+// root span flag and the baggage) are kept in fixed slots of the context
+// instead, so setting the active span copies the context without allocating,
+// and looking it up does not walk the list. Only the other keys are kept in
+// the list, which is still shared between the contexts. Two contexts then
+// compare equal if they share the same list and their slots hold equal
+// values, while with ABI version 1 they must share the same list node.
 class Context
 {
 
@@ -27,13 +36,25 @@ class Context
   template <class T>
   Context(const T &keys_and_values) noexcept
   {
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    InsertValues(keys_and_values, nostd::shared_ptr<DataList>{nullptr});
+#else
     head_ = nostd::shared_ptr<DataList>{new DataList(keys_and_values)};
+#endif
   }
 
   // Creates a context object from a key and value, this will
   // hold a shared_ptr to the head of the DataList linked list
   Context(nostd::string_view key, ContextValue value) noexcept
   {
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    std::size_t slot = GetWellKnownSlot(key);
+    if (slot < kWellKnownKeys)
+    {
+      slots_[slot] = std::move(value);
+      return;
+    }
+#endif
     head_ = nostd::shared_ptr<DataList>{new DataList(key, value)};
   }
 
@@ -43,6 +64,11 @@ class Context
   template <class T>
   Context SetValues(T &values) noexcept
   {
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    Context context = *this;
+    context.InsertValues(values, head_);
+    return context;
+#else
     Context context                  = Context(values);
     nostd::shared_ptr<DataList> last = context.head_;
     while (last->next_ != nullptr)
@@ -51,6 +77,7 @@ class Context
     }
     last->next_ = head_;
     return context;
+#endif
   }
 
   // Accepts a new iterable and then returns a new context that
@@ -58,7 +85,19 @@ class Context
   // exisiting list to the end of the new list.
   Context SetValue(nostd::string_view key, ContextValue value) noexcept
   {
-    Context context      = Context(key, value);
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    std::size_t slot = GetWellKnownSlot(key);
+    if (slot < kWellKnownKeys)
+    {
+      Context context      = *this;
+      context.slots_[slot] = std::move(value);
+      return context;
+    }
+    Context context = *this;
+    context.head_   = nostd::shared_ptr<DataList>{new DataList(key, value)};
+#else
+    Context context = Context(key, value);
+#endif
     context.head_->next_ = head_;
     return context;
   }
@@ -66,6 +105,13 @@ class Context
   // Returns the value associated with the passed in key.
   context::ContextValue GetValue(const nostd::string_view key) const noexcept
   {
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    std::size_t slot = GetWellKnownSlot(key);
+    if (slot < kWellKnownKeys)
+    {
+      return slots_[slot];
+    }
+#endif
     for (DataList *data = head_.get(); data != nullptr; data = data->next_.get())
     {
       if (key.size() == data->key_length_)
@@ -85,7 +131,17 @@ class Context
     return !nostd::holds_alternative<nostd::monostate>(GetValue(key));
   }
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  // The contexts are equal if they hold the same values of the well-known keys,
+  // and share the same list of the other keys.
+  bool operator==(const Context &other) const noexcept
+  {
+    return head_ == other.head_ && slots_[0] == other.slots_[0] && slots_[1] == other.slots_[1] &&
+           slots_[2] == other.slots_[2];
+  }
+#else
   bool operator==(const Context &other) const noexcept { return (head_ == other.head_); }
+#endif
 
 private:
   // A linked list to contain the keys and values of this context node
@@ -157,6 +213,59 @@ class Context
 
   // Head of the list which holds the keys and values of this context
   nostd::shared_ptr<DataList> head_;
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  // The well-known keys, they must match trace::kSpanKey, trace::kIsRootSpanKey and
+  // baggage::kBaggageHeader, which is checked by ContextTest.ContextWellKnownKeysMatchApiKeys.
+  static constexpr std::size_t kWellKnownKeys = 3;
+
+  // Returns the slot of a well-known key, or kWellKnownKeys for the other keys
+  static std::size_t GetWellKnownSlot(nostd::string_view key) noexcept
+  {
+    switch (key.size())
+    {
+      case sizeof("active_span") - 1:
+        return std::memcmp(key.data(), "active_span", key.size()) == 0 ? 0 : kWellKnownKeys;
+      case sizeof("is_root_span") - 1:
+        return std::memcmp(key.data(), "is_root_span", key.size()) == 0 ? 1 : kWellKnownKeys;
+      case sizeof("baggage") - 1:
+        return std::memcmp(key.data(), "baggage", key.size()) == 0 ? 2 : kWellKnownKeys;
+      default:
+        return kWellKnownKeys;
+    }
+  }
+
+  // Sets the values of the well-known keys in their slots, and puts the other
+  // values in a new list in front of next. The first value of a key is kept if
+  // it is repeated.
+  template <class T>
+  void InsertValues(const T &keys_and_values, nostd::shared_ptr<DataList> next) noexcept
+  {
+    bool is_set[kWellKnownKeys]       = {false, false, false};
+    nostd::shared_ptr<DataList> *last = &head_;
+    for (auto &iter : keys_and_values)
+    {
+      std::size_t slot = GetWellKnownSlot(iter.first);
+      if (slot < kWellKnownKeys)
+      {
+        if (!is_set[slot])
+        {
+          slots_[slot] = iter.second;
+          is_set[slot] = true;
+        }
+      }
+      else
+      {
+        *last = nostd::shared_ptr<DataList>{new DataList(iter.first, iter.second)};
+        last  = &(*last)->next_;
+      }
+    }
+    *last = std::move(next);
+  }
+
+  // Values of the well-known keys, monostate if not set
+  ContextValue slots_[kWellKnownKeys];
+#endif
 };
 }  // namespace context
 OPENTELEMETRY_END_NAMESPACE
@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
 #include "opentelemetry/common/macros.h"
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/nostd/shared_ptr.h"
@@ -24,6 +29,13 @@ class Token
 
   ~Token() noexcept;
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  // A token is created for every scope, its memory is recycled through a
+  // per-thread free list instead of going back to the heap.
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr, std::size_t size) noexcept;
+#endif
+
 private:
   friend class RuntimeContextStorage;
 
@@ -31,9 +43,107 @@ class Token
   // one that was passed in.
   Token(const Context &context) : context_(context) {}
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  friend class ThreadLocalContextStorage;
+
+  class FreeList;
+
+  OPENTELEMETRY_API_SINGLETON static FreeList &GetFreeList() noexcept;
+
+  // A constructor for the tokens of a ThreadLocalContextStorage, which
+  // identify their stack frame by its depth and serial number instead of
+  // holding a copy of the Context object.
+  Token(const void *stack, std::size_t depth, uint64_t serial) noexcept
+      : stack_(stack), depth_(depth), serial_(serial)
+  {}
+#endif
+
   const Context context_;
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  const void *stack_ = nullptr;
+  std::size_t depth_ = 0;
+  uint64_t serial_   = 0;
+#endif
+};
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+// The memory of the tokens released by a thread, kept for the next tokens
+// created by the same thread.
+class Token::FreeList
+{
+public:
+  FreeList() noexcept = default;
+
+  ~FreeList() noexcept
+  {
+    while (head_ != nullptr)
+    {
+      Node *node = head_;
+      head_      = node->next;
+      ::operator delete(node);
+    }
+    // Tokens released after the thread local objects are destroyed go back
+    // to the heap.
+    size_ = kMaxSize;
+  }
+
+  void *Pop() noexcept
+  {
+    if (head_ == nullptr)
+    {
+      return nullptr;
+    }
+    Node *node = head_;
+    head_      = node->next;
+    --size_;
+    return node;
+  }
+
+  bool Push(void *ptr) noexcept
+  {
+    if (size_ >= kMaxSize)
+    {
+      return false;
+    }
+    head_ = new (ptr) Node{head_};
+    ++size_;
+    return true;
+  }
+
+private:
+  struct Node
+  {
+    Node *next;
+  };
+
+  static constexpr std::size_t kMaxSize = 64;
+
+  Node *head_       = nullptr;
+  std::size_t size_ = 0;
 };
 
+inline Token::FreeList &Token::GetFreeList() noexcept
+{
+  static thread_local FreeList free_list;
+  return free_list;
+}
+
+inline void *Token::operator new(std::size_t size)
+{
+  void *ptr = size == sizeof(Token) ? GetFreeList().Pop() : nullptr;
+  return ptr != nullptr ? ptr : ::operator new(size);
+}
+
+inline void Token::operator delete(void *ptr, std::size_t size) noexcept
+{
+  if (ptr != nullptr && (size != sizeof(Token) || !GetFreeList().Push(ptr)))
+  {
+    ::operator delete(ptr);
+  }
+}
+#endif
+
 /**
  * RuntimeContextStorage is used by RuntimeContext to store Context frames.
  *
@@ -57,6 +167,20 @@ class OPENTELEMETRY_EXPORT RuntimeContextStorage
    */
   virtual nostd::unique_ptr<Token> Attach(const Context &context) noexcept = 0;
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  /**
+   * Set the current context, which the caller does not use anymore.
+   *
+   * Storages can override this to keep the context without copying it.
+   * @param the new current context
+   * @return a token for the new current context. This never returns a nullptr.
+   */
+  virtual nostd::unique_ptr<Token> AttachOwned(Context &&context) noexcept
+  {
+    return Attach(context);
+  }
+#endif
+
   /**
    * Detach the context related to the given token.
    * @param token a token related to a context
@@ -86,18 +210,27 @@ class OPENTELEMETRY_EXPORT RuntimeContext
 {
 public:
   // Return the current context.
-  static Context GetCurrent() noexcept { return GetRuntimeContextStorage()->GetCurrent(); }
+  static Context GetCurrent() noexcept { return GetStorage()->GetCurrent(); }
 
   // Sets the current 'Context' object. Returns a token
   // that can be used to reset to the previous Context.
   static nostd::unique_ptr<Token> Attach(const Context &context) noexcept
   {
-    return GetRuntimeContextStorage()->Attach(context);
+    return GetStorage()->Attach(context);
+  }
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  // Sets the current 'Context' object, which is not used anymore by the
+  // caller. Returns a token that can be used to reset to the previous Context.
+  static nostd::unique_ptr<Token> Attach(Context &&context) noexcept
+  {
+    return GetStorage()->AttachOwned(std::move(context));
   }
+#endif
 
   // Resets the context to a previous value stored in the
   // passed in token. Returns true if successful, false otherwise
-  static bool Detach(Token &token) noexcept { return GetRuntimeContextStorage()->Detach(token); }
+  static bool Detach(Token &token) noexcept { return GetStorage()->Detach(token); }
 
   // Sets the Key and Value into the passed in context or if a context is not
   // passed in, the RuntimeContext.
@@ -200,35 +333,69 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
   // Returns true if successful, false otherwise.
   bool Detach(Token &token) noexcept override
   {
+    Stack &stack = GetStack();
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    // The frame of the token is found by its depth, the serial number tells
+    // whether it was already detached and its depth reused.
+    if (token.stack_ != &stack || token.depth_ == 0 || token.depth_ > stack.size_ ||
+        stack.base_[token.depth_ - 1].serial != token.serial_)
+    {
+      return false;
+    }
+
+    while (stack.size_ >= token.depth_)
+    {
+      stack.Pop();
+    }
+
+    return true;
+#else
     // In most cases, the context to be detached is on the top of the stack.
-    if (token == GetStack().Top())
+    if (stack.IsTop(token))
     {
-      GetStack().Pop();
+      stack.Pop();
       return true;
     }
 
-    if (!GetStack().Contains(token))
+    if (!stack.Contains(token))
     {
       return false;
     }
 
-    while (!(token == GetStack().Top()))
+    while (!stack.IsTop(token))
     {
-      GetStack().Pop();
+      stack.Pop();
     }
 
-    GetStack().Pop();
+    stack.Pop();
 
     return true;
+#endif
   }
 
   // Sets the current 'Context' object. Returns a token
   // that can be used to reset to the previous Context.
   nostd::unique_ptr<Token> Attach(const Context &context) noexcept override
   {
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    return AttachOwned(Context(context));
+#else
     GetStack().Push(context);
     return CreateToken(context);
+#endif
+  }
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  // Sets the current 'Context' object without copying it. Returns a token
+  // that can be used to reset to the previous Context.
+  nostd::unique_ptr<Token> AttachOwned(Context &&context) noexcept override
+  {
+    Stack &stack = GetStack();
+    stack.Push(std::move(context));
+    return nostd::unique_ptr<Token>(
+        new Token(&stack, stack.size_, stack.base_[stack.size_ - 1].serial));
   }
+#endif
 
 private:
   // A nested class to store the attached contexts in a stack.
@@ -236,7 +403,18 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
   {
     friend class ThreadLocalContextStorage;
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    // An attached context, and the serial number of its token.
+    struct Frame
+    {
+      Context context;
+      uint64_t serial = 0;
+    };
+
+    Stack() noexcept : size_(0), capacity_(0), serial_(0), base_(nullptr) {}
+#else
     Stack() noexcept : size_(0), capacity_(0), base_(nullptr) {}
+#endif
 
     // Pops the top Context off the stack.
     void Pop() noexcept
@@ -249,10 +427,20 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
       // the shared_ptr object (if stored in prev context object ) are released.
       // The stack is not resized, and the unused memory would be reutilised
       // for subsequent context storage.
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+      base_[size_ - 1].context = Context();
+#else
       base_[size_ - 1] = Context();
+#endif
       size_ -= 1;
     }
 
+#if OPENTELEMETRY_ABI_VERSION_NO < 2
+    bool IsTop(const Token &token) const noexcept
+    {
+      return size_ == 0 ? token == Context() : token == base_[size_ - 1];
+    }
+
     bool Contains(const Token &token) const noexcept
     {
       for (size_t pos = size_; pos > 0; --pos)
@@ -265,6 +453,7 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
 
       return false;
     }
+#endif
 
     // Returns the Context at the top of the stack.
     Context Top() const noexcept
@@ -273,9 +462,27 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
       {
         return Context();
       }
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+      return base_[size_ - 1].context;
+#else
       return base_[size_ - 1];
+#endif
     }
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    // Moves the passed in context to the top of the stack, with a new
+    // serial number, and resizes if necessary.
+    void Push(Context &&context) noexcept
+    {
+      size_++;
+      if (size_ > capacity_)
+      {
+        Resize(size_ * 2);
+      }
+      base_[size_ - 1].context = std::move(context);
+      base_[size_ - 1].serial  = ++serial_;
+    }
+#else
     // Pushes the passed in context pointer to the top of the stack
     // and resizes if necessary.
     void Push(const Context &context) noexcept
@@ -287,6 +494,7 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
       }
       base_[size_ - 1] = context;
     }
+#endif
 
     // Reallocates the storage array to the pass in new capacity size.
     void Resize(size_t new_capacity) noexcept
@@ -296,7 +504,11 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
       {
         new_capacity = 2;
       }
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+      Frame *temp = new Frame[new_capacity];
+#else
       Context *temp = new Context[new_capacity];
+#endif
       if (base_ != nullptr)
       {
         // vs2015 does not like this construct considering it unsafe:
@@ -305,7 +517,7 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
         // https://stackoverflow.com/questions/12270224/xutility2227-warning-c4996-std-copy-impl
         for (size_t i = 0; i < (std::min)(old_size, new_capacity); i++)
         {
-          temp[i] = base_[i];
+          temp[i] = std::move(base_[i]);
         }
         delete[] base_;
       }
@@ -317,7 +529,12 @@ class ThreadLocalContextStorage : public RuntimeContextStorage
 
     size_t size_;
     size_t capacity_;
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+    uint64_t serial_;
+    Frame *base_;
+#else
     Context *base_;
+#endif
   };
 
   OPENTELEMETRY_API_SINGLETON Stack &GetStack()
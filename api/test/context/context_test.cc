@@ -1,9 +1,12 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include "opentelemetry/baggage/baggage_context.h"
 #include "opentelemetry/context/context.h"
+#include "opentelemetry/trace/span_metadata.h"
 
 #include <map>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -145,3 +148,47 @@ TEST(ContextTest, ContextDiffCompare)
   context::Context foo_test                             = context::Context(map_foo);
   EXPECT_FALSE(context_test == foo_test);
 }
+
+// Tests that the values of the well-known keys are set and inherited like the other keys.
+TEST(ContextTest, ContextWellKnownKeys)
+{
+  std::map<std::string, context::ContextValue> map_test = {
+      {"test_key", (int64_t)123}, {"active_span", (int64_t)456}, {"baggage", (int64_t)789}};
+  context::Context context_test = context::Context(map_test);
+  context::Context context_foo  = context_test.SetValue("is_root_span", true);
+  context::Context context_bar  = context_foo.SetValue("active_span", (int64_t)321);
+
+  EXPECT_EQ(nostd::get<int64_t>(context_test.GetValue("active_span")), 456);
+  EXPECT_FALSE(context_test.HasKey("is_root_span"));
+  EXPECT_TRUE(nostd::get<bool>(context_foo.GetValue("is_root_span")));
+  EXPECT_EQ(nostd::get<int64_t>(context_foo.GetValue("active_span")), 456);
+  EXPECT_EQ(nostd::get<int64_t>(context_bar.GetValue("active_span")), 321);
+  EXPECT_EQ(nostd::get<int64_t>(context_bar.GetValue("test_key")), 123);
+  EXPECT_EQ(nostd::get<int64_t>(context_bar.GetValue("baggage")), 789);
+  EXPECT_FALSE(context_bar.HasKey("active_spa"));
+
+  std::map<std::string, context::ContextValue> map_write = {{"active_span", (int64_t)654},
+                                                            {"foo_key", (int64_t)987}};
+  context::Context context_baz = context_bar.SetValues(map_write);
+  EXPECT_EQ(nostd::get<int64_t>(context_baz.GetValue("active_span")), 654);
+  EXPECT_EQ(nostd::get<int64_t>(context_baz.GetValue("foo_key")), 987);
+  EXPECT_TRUE(nostd::get<bool>(context_baz.GetValue("is_root_span")));
+  EXPECT_FALSE(context_bar == context_baz);
+}
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+// Tests that the keys of the active span, the root span flag and the baggage are kept in the slots
+// of the well-known keys: setting the same value twice gives equal contexts, which is not the case
+// for the keys kept in the list.
+TEST(ContextTest, ContextWellKnownKeysMatchApiKeys)
+{
+  context::Context context;
+  for (const std::string &key : {std::string(trace::kSpanKey), std::string(trace::kIsRootSpanKey),
+                                 baggage::kBaggageHeader})
+  {
+    EXPECT_TRUE(context.SetValue(key, (int64_t)1) == context.SetValue(key, (int64_t)1)) << key;
+  }
+  EXPECT_FALSE(context.SetValue("test_key", (int64_t)1) ==
+               context.SetValue("test_key", (int64_t)1));
+}
+#endif
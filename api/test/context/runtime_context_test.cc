@@ -136,3 +136,20 @@ TEST(RuntimeContextTest, DetachOutOfOrder)
 
   } while (std::next_permutation(indices.begin(), indices.end()));
 }
+
+// Test that a token detached with its parent doesn't detach the contexts attached afterwards.
+TEST(RuntimeContextTest, DetachDetachedToken)
+{
+  context::Context outer_context = context::Context("index", (int64_t)0);
+  context::Context inner_context = context::Context("index", (int64_t)1);
+  context::Context other_context = context::Context("index", (int64_t)2);
+
+  auto outer_token = context::RuntimeContext::Attach(outer_context);
+  auto inner_token = context::RuntimeContext::Attach(inner_context);
+  EXPECT_TRUE(context::RuntimeContext::Detach(*outer_token));
+
+  auto first_token  = context::RuntimeContext::Attach(outer_context);
+  auto second_token = context::RuntimeContext::Attach(other_context);
+  EXPECT_FALSE(context::RuntimeContext::Detach(*inner_token));
+  EXPECT_EQ(context::RuntimeContext::GetCurrent(), other_context);
+}
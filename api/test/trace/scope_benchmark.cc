@@ -0,0 +1,59 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/context/runtime_context.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/trace/noop.h"
+#include "opentelemetry/trace/scope.h"
+#include "opentelemetry/trace/tracer.h"
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+namespace trace_api = opentelemetry::trace;
+namespace nostd     = opentelemetry::nostd;
+namespace context   = opentelemetry::context;
+
+namespace
+{
+
+void NestScopes(nostd::shared_ptr<trace_api::Span> &span, int depth)
+{
+  if (depth == 0)
+  {
+    return;
+  }
+  auto scope = trace_api::Tracer::WithActiveSpan(span);
+  NestScopes(span, depth - 1);
+}
+
+// Test to measure performance for nested scopes of an already started span
+void BM_NestedWithActiveSpan(benchmark::State &state)
+{
+  std::shared_ptr<trace_api::Tracer> tracer(new trace_api::NoopTracer());
+  auto span = tracer->StartSpan("span");
+  int depth = static_cast<int>(state.range(0));
+  for (auto _ : state)
+  {
+    NestScopes(span, depth);
+  }
+  span->End();
+}
+BENCHMARK(BM_NestedWithActiveSpan)->Arg(1)->Arg(4)->Arg(16);
+
+// Test to measure performance for attaching and detaching the same context
+void BM_AttachDetach(benchmark::State &state)
+{
+  context::Context current = context::RuntimeContext::GetCurrent().SetValue("key", int64_t{1});
+  for (auto _ : state)
+  {
+    auto token = context::RuntimeContext::Attach(current);
+    benchmark::DoNotOptimize(token);
+  }
+}
+BENCHMARK(BM_AttachDetach);
+
+}  // namespace
+
+BENCHMARK_MAIN();
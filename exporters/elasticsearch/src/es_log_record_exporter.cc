@@ -334,20 +334,21 @@ sdk::common::ExportResult ElasticsearchLogRecordExporter::Export(
   request->SetTimeoutMs(std::chrono::milliseconds(1000 * options_.response_timeout_));
 
   // Create the request body
-  std::string body = "";
+  auto body = std::make_shared<std::string>();
   for (auto &record : records)
   {
     // Append {"index":{}} before JSON body, which tells Elasticsearch to write to index specified
     // in URI
-    body += "{\"index\" : {}}\n";
+    *body += "{\"index\" : {}}\n";
 
     // Add the context of the Recordable
     auto json_record = std::unique_ptr<ElasticSearchRecordable>(
         static_cast<ElasticSearchRecordable *>(record.release()));
-    body += json_record->GetJSON().dump() + "\n";
+    *body += json_record->GetJSON().dump() + "\n";
   }
-  std::vector<uint8_t> body_vec(body.begin(), body.end());
-  request->SetBody(body_vec);
+  // The request sends the string directly, without copying it into a Body
+  request->SetBodySlices({http_client::BodySlice(
+      body, reinterpret_cast<const uint8_t *>(body->data()), body->size())});
 
 #ifdef ENABLE_ASYNC_EXPORT
   // Send the request
@@ -7,6 +7,7 @@
 #include "opentelemetry/nostd/type_traits.h"
 #include "opentelemetry/sdk/trace/exporter.h"
 #include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/span_data_pool.h"
 #include "opentelemetry/version.h"
 
 #include <iostream>
@@ -53,6 +54,8 @@ class OStreamSpanExporter final : public opentelemetry::sdk::trace::SpanExporter
   std::ostream &sout_;
   bool is_shutdown_ = false;
   mutable opentelemetry::common::SpinLockMutex lock_;
+  // Recordables are recycled once printed.
+  opentelemetry::sdk::trace::SpanDataPool span_data_pool_;
   bool isShutdown() const noexcept;
 
   // Mapping status number to the string from api/include/opentelemetry/trace/span_metadata.h
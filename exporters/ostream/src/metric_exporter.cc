@@ -214,6 +214,27 @@ void OStreamMetricExporter::printPointData(const opentelemetry::sdk::metrics::Po
     sout_ << "\n  counts     : ";
     printVec(sout_, histogram_point_data.counts_);
   }
+  else if (nostd::holds_alternative<sdk::metrics::ExponentialHistogramPointData>(point_data))
+  {
+    auto histogram_point_data =
+        nostd::get<sdk::metrics::ExponentialHistogramPointData>(point_data);
+    sout_ << "\n  type     : ExponentialHistogramPointData";
+    sout_ << "\n  count     : " << histogram_point_data.count_;
+    sout_ << "\n  sum     : " << histogram_point_data.sum_;
+    if (histogram_point_data.record_min_max_)
+    {
+      sout_ << "\n  min     : " << histogram_point_data.min_;
+      sout_ << "\n  max     : " << histogram_point_data.max_;
+    }
+    sout_ << "\n  scale     : " << histogram_point_data.scale_;
+    sout_ << "\n  zero count     : " << histogram_point_data.zero_count_;
+    sout_ << "\n  positive offset     : " << histogram_point_data.positive_buckets_.offset_;
+    sout_ << "\n  positive counts     : ";
+    printVec(sout_, histogram_point_data.positive_buckets_.counts_);
+    sout_ << "\n  negative offset     : " << histogram_point_data.negative_buckets_.offset_;
+    sout_ << "\n  negative counts     : ";
+    printVec(sout_, histogram_point_data.negative_buckets_.counts_);
+  }
   else if (nostd::holds_alternative<sdk::metrics::LastValuePointData>(point_data))
   {
     auto last_point_data = nostd::get<sdk::metrics::LastValuePointData>(point_data);
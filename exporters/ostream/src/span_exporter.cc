@@ -41,7 +41,7 @@ OStreamSpanExporter::OStreamSpanExporter(std::ostream &sout) noexcept : sout_(so
 
 std::unique_ptr<trace_sdk::Recordable> OStreamSpanExporter::MakeRecordable() noexcept
 {
-  return std::unique_ptr<trace_sdk::Recordable>(new trace_sdk::SpanData);
+  return span_data_pool_.MakeRecordable();
 }
 
 sdk::common::ExportResult OStreamSpanExporter::Export(
@@ -56,8 +56,7 @@ sdk::common::ExportResult OStreamSpanExporter::Export(
 
   for (auto &recordable : spans)
   {
-    auto span = std::unique_ptr<trace_sdk::SpanData>(
-        static_cast<trace_sdk::SpanData *>(recordable.release()));
+    auto span = static_cast<const trace_sdk::SpanData *>(recordable.get());
 
     if (span != nullptr)
     {
@@ -95,6 +94,7 @@ sdk::common::ExportResult OStreamSpanExporter::Export(
     }
   }
 
+  span_data_pool_.Recycle(spans);
   return sdk::common::ExportResult::kSuccess;
 }
 
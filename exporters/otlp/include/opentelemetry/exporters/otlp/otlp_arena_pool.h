@@ -0,0 +1,114 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// clang-format off
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include <google/protobuf/arena.h>
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+// clang-format on
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+/**
+ * A pool of protobuf arenas on which the exporters build their recordables and requests.
+ *
+ * The messages of a request are allocated in a few blocks of its arena instead of one by one, and
+ * are all freed at once when the request is released. The arena is then reset and kept for the
+ * next request. Its first block is never freed, so that building a request of a usual size does
+ * not allocate once the pool is warm.
+ *
+ * Recordables made one after the other share an arena, on which the request exporting them is
+ * built, so that their messages are added to the request without being copied. An arena is only
+ * reset once all the recordables made on it are released, so a recordable which is not exported
+ * for long keeps the memory of the arena it shares with the others.
+ *
+ * The pool must be owned by a std::shared_ptr. The arenas released after the pool are freed.
+ */
+class OtlpArenaPool : public std::enable_shared_from_this<OtlpArenaPool>
+{
+public:
+  // The size of the first block of each arena
+  static constexpr std::size_t kInitialBlockSize = 64 * 1024;
+
+  // The maximum size of the blocks allocated once the first block is full
+  static constexpr std::size_t kMaxBlockSize = 1024 * 1024;
+
+  // The number of recordables made on an arena before the next ones are made on another one
+  static constexpr std::size_t kRecordablesPerArena = 512;
+
+  /**
+   * @param max_idle_arenas the number of released arenas kept for later requests
+   */
+  explicit OtlpArenaPool(std::size_t max_idle_arenas = 1);
+
+  /**
+   * Create an empty message on an arena of the pool. The arena is reset and returned to the pool
+   * when the last reference to the message is released.
+   */
+  template <class MessageType>
+  std::shared_ptr<MessageType> CreateMessage()
+  {
+    return CreateMessage<MessageType>(Acquire());
+  }
+
+  /**
+   * Create an empty message on the given arena, which is kept alive by the message, or on an arena
+   * of the pool if it is nullptr.
+   */
+  template <class MessageType>
+  std::shared_ptr<MessageType> CreateMessage(std::shared_ptr<google::protobuf::Arena> arena)
+  {
+    if (!arena)
+    {
+      arena = Acquire();
+    }
+    MessageType *message = google::protobuf::Arena::CreateMessage<MessageType>(arena.get());
+    return std::shared_ptr<MessageType>(arena, message);
+  }
+
+  /**
+   * Get an empty arena, which is reset and returned to the pool when the last reference to it is
+   * released.
+   */
+  std::shared_ptr<google::protobuf::Arena> Acquire();
+
+  /**
+   * Get the arena to make the next recordable on, which is shared with the recordables made
+   * before, until kRecordablesPerArena of them were made on it.
+   */
+  std::shared_ptr<google::protobuf::Arena> AcquireRecordableArena();
+
+private:
+  struct PooledArena
+  {
+    PooledArena();
+
+    std::unique_ptr<char[]> initial_block;
+    google::protobuf::Arena arena;
+  };
+
+  void Release(PooledArena *arena) noexcept;
+
+  const std::size_t max_idle_arenas_;
+  opentelemetry::common::SpinLockMutex lock_;
+  std::vector<std::unique_ptr<PooledArena>> idle_arenas_;
+  // not owned, so that the arena returns to the pool once its recordables are released
+  std::weak_ptr<google::protobuf::Arena> recordable_arena_;
+  std::size_t recordable_arena_uses_ = 0;
+};
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
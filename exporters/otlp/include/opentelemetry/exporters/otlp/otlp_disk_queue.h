@@ -0,0 +1,161 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+/**
+ * Struct to hold the options of the disk queue, where the OTLP HTTP client keeps the requests that
+ * could not be sent because the collector was unreachable, and retries them later.
+ */
+struct OtlpDiskQueueOptions
+{
+  /** The directory of the queue files, the queue is disabled if it is empty. */
+  std::string directory;
+
+  /** The maximum size of the queue files, the oldest requests are dropped above it. */
+  std::size_t max_size = 64 * 1024 * 1024;
+
+  /** The size above which a new segment file is started. */
+  std::size_t max_segment_size = 4 * 1024 * 1024;
+
+  /** The delay before the first retry of a request. */
+  std::chrono::milliseconds initial_backoff = std::chrono::milliseconds(1000);
+
+  /** The maximum delay between two retries, the delay doubles after each failed retry. */
+  std::chrono::milliseconds max_backoff = std::chrono::milliseconds(60000);
+
+  /**
+   * The number of records removed from the queue before its position is saved. The records
+   * removed since the last save are sent again if the process stops before the next one.
+   */
+  std::size_t state_save_batch_size = 64;
+};
+
+/**
+ * A persistent FIFO queue of serialized requests.
+ *
+ * Records are appended to segment files named after their sequence number, each record being
+ * framed with its size and checksum. The position of the first record not yet removed is kept in
+ * a state file, which is replaced atomically. When the queue is opened again, for example after a
+ * crash, the records are read back from that position, and a record that was only partially
+ * written is ignored.
+ *
+ * A record is synced to the disk before Push() returns, and the state file before it replaces the
+ * previous one, so that the queue also survives a crash of the system. The position is only saved
+ * every state_save_batch_size removed records, when a segment is dropped, and when the queue is
+ * destroyed, so the last removed records may be read again after a crash.
+ *
+ * All the methods are thread safe.
+ */
+class OtlpDiskQueue
+{
+public:
+  /**
+   * The position of a record, which identifies it as long as it is in the queue.
+   */
+  struct Position
+  {
+    uint64_t sequence  = 0;
+    std::size_t offset = 0;
+  };
+
+  struct Record
+  {
+    // Flags stored along with the payload, opaque to the queue
+    uint32_t flags = 0;
+    std::vector<uint8_t> payload;
+    // The position of the record, to remove it with Pop()
+    Position position;
+  };
+
+  /**
+   * Open the queue in the directory of the options, and recover the records written by a
+   * previous instance. The directory must exist.
+   */
+  explicit OtlpDiskQueue(const OtlpDiskQueueOptions &options);
+
+  ~OtlpDiskQueue();
+
+  OtlpDiskQueue(const OtlpDiskQueue &)            = delete;
+  OtlpDiskQueue &operator=(const OtlpDiskQueue &) = delete;
+
+  /**
+   * Append a record to the queue, dropping the oldest records if the queue would grow above its
+   * maximum size.
+   * @return false if the record could not be written
+   */
+  bool Push(uint32_t flags, const uint8_t *data, std::size_t size) noexcept;
+
+  /**
+   * Read the first record of the queue without removing it.
+   * @return false if the queue is empty
+   */
+  bool Front(Record &record) noexcept;
+
+  /**
+   * Remove the first record of the queue, if it is still the record at the position returned by
+   * Front(). The record may have been dropped meanwhile, by a Push() to a full queue.
+   * @return false if the record is not at the front of the queue anymore
+   */
+  bool Pop(const Position &position) noexcept;
+
+  /**
+   * @return the size of the queue files
+   */
+  std::size_t Size() const noexcept;
+
+private:
+  bool ReadFront(Record *record) noexcept;
+  bool ReadRecord(Record *record) noexcept;
+  bool OpenWriteSegment() noexcept;
+  bool RollWriteSegment() noexcept;
+  void DropFirstSegment() noexcept;
+  void CloseReadFile() noexcept;
+  void SaveState() noexcept;
+  bool LoadState() noexcept;
+  std::string GetSegmentPath(uint64_t sequence) const;
+
+  const OtlpDiskQueueOptions options_;
+
+  mutable std::mutex lock_;
+
+  // The segment files from read_sequence_ to write_sequence_ hold the records of the queue
+  uint64_t read_sequence_  = 0;
+  uint64_t write_sequence_ = 0;
+
+  // The offset of the first record in the first segment
+  std::size_t read_offset_ = 0;
+
+  // The size of the first record, known after it is read
+  std::size_t front_size_ = 0;
+
+  // The size of the segment files, indexed from read_sequence_
+  std::vector<std::size_t> segment_sizes_;
+  std::size_t total_size_ = 0;
+
+  // The number of records removed since the state was saved
+  std::size_t unsaved_pops_ = 0;
+
+  std::FILE *read_file_  = nullptr;
+  std::FILE *write_file_ = nullptr;
+};
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
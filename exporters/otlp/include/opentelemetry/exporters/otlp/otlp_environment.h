@@ -127,6 +127,11 @@ inline std::chrono::system_clock::duration GetOtlpDefaultTimeout()
   return GetOtlpDefaultTracesTimeout();
 }
 
+// "gzip" or "none"
+std::string GetOtlpDefaultTracesCompression();
+std::string GetOtlpDefaultMetricsCompression();
+std::string GetOtlpDefaultLogsCompression();
+
 struct cmp_ic
 {
   bool operator()(const std::string &s1, const std::string &s2) const
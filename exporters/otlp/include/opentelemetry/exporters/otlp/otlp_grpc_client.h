@@ -5,9 +5,16 @@
 
 #include <grpcpp/grpcpp.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "opentelemetry/exporters/otlp/otlp_grpc_client_options.h"
+#include "opentelemetry/sdk/common/exporter_utils.h"
 
 #include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
@@ -27,10 +34,85 @@ struct OtlpGrpcClientOptions;
 
 /**
  * The OTLP gRPC client contains utility functions of gRPC.
+ *
+ * With ENABLE_ASYNC_EXPORT, an instance of the client also runs asynchronous exports, keeping
+ * track of the in-flight requests so that ForceFlush() and Shutdown() can wait for them.
  */
 class OtlpGrpcClient
 {
 public:
+#ifdef ENABLE_ASYNC_EXPORT
+  explicit OtlpGrpcClient(const OtlpGrpcClientOptions &options);
+
+  /**
+   * Rejects new requests, and waits a few seconds at most for the in-flight requests to complete.
+   * The state of the requests which do not complete, including their stub, is then leaked.
+   */
+  ~OtlpGrpcClient();
+
+  using ResultCallback = std::function<bool(opentelemetry::sdk::common::ExportResult)>;
+
+  /**
+   * Export the request asynchronously with the callback API of gRPC. If max_concurrent_requests
+   * requests are already in flight, this waits for one of them to complete first.
+   *
+   * Stubs which do not implement the callback API, like mocks, are called synchronously, within
+   * the same limit of concurrent requests.
+   *
+   * @param stub the service stub, kept alive with its channel until the client is destroyed
+   * @param context the client context of the request
+   * @param request the request to export, which may be allocated on an arena it keeps alive
+   * @param result_callback called with the result of the export, from a gRPC thread if the
+   * export is asynchronous
+   * @return kSuccess if the request was sent, or the result of the export if it was synchronous
+   */
+  opentelemetry::sdk::common::ExportResult DelegateAsyncExport(
+      const std::shared_ptr<proto::collector::trace::v1::TraceService::StubInterface> &stub,
+      std::unique_ptr<grpc::ClientContext> &&context,
+      std::shared_ptr<proto::collector::trace::v1::ExportTraceServiceRequest> &&request,
+      ResultCallback &&result_callback) noexcept;
+
+  opentelemetry::sdk::common::ExportResult DelegateAsyncExport(
+      const std::shared_ptr<proto::collector::metrics::v1::MetricsService::StubInterface> &stub,
+      std::unique_ptr<grpc::ClientContext> &&context,
+      std::shared_ptr<proto::collector::metrics::v1::ExportMetricsServiceRequest> &&request,
+      ResultCallback &&result_callback) noexcept;
+
+  opentelemetry::sdk::common::ExportResult DelegateAsyncExport(
+      const std::shared_ptr<proto::collector::logs::v1::LogsService::StubInterface> &stub,
+      std::unique_ptr<grpc::ClientContext> &&context,
+      std::shared_ptr<proto::collector::logs::v1::ExportLogsServiceRequest> &&request,
+      ResultCallback &&result_callback) noexcept;
+
+  /**
+   * Wait for the in-flight requests to complete.
+   * @param timeout the maximum time to wait
+   * @return true if all the requests completed before the timeout
+   */
+  bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept;
+
+  /**
+   * Reject new requests, and wait for the in-flight requests to complete.
+   * @param timeout the maximum time to wait
+   * @return true if all the requests completed before the timeout
+   */
+  bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept;
+
+  /**
+   * The state shared between the client and its in-flight requests.
+   */
+  struct AsyncData
+  {
+    std::size_t max_concurrent_requests = 64;
+    std::atomic<std::size_t> running_requests{0};
+    std::atomic<bool> is_shutdown{false};
+    std::mutex requests_lock;
+    std::condition_variable requests_cv;
+    // The stubs used by the requests, and so their channel
+    std::vector<std::shared_ptr<void>> stubs;
+  };
+#endif
+
   /**
    * Create gRPC channel from the exporter options.
    */
@@ -82,6 +164,11 @@ class OtlpGrpcClient
       grpc::ClientContext *context,
       const proto::collector::logs::v1::ExportLogsServiceRequest &request,
       proto::collector::logs::v1::ExportLogsServiceResponse *response);
+
+#ifdef ENABLE_ASYNC_EXPORT
+private:
+  std::unique_ptr<AsyncData> async_data_;
+#endif
 };
 }  // namespace otlp
 }  // namespace exporter
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
+#include "opentelemetry/exporters/otlp/otlp_retry_policy.h"
 #include "opentelemetry/version.h"
 
 #include <chrono>
@@ -51,6 +52,17 @@ struct OtlpGrpcClientOptions
 
   /** User agent. */
   std::string user_agent;
+
+  /** Compression type, "gzip" or "none". */
+  std::string compression;
+
+  /** Retry policy of the requests which failed with a retryable status. */
+  OtlpRetryPolicy retry_policy;
+
+#ifdef ENABLE_ASYNC_EXPORT
+  /** Max number of concurrent requests, Export() waits for a slot when it is reached. */
+  std::size_t max_concurrent_requests = 64;
+#endif
 };
 
 }  // namespace otlp
@@ -14,8 +14,10 @@
 
 #include "opentelemetry/sdk/trace/exporter.h"
 
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_grpc_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace exporter
@@ -23,6 +25,8 @@ namespace exporter
 namespace otlp
 {
 
+class OtlpGrpcClient;
+
 /**
  * The OTLP exporter exports span data in OpenTelemetry Protocol (OTLP) format.
  */
@@ -73,12 +77,24 @@ class OtlpGrpcExporter final : public opentelemetry::sdk::trace::SpanExporter
   // The configuration options associated with this exporter.
   const OtlpGrpcExporterOptions options_;
 
+  // The protos of the resources and instrumentation scopes exported so far.
+  OtlpResourceCache resource_cache_;
+
+  // The arenas on which the recordables and requests are built, reused between batches.
+  std::shared_ptr<OtlpArenaPool> arena_pool_ = std::make_shared<OtlpArenaPool>();
+
   // For testing
   friend class OtlpGrpcExporterTestPeer;
   friend class OtlpGrpcLogRecordExporterTestPeer;
 
   // Store service stub internally. Useful for testing.
-  std::unique_ptr<proto::collector::trace::v1::TraceService::StubInterface> trace_service_stub_;
+  std::shared_ptr<proto::collector::trace::v1::TraceService::StubInterface> trace_service_stub_;
+
+#ifdef ENABLE_ASYNC_EXPORT
+  // Runs the asynchronous exports. It shares the ownership of the stub, and keeps it alive for the
+  // requests still in flight when it is destroyed.
+  std::shared_ptr<OtlpGrpcClient> client_;
+#endif
 
   /**
    * Create an OtlpGrpcExporter using the specified service stub.
@@ -12,8 +12,10 @@
 
 // clang-format on
 
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_grpc_log_record_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 #include "opentelemetry/sdk/logs/exporter.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -22,6 +24,8 @@ namespace exporter
 namespace otlp
 {
 
+class OtlpGrpcClient;
+
 /**
  * The OTLP exporter exports log data in OpenTelemetry Protocol (OTLP) format in gRPC.
  */
@@ -73,11 +77,23 @@ class OtlpGrpcLogRecordExporter : public opentelemetry::sdk::logs::LogRecordExpo
   // Configuration options for the exporter
   const OtlpGrpcLogRecordExporterOptions options_;
 
+  // The protos of the resources and instrumentation scopes exported so far.
+  OtlpResourceCache resource_cache_;
+
+  // The arenas on which the recordables and requests are built, reused between batches.
+  std::shared_ptr<OtlpArenaPool> arena_pool_ = std::make_shared<OtlpArenaPool>();
+
   // For testing
   friend class OtlpGrpcLogRecordExporterTestPeer;
 
   // Store service stub internally. Useful for testing.
-  std::unique_ptr<proto::collector::logs::v1::LogsService::StubInterface> log_service_stub_;
+  std::shared_ptr<proto::collector::logs::v1::LogsService::StubInterface> log_service_stub_;
+
+#ifdef ENABLE_ASYNC_EXPORT
+  // Runs the asynchronous exports. It shares the ownership of the stub, and keeps it alive for the
+  // requests still in flight when it is destroyed.
+  std::shared_ptr<OtlpGrpcClient> client_;
+#endif
 
   /**
    * Create an OtlpGrpcLogRecordExporter using the specified service stub.
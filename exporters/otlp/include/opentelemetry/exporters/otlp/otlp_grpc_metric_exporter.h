@@ -12,8 +12,10 @@
 
 // clang-format on
 
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_grpc_metric_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -22,6 +24,8 @@ namespace exporter
 namespace otlp
 {
 
+class OtlpGrpcClient;
+
 /**
  * The OTLP exporter exports metrics data in OpenTelemetry Protocol (OTLP) format in gRPC.
  */
@@ -59,6 +63,12 @@ class OtlpGrpcMetricExporter : public opentelemetry::sdk::metrics::PushMetricExp
   // The configuration options associated with this exporter.
   const OtlpGrpcMetricExporterOptions options_;
 
+  // The protos of the resources and instrumentation scopes exported so far.
+  OtlpResourceCache resource_cache_;
+
+  // The arenas on which the requests are built, reused between batches.
+  std::shared_ptr<OtlpArenaPool> arena_pool_ = std::make_shared<OtlpArenaPool>();
+
   // Aggregation Temporality selector
   const sdk::metrics::AggregationTemporalitySelector aggregation_temporality_selector_;
 
@@ -66,9 +76,15 @@ class OtlpGrpcMetricExporter : public opentelemetry::sdk::metrics::PushMetricExp
   friend class OtlpGrpcMetricExporterTestPeer;
 
   // Store service stub internally. Useful for testing.
-  std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface>
+  std::shared_ptr<proto::collector::metrics::v1::MetricsService::StubInterface>
       metrics_service_stub_;
 
+#ifdef ENABLE_ASYNC_EXPORT
+  // Runs the asynchronous exports. It shares the ownership of the stub, and keeps it alive for the
+  // requests still in flight when it is destroyed.
+  std::shared_ptr<OtlpGrpcClient> client_;
+#endif
+
   /**
    * Create an OtlpGrpcMetricExporter using the specified service stub.
    * Only tests can call this constructor directly.
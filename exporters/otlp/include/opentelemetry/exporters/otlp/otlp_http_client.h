@@ -8,8 +8,10 @@
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/exporter_utils.h"
 
+#include "opentelemetry/exporters/otlp/otlp_disk_queue.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_http.h"
+#include "opentelemetry/exporters/otlp/otlp_retry_policy.h"
 
 #include <atomic>
 #include <chrono>
@@ -17,10 +19,13 @@
 #include <cstddef>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 // forward declare google::protobuf::Message
 namespace google
@@ -59,6 +64,10 @@ struct OtlpHttpClientOptions
   // This option is ignored if content_type is not kJson
   JsonBytesMappingKind json_bytes_mapping = JsonBytesMappingKind::kHexId;
 
+  // Compression type, "gzip" or "none". Requests are sent uncompressed if gzip support is not
+  // built in.
+  std::string compression;
+
   // If using the json name of protobuf field to set the key of json. By default, we will use the
   // field name just like proto files.
   bool use_json_name = false;
@@ -77,9 +86,19 @@ struct OtlpHttpClientOptions
   // Requests per connections
   std::size_t max_requests_per_connection = 8;
 
+  // HTTP version, connection limit and keep-alive of the connections
+  ext::http::client::HttpConnectionOptions connection_options;
+
   // User agent
   std::string user_agent;
 
+  // Retry policy of the requests which failed with a retryable status
+  OtlpRetryPolicy retry_policy;
+
+  // Disk queue where the requests that failed because the collector was unreachable are kept and
+  // retried. It is disabled by default.
+  OtlpDiskQueueOptions disk_queue;
+
   inline OtlpHttpClientOptions(nostd::string_view input_url,
                                bool input_ssl_insecure_skip_verify,
                                nostd::string_view input_ssl_ca_cert_path,
@@ -100,7 +119,8 @@ struct OtlpHttpClientOptions
                                const OtlpHeaders &input_http_headers,
                                std::size_t input_concurrent_sessions         = 64,
                                std::size_t input_max_requests_per_connection = 8,
-                               nostd::string_view input_user_agent = GetOtlpDefaultUserAgent())
+                               nostd::string_view input_user_agent = GetOtlpDefaultUserAgent(),
+                               nostd::string_view input_compression = "")
       : url(input_url),
         ssl_options(input_url,
                     input_ssl_insecure_skip_verify,
@@ -116,6 +136,7 @@ struct OtlpHttpClientOptions
                     input_ssl_cipher_suite),
         content_type(input_content_type),
         json_bytes_mapping(input_json_bytes_mapping),
+        compression(input_compression),
         use_json_name(input_use_json_name),
         console_debug(input_console_debug),
         timeout(input_timeout),
@@ -132,6 +153,14 @@ struct OtlpHttpClientOptions
 class OtlpHttpClient
 {
 public:
+  /**
+   * The callback called when a request failed because the collector is unreachable or throttling.
+   * It may take over the request and its result callback, and returns true if it did.
+   */
+  using RetryableFailureCallback = std::function<bool(
+      std::chrono::system_clock::duration retry_after,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback)>;
+
   /**
    * Create an OtlpHttpClient using the given options.
    */
@@ -171,6 +200,41 @@ class OtlpHttpClient
       std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback,
       std::size_t max_running_requests) noexcept;
 
+  /**
+   * Sync export of a request already serialized in the protobuf binary format. It is only
+   * supported with HttpRequestContentType::kBinary.
+   * @param request_body the serialized ExportTraceServiceRequest, ExportMetricsServiceRequest or
+   * ExportLogsServiceRequest, which is moved into the HTTP request
+   * @return return the status of this operation
+   */
+  sdk::common::ExportResult Export(ext::http::client::Body &&request_body) noexcept;
+
+  /**
+   * Async export of a request already serialized in the protobuf binary format. It is only
+   * supported with HttpRequestContentType::kBinary.
+   * @param request_body the serialized ExportTraceServiceRequest, ExportMetricsServiceRequest or
+   * ExportLogsServiceRequest, which is moved into the HTTP request
+   * @param result_callback callback to call when the exporting is done
+   * @return return the status of this operation
+   */
+  sdk::common::ExportResult Export(
+      ext::http::client::Body &&request_body,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback) noexcept;
+
+  /**
+   * Async export of a request already serialized in the protobuf binary format. It is only
+   * supported with HttpRequestContentType::kBinary.
+   * @param request_body the serialized ExportTraceServiceRequest, ExportMetricsServiceRequest or
+   * ExportLogsServiceRequest, which is moved into the HTTP request
+   * @param result_callback callback to call when the exporting is done
+   * @param max_running_requests wait for at most max_running_requests running requests
+   * @return return the status of this operation
+   */
+  sdk::common::ExportResult Export(
+      ext::http::client::Body &&request_body,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback,
+      std::size_t max_running_requests) noexcept;
+
   /**
    * Force flush the HTTP client.
    */
@@ -233,6 +297,27 @@ class OtlpHttpClient
     }
   };
 
+  /**
+   * A request which may be sent again, with its serialized body.
+   */
+  struct RetryableRequest
+  {
+    std::shared_ptr<const ext::http::client::Body> body;
+    const char *content_type;
+    bool compressed;
+    std::size_t attempts;
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  /**
+   * A request waiting for its next attempt.
+   */
+  struct ScheduledRetry
+  {
+    std::shared_ptr<RetryableRequest> request;
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> result_callback;
+  };
+
   /**
    * @brief Create a Session object or return a error result
    *
@@ -242,6 +327,32 @@ class OtlpHttpClient
       const google::protobuf::Message &message,
       std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback) noexcept;
 
+  /**
+   * @brief Create a Session object or return a error result
+   *
+   * @param body The request body to send, shared with the retries of the request
+   * @param content_type The content type of the request body
+   * @param compressed Whether the request body is compressed with gzip
+   * @param retryable_failure_callback The callback called if the request fails because the
+   * collector is unreachable or throttling. By default the request is retried according to the
+   * retry policy, and then pushed to the disk queue if it is enabled.
+   */
+  nostd::variant<sdk::common::ExportResult, HttpSessionData> createSession(
+      std::shared_ptr<const ext::http::client::Body> body,
+      const char *content_type,
+      bool compressed,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback,
+      RetryableFailureCallback &&retryable_failure_callback = nullptr) noexcept;
+
+  /**
+   * Send the request of a created session, and wait until at most max_running_requests requests
+   * are running.
+   */
+  sdk::common::ExportResult sendSession(
+      nostd::variant<sdk::common::ExportResult, HttpSessionData> &&session,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback,
+      std::size_t max_running_requests) noexcept;
+
   /**
    * Add http session and hold it's lifetime.
    * @param session_data the session to add
@@ -256,6 +367,96 @@ class OtlpHttpClient
    */
   bool cleanupGCSessions() noexcept;
 
+  /**
+   * Check the compression option, and enable gzip if it is requested and supported.
+   */
+  void checkCompression() noexcept;
+
+  /**
+   * Start the thread sending the requests to retry, if retries are enabled.
+   */
+  void startRetries() noexcept;
+
+  /**
+   * Stop the thread sending the requests to retry. The requests waiting for a retry are pushed to
+   * the disk queue if it is enabled, and fail otherwise. Must be called before stopDiskQueue().
+   */
+  void stopRetries() noexcept;
+
+  /**
+   * Send the requests to retry when they are due. Runs on retry_thread_ until stopRetries() is
+   * called.
+   */
+  void runRetries() noexcept;
+
+  /**
+   * Send a request again.
+   */
+  void sendRetry(ScheduledRetry &&retry) noexcept;
+
+  /**
+   * Schedule the next attempt of a failed request, or push it to the disk queue if it can not be
+   * retried anymore.
+   * @param retry_after the delay requested by the server, or zero
+   * @param result_callback the callback of the request, moved from if the request is taken over
+   * @return true if the request is taken over
+   */
+  bool retryRequest(
+      const std::shared_ptr<RetryableRequest> &request,
+      std::chrono::system_clock::duration retry_after,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback) noexcept;
+
+  /**
+   * Create the callback retrying a request when it fails.
+   */
+  RetryableFailureCallback makeRetryableFailureCallback(
+      std::shared_ptr<RetryableRequest> request) noexcept;
+
+  /**
+   * Remove a retry from the pending requests, once it is sent or failed.
+   */
+  void finishRetry() noexcept;
+
+  /**
+   * Open the disk queue and start the thread retrying its requests, if it is enabled.
+   */
+  void startDiskQueue() noexcept;
+
+  /**
+   * Stop the thread retrying the requests of the disk queue. The requests are kept in the queue.
+   */
+  void stopDiskQueue() noexcept;
+
+  /**
+   * Hand a request that failed because the collector was unreachable to disk_queue_thread_, which
+   * writes it to the disk queue and then calls its callback. The file I/O does not run on the
+   * thread of the HTTP client, which handles the responses of the other requests.
+   * @param result_callback the callback of the request, moved from if the request is taken over
+   * @return true if the request is taken over
+   */
+  bool pushToDiskQueue(
+      const std::shared_ptr<RetryableRequest> &request,
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback) noexcept;
+
+  /**
+   * Write the requests handed over by pushToDiskQueue() to the disk queue.
+   */
+  void writeDiskQueueRecords() noexcept;
+
+  /**
+   * Write the requests handed over to the disk queue, and retry the requests of the disk queue in
+   * order, with an exponential backoff while the collector is unreachable. Runs on
+   * disk_queue_thread_ until stopDiskQueue() is called.
+   */
+  void drainDiskQueue() noexcept;
+
+  /**
+   * Send a request of the disk queue and wait for its result.
+   * @param retryable set to true if the request failed because the collector is unreachable
+   */
+  sdk::common::ExportResult sendDiskQueueRecord(OtlpDiskQueue::Record &&record,
+                                                bool &retryable) noexcept;
+
   // For testing
   friend class OtlpHttpExporterTestPeer;
   friend class OtlpHttpLogRecordExporterTestPeer;
@@ -282,6 +483,12 @@ class OtlpHttpClient
   // Cached parsed URI
   std::string http_uri_;
 
+  // Whether request bodies are compressed with gzip
+  bool use_gzip_ = false;
+
+  // Size of the last OTLP/JSON request body, used to reserve the next one
+  std::atomic<std::size_t> last_json_body_size_{0};
+
   // Running sessions and event handles
   std::unordered_map<const opentelemetry::ext::http::client::Session *, HttpSessionData>
       running_sessions_;
@@ -292,6 +499,28 @@ class OtlpHttpClient
   // Condition variable and mutex to control the concurrency count of running sessions
   std::mutex session_waker_lock_;
   std::condition_variable session_waker_;
+
+  // Requests waiting for their next attempt, ordered by the time of that attempt
+  std::multimap<std::chrono::steady_clock::time_point, ScheduledRetry> scheduled_retries_;
+  std::thread retry_thread_;
+  // Lock for scheduled_retries_ and retry_stopping_, and to wake up retry_thread_
+  std::mutex retry_lock_;
+  std::condition_variable retry_waker_;
+  bool retry_stopping_ = false;
+  // Number of requests waiting for their next attempt, which are not in running_sessions_
+  std::atomic<std::size_t> pending_retries_{0};
+
+  // The requests kept on disk, and the thread retrying them
+  std::unique_ptr<OtlpDiskQueue> disk_queue_;
+  std::thread disk_queue_thread_;
+  // Lock for disk_queue_pending_ and the stop flags, and to wake up disk_queue_thread_
+  std::mutex disk_queue_lock_;
+  std::condition_variable disk_queue_waker_;
+  // Requests to write to the disk queue, counted in pending_retries_ until they are written
+  std::vector<ScheduledRetry> disk_queue_pending_;
+  bool disk_queue_stopping_ = false;
+  // Set once the thread is stopped, the requests are not taken over anymore
+  bool disk_queue_stopped_ = false;
 };
 }  // namespace otlp
 }  // namespace exporter
@@ -8,7 +8,9 @@
 
 #include "opentelemetry/exporters/otlp/otlp_http_client.h"
 
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 
 #include "opentelemetry/exporters/otlp/otlp_http_exporter_options.h"
 
@@ -71,9 +73,18 @@ class OPENTELEMETRY_EXPORT OtlpHttpExporter final : public opentelemetry::sdk::t
       std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
 
 private:
+  // Whether spans are recorded by OtlpWireRecordable and exported without proto messages
+  bool IsDirectSpanEncoding() const noexcept;
+
   // The configuration options associated with this exporter.
   const OtlpHttpExporterOptions options_;
 
+  // The protos of the resources and instrumentation scopes exported so far.
+  OtlpResourceCache resource_cache_;
+
+  // The arenas on which the recordables and requests are built, reused between batches.
+  std::shared_ptr<OtlpArenaPool> arena_pool_ = std::make_shared<OtlpArenaPool>();
+
   // Object that stores the HTTP sessions that have been created
   std::unique_ptr<OtlpHttpClient> http_client_;
   // For testing
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include "opentelemetry/exporters/otlp/otlp_disk_queue.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_http.h"
+#include "opentelemetry/exporters/otlp/otlp_retry_policy.h"
+#include "opentelemetry/ext/http/client/http_client.h"
 #include "opentelemetry/version.h"
 
 #include <chrono>
@@ -60,6 +63,32 @@ struct OPENTELEMETRY_EXPORT OtlpHttpExporterOptions
   /** Additional HTTP headers. */
   OtlpHeaders http_headers;
 
+  /** Compression type, "gzip" or "none". */
+  std::string compression;
+
+  /** Retry policy of the requests which failed with a retryable status. */
+  OtlpRetryPolicy retry_policy;
+
+  /**
+    Disk queue where the requests are kept while the collector is unreachable, and retried.
+    Disabled if its directory is empty.
+  */
+  OtlpDiskQueueOptions disk_queue;
+
+  /**
+    HTTP version, connection limit and keep-alive of the connections to the collector.
+    With HTTP/2, the concurrent requests are multiplexed over a few connections.
+  */
+  ext::http::client::HttpConnectionOptions connection_options;
+
+  /**
+    Encode spans directly in the protobuf wire format as they are recorded, instead of building
+    proto messages which are serialized at export.
+
+    Used only for HttpRequestContentType::kBinary.
+  */
+  bool direct_span_encoding;
+
 #ifdef ENABLE_ASYNC_EXPORT
   /** Max number of concurrent requests. */
   std::size_t max_concurrent_requests;
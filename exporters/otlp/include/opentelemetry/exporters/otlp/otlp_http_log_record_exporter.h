@@ -7,8 +7,10 @@
 
 #include "opentelemetry/exporters/otlp/otlp_http_client.h"
 
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_http_log_record_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 
 #include <chrono>
 #include <cstddef>
@@ -71,6 +73,12 @@ class OtlpHttpLogRecordExporter final : public opentelemetry::sdk::logs::LogReco
   // Configuration options for the exporter
   const OtlpHttpLogRecordExporterOptions options_;
 
+  // The protos of the resources and instrumentation scopes exported so far.
+  OtlpResourceCache resource_cache_;
+
+  // The arenas on which the recordables and requests are built, reused between batches.
+  std::shared_ptr<OtlpArenaPool> arena_pool_ = std::make_shared<OtlpArenaPool>();
+
   // Object that stores the HTTP sessions that have been created
   std::unique_ptr<OtlpHttpClient> http_client_;
   // For testing
@@ -5,9 +5,11 @@
 
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
 
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
 #include "opentelemetry/exporters/otlp/otlp_environment.h"
 #include "opentelemetry/exporters/otlp/otlp_http_client.h"
 #include "opentelemetry/exporters/otlp/otlp_http_metric_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 
 #include <chrono>
 #include <cstddef>
@@ -60,6 +62,12 @@ class OtlpHttpMetricExporter final : public opentelemetry::sdk::metrics::PushMet
   // Configuration options for the exporter
   const OtlpHttpMetricExporterOptions options_;
 
+  // The protos of the resources and instrumentation scopes exported so far.
+  OtlpResourceCache resource_cache_;
+
+  // The arenas on which the requests are built, reused between batches.
+  std::shared_ptr<OtlpArenaPool> arena_pool_ = std::make_shared<OtlpArenaPool>();
+
   // Aggregation Temporality Selector
   const sdk::metrics::AggregationTemporalitySelector aggregation_temporality_selector_;
 
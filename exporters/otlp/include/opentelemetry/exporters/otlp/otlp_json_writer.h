@@ -0,0 +1,68 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "opentelemetry/exporters/otlp/otlp_http.h"
+#include "opentelemetry/version.h"
+
+// forward declare google::protobuf::Message
+namespace google
+{
+namespace protobuf
+{
+class Message;
+}
+}  // namespace google
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+/**
+ * Options of the OTLP/JSON encoding.
+ */
+struct OtlpJsonOptions
+{
+  // If convert bytes into hex. By default, we will convert all bytes but id into base64
+  JsonBytesMappingKind json_bytes_mapping = JsonBytesMappingKind::kHexId;
+
+  // If using the json name of protobuf field to set the key of json. By default, we will use the
+  // field name just like proto files.
+  bool use_json_name = false;
+};
+
+/**
+ * The OtlpJsonWriter encodes OTLP messages in OTLP/JSON.
+ *
+ * The trace, metrics and logs export requests are written field by field from the generated
+ * accessors, straight into the output buffer. Other messages are converted through the protobuf
+ * reflection API.
+ */
+class OtlpJsonWriter
+{
+public:
+  /**
+   * Append the OTLP/JSON encoding of the message to the output.
+   */
+  static void Write(const google::protobuf::Message &message,
+                    const OtlpJsonOptions &options,
+                    std::vector<uint8_t> &output);
+
+  /**
+   * Append the OTLP/JSON encoding of the message to the output, using the protobuf reflection
+   * API for any message.
+   */
+  static void WriteWithReflection(const google::protobuf::Message &message,
+                                  const OtlpJsonOptions &options,
+                                  std::vector<uint8_t> &output);
+};
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <memory>
+
 // clang-format off
 #include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
+#include <google/protobuf/arena.h>
 #include "opentelemetry/proto/logs/v1/logs.pb.h"
 #include "opentelemetry/proto/resource/v1/resource.pb.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
@@ -30,10 +33,31 @@ namespace otlp
 class OtlpLogRecordable final : public opentelemetry::sdk::logs::Recordable
 {
 public:
-  ~OtlpLogRecordable() override = default;
+  OtlpLogRecordable() noexcept;
+
+  /**
+   * Create a recordable whose log record is allocated on the given arena, which the recordable
+   * keeps alive.
+   */
+  explicit OtlpLogRecordable(std::shared_ptr<google::protobuf::Arena> arena) noexcept;
+
+  ~OtlpLogRecordable() override;
 
-  proto::logs::v1::LogRecord &log_record() noexcept { return proto_record_; }
-  const proto::logs::v1::LogRecord &log_record() const noexcept { return proto_record_; }
+  OtlpLogRecordable(const OtlpLogRecordable &)            = delete;
+  OtlpLogRecordable &operator=(const OtlpLogRecordable &) = delete;
+
+  proto::logs::v1::LogRecord &log_record() noexcept { return *proto_record_; }
+  const proto::logs::v1::LogRecord &log_record() const noexcept { return *proto_record_; }
+
+  /** Returns the arena the log record is allocated on, or nullptr if it is on the heap. */
+  const std::shared_ptr<google::protobuf::Arena> &GetArena() const noexcept { return arena_; }
+
+  /**
+   * Releases the log record, so that it can be added to a request without being copied. The
+   * caller owns the log record unless it is allocated on an arena. The recordable must not be
+   * used after.
+   */
+  proto::logs::v1::LogRecord *ReleaseLogRecord() noexcept;
 
   /** Returns the associated resource */
   const opentelemetry::sdk::resource::Resource &GetResource() const noexcept;
@@ -116,7 +140,9 @@ class OtlpLogRecordable final : public opentelemetry::sdk::logs::Recordable
                                    &instrumentation_scope) noexcept override;
 
 private:
-  proto::logs::v1::LogRecord proto_record_;
+  std::shared_ptr<google::protobuf::Arena> arena_;
+  // owned by the recordable unless allocated on the arena
+  proto::logs::v1::LogRecord *proto_record_;
   const opentelemetry::sdk::resource::Resource *resource_ = nullptr;
   const opentelemetry::sdk::instrumentationscope::InstrumentationScope *instrumentation_scope_ =
       nullptr;
@@ -12,6 +12,7 @@
 #include "opentelemetry/exporters/otlp/otlp_preferred_temporality.h"
 #include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
 
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 #include "opentelemetry/sdk/metrics/export/metric_producer.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -37,6 +38,10 @@ class OtlpMetricUtils
   static void ConvertHistogramMetric(const opentelemetry::sdk::metrics::MetricData &metric_data,
                                      proto::metrics::v1::Histogram *const histogram) noexcept;
 
+  static void ConvertExponentialHistogramMetric(
+      const opentelemetry::sdk::metrics::MetricData &metric_data,
+      proto::metrics::v1::ExponentialHistogram *const histogram) noexcept;
+
   static void ConvertGaugeMetric(const opentelemetry::sdk::metrics::MetricData &metric_data,
                                  proto::metrics::v1::Gauge *const gauge) noexcept;
 
@@ -46,11 +51,13 @@ class OtlpMetricUtils
 
   static void PopulateResourceMetrics(
       const opentelemetry::sdk::metrics::ResourceMetrics &data,
-      proto::metrics::v1::ResourceMetrics *proto_resource_metrics) noexcept;
+      proto::metrics::v1::ResourceMetrics *proto_resource_metrics,
+      OtlpResourceCache *cache = nullptr) noexcept;
 
   static void PopulateRequest(
       const opentelemetry::sdk::metrics::ResourceMetrics &data,
-      proto::collector::metrics::v1::ExportMetricsServiceRequest *request) noexcept;
+      proto::collector::metrics::v1::ExportMetricsServiceRequest *request,
+      OtlpResourceCache *cache = nullptr) noexcept;
 
   static sdk::metrics::AggregationTemporalitySelector ChooseTemporalitySelector(
       PreferredAggregationTemporality preferred_aggregation_temporality) noexcept;
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
+#include <google/protobuf/arena.h>
 #include "opentelemetry/proto/resource/v1/resource.pb.h"
 #include "opentelemetry/proto/trace/v1/trace.pb.h"
 
@@ -21,8 +24,30 @@ namespace otlp
 class OtlpRecordable final : public opentelemetry::sdk::trace::Recordable
 {
 public:
-  proto::trace::v1::Span &span() noexcept { return span_; }
-  const proto::trace::v1::Span &span() const noexcept { return span_; }
+  OtlpRecordable() noexcept;
+
+  /**
+   * Create a recordable whose span is allocated on the given arena, which the recordable keeps
+   * alive.
+   */
+  explicit OtlpRecordable(std::shared_ptr<google::protobuf::Arena> arena) noexcept;
+
+  ~OtlpRecordable() override;
+
+  OtlpRecordable(const OtlpRecordable &)            = delete;
+  OtlpRecordable &operator=(const OtlpRecordable &) = delete;
+
+  proto::trace::v1::Span &span() noexcept { return *span_; }
+  const proto::trace::v1::Span &span() const noexcept { return *span_; }
+
+  /** Returns the arena the span is allocated on, or nullptr if it is allocated on the heap. */
+  const std::shared_ptr<google::protobuf::Arena> &GetArena() const noexcept { return arena_; }
+
+  /**
+   * Releases the span, so that it can be added to a request without being copied. The caller
+   * owns the span unless it is allocated on an arena. The recordable must not be used after.
+   */
+  proto::trace::v1::Span *ReleaseSpan() noexcept;
 
   /** Dynamically converts the resource of this span into a proto. */
   proto::resource::v1::Resource ProtoResource() const noexcept;
@@ -65,7 +90,9 @@ class OtlpRecordable final : public opentelemetry::sdk::trace::Recordable
                                    &instrumentation_scope) noexcept override;
 
 private:
-  proto::trace::v1::Span span_;
+  std::shared_ptr<google::protobuf::Arena> arena_;
+  // owned by the recordable unless allocated on the arena
+  proto::trace::v1::Span *span_;
   const opentelemetry::sdk::resource::Resource *resource_ = nullptr;
   const opentelemetry::sdk::instrumentationscope::InstrumentationScope *instrumentation_scope_ =
       nullptr;
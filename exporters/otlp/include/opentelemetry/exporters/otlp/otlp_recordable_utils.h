@@ -9,11 +9,13 @@
 
 #include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
+#include <google/protobuf/arena.h>
 #include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
 #include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
 
 #include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
 
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
 #include "opentelemetry/sdk/trace/recordable.h"
 
 #include "opentelemetry/sdk/logs/recordable.h"
@@ -29,13 +31,39 @@ namespace otlp
 class OtlpRecordableUtils
 {
 public:
+  /**
+   * Populate the request with the given spans. If a cache is given, the resource and
+   * instrumentation scope protos are taken from it.
+   */
   static void PopulateRequest(
       const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans,
-      proto::collector::trace::v1::ExportTraceServiceRequest *request) noexcept;
+      proto::collector::trace::v1::ExportTraceServiceRequest *request,
+      OtlpResourceCache *cache = nullptr) noexcept;
 
+  /**
+   * Populate the request with the given log records. If a cache is given, the resource and
+   * instrumentation scope protos are taken from it.
+   */
   static void PopulateRequest(
       const nostd::span<std::unique_ptr<opentelemetry::sdk::logs::Recordable>> &logs,
-      proto::collector::logs::v1::ExportLogsServiceRequest *request) noexcept;
+      proto::collector::logs::v1::ExportLogsServiceRequest *request,
+      OtlpResourceCache *cache = nullptr) noexcept;
+
+  /**
+   * Get the arena the first span was allocated on, to build the request on, so that the spans
+   * allocated on the same arena are added to the request without being copied.
+   * @return the arena, or nullptr if the span is allocated on the heap
+   */
+  static std::shared_ptr<google::protobuf::Arena> GetArena(
+      const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans) noexcept;
+
+  /**
+   * Get the arena the first log record was allocated on, to build the request on, so that the log
+   * records allocated on the same arena are added to the request without being copied.
+   * @return the arena, or nullptr if the log record is allocated on the heap
+   */
+  static std::shared_ptr<google::protobuf::Arena> GetArena(
+      const nostd::span<std::unique_ptr<opentelemetry::sdk::logs::Recordable>> &logs) noexcept;
 };
 }  // namespace otlp
 }  // namespace exporter
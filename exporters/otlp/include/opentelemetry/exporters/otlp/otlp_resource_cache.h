@@ -0,0 +1,116 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// clang-format off
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/common/v1/common.pb.h"
+#include "opentelemetry/proto/resource/v1/resource.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+// clang-format on
+
+#include <string>
+#include <unordered_map>
+
+#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+/**
+ * A cache of the Resource and InstrumentationScope protos of an exporter.
+ *
+ * Resources and instrumentation scopes are owned by the providers, tracers, loggers and meters,
+ * so the same objects come back in every batch. Their protos are converted once, keyed by the
+ * address of the SDK object, and copied into each request. An entry is converted again if the
+ * object at the same address does not have the same content anymore, so that an object
+ * destroyed and replaced by another one at the same address is never exported with stale data.
+ */
+class OtlpResourceCache
+{
+public:
+  // The cache is cleared when it holds this many resources or scopes, so that objects destroyed
+  // with their provider do not accumulate.
+  static constexpr std::size_t kMaxEntries = 256;
+
+  /**
+   * Copy the proto of the given resource into proto_resource.
+   */
+  void PopulateResource(const opentelemetry::sdk::resource::Resource &resource,
+                        proto::resource::v1::Resource *proto_resource) noexcept;
+
+  /**
+   * Copy the proto of the given instrumentation scope into proto_scope.
+   */
+  void PopulateInstrumentationScope(
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope,
+      proto::common::v1::InstrumentationScope *proto_scope) noexcept;
+
+  /**
+   * Return the serialized proto of the given resource.
+   */
+  std::string GetSerializedResource(
+      const opentelemetry::sdk::resource::Resource &resource) noexcept;
+
+  /**
+   * Return the serialized proto of the given instrumentation scope.
+   */
+  std::string GetSerializedInstrumentationScope(
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope) noexcept;
+
+  /**
+   * Convert the given resource into proto_resource, without caching it.
+   */
+  static void ConvertResource(const opentelemetry::sdk::resource::Resource &resource,
+                              proto::resource::v1::Resource *proto_resource) noexcept;
+
+  /**
+   * Convert the given instrumentation scope into proto_scope, without caching it.
+   */
+  static void ConvertInstrumentationScope(
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope,
+      proto::common::v1::InstrumentationScope *proto_scope) noexcept;
+
+private:
+  // The entries keep a copy of the content they were converted from, which is compared with the
+  // object found at the same address.
+  struct ResourceEntry
+  {
+    opentelemetry::sdk::resource::ResourceAttributes attributes;
+    std::string schema_url;
+    proto::resource::v1::Resource proto;
+    std::string serialized;
+  };
+
+  struct InstrumentationScopeEntry
+  {
+    std::string name;
+    std::string version;
+    std::string schema_url;
+    opentelemetry::sdk::instrumentationscope::InstrumentationScopeAttributes attributes;
+    proto::common::v1::InstrumentationScope proto;
+    std::string serialized;
+  };
+
+  // Find the entry of the given resource or scope, converting it if needed. lock_ must be held.
+  ResourceEntry &GetResourceEntry(const opentelemetry::sdk::resource::Resource &resource);
+  InstrumentationScopeEntry &GetInstrumentationScopeEntry(
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope);
+
+  opentelemetry::common::SpinLockMutex lock_;
+  std::unordered_map<const opentelemetry::sdk::resource::Resource *, ResourceEntry> resources_;
+  std::unordered_map<const opentelemetry::sdk::instrumentationscope::InstrumentationScope *,
+                     InstrumentationScopeEntry>
+      scopes_;
+};
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
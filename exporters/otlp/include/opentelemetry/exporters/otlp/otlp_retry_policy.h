@@ -0,0 +1,54 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+/**
+ * Struct to hold the retry policy of the requests which failed with a retryable status, as defined
+ * in the OTLP specification.
+ *
+ * The delay before the n-th retry is chosen randomly between zero and
+ * min(initial_backoff * backoff_multiplier^(n-1), max_backoff), unless the server gave a delay,
+ * like gRPC does for its retries.
+ *
+ * See
+ * https://github.com/open-telemetry/opentelemetry-proto/blob/main/docs/specification.md#failures
+ */
+struct OtlpRetryPolicy
+{
+  /**
+   * The maximum number of attempts of a request, including the first one, 0 or 1 to disable. The
+   * requests are not retried by default.
+   */
+  std::size_t max_attempts = 1;
+
+  /** The maximum delay before the first retry. */
+  std::chrono::milliseconds initial_backoff = std::chrono::milliseconds(1000);
+
+  /** The maximum delay between two retries. */
+  std::chrono::milliseconds max_backoff = std::chrono::milliseconds(5000);
+
+  /** The factor by which the maximum delay grows after each retry. */
+  float backoff_multiplier = 1.5f;
+
+  /**
+   * The time after the first attempt past which a request is not retried anymore. Only used over
+   * HTTP, the retries of gRPC happen within the export timeout.
+   */
+  std::chrono::milliseconds max_elapsed_time = std::chrono::milliseconds(30000);
+};
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,120 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/trace/span_id.h"
+#include "opentelemetry/trace/trace_id.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+class OtlpResourceCache;
+
+/**
+ * A Recordable which encodes the span directly in the protobuf wire format of
+ * opentelemetry.proto.trace.v1.Span, without building a proto message.
+ *
+ * Attributes, events and links are appended to a single buffer as they are recorded. The other
+ * fields can be set more than once, so they are kept apart and only encoded with the span.
+ */
+class OtlpWireRecordable final : public opentelemetry::sdk::trace::Recordable
+{
+public:
+  OtlpWireRecordable();
+
+  const opentelemetry::sdk::resource::Resource *GetResource() const noexcept { return resource_; }
+
+  const opentelemetry::sdk::instrumentationscope::InstrumentationScope *GetInstrumentationScope()
+      const noexcept
+  {
+    return instrumentation_scope_;
+  }
+
+  /**
+   * Get the size of the encoded span, without the tag and length of the span field.
+   */
+  std::size_t GetEncodedSize() const noexcept;
+
+  /**
+   * Encode the span at target, which must hold GetEncodedSize() bytes.
+   * @return the end of the encoded span.
+   */
+  uint8_t *Encode(uint8_t *target) const noexcept;
+
+  /**
+   * Serialize an ExportTraceServiceRequest of the given spans, which must all be
+   * OtlpWireRecordable, at the end of output. The encoded spans are copied under the resource and
+   * instrumentation scope they belong to.
+   */
+  static void SerializeRequest(
+      const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans,
+      std::vector<uint8_t> *output,
+      OtlpResourceCache *cache = nullptr) noexcept;
+
+  void SetIdentity(const opentelemetry::trace::SpanContext &span_context,
+                   opentelemetry::trace::SpanId parent_span_id) noexcept override;
+
+  void SetAttribute(opentelemetry::nostd::string_view key,
+                    const opentelemetry::common::AttributeValue &value) noexcept override;
+
+  void AddEvent(opentelemetry::nostd::string_view name,
+                opentelemetry::common::SystemTimestamp timestamp,
+                const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
+
+  void AddLink(const opentelemetry::trace::SpanContext &span_context,
+               const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
+
+  void SetStatus(opentelemetry::trace::StatusCode code,
+                 nostd::string_view description) noexcept override;
+
+  void SetName(nostd::string_view name) noexcept override;
+
+  void SetSpanKind(opentelemetry::trace::SpanKind span_kind) noexcept override;
+
+  void SetResource(const opentelemetry::sdk::resource::Resource &resource) noexcept override;
+
+  void SetStartTime(opentelemetry::common::SystemTimestamp start_time) noexcept override;
+
+  void SetDuration(std::chrono::nanoseconds duration) noexcept override;
+
+  void SetInstrumentationScope(const opentelemetry::sdk::instrumentationscope::InstrumentationScope
+                                   &instrumentation_scope) noexcept override;
+
+private:
+  bool has_identity_       = false;
+  bool has_parent_span_id_ = false;
+  bool has_status_         = false;
+  std::array<uint8_t, opentelemetry::trace::TraceId::kSize> trace_id_;
+  std::array<uint8_t, opentelemetry::trace::SpanId::kSize> span_id_;
+  std::array<uint8_t, opentelemetry::trace::SpanId::kSize> parent_span_id_;
+  std::string trace_state_;
+  std::string name_;
+  int kind_            = 0;
+  uint64_t start_time_ = 0;
+  uint64_t end_time_   = 0;
+  int status_code_     = 0;
+  std::string status_message_;
+
+  // The encoded attributes, events and links
+  std::string fields_;
+
+  const opentelemetry::sdk::resource::Resource *resource_ = nullptr;
+  const opentelemetry::sdk::instrumentationscope::InstrumentationScope *instrumentation_scope_ =
+      nullptr;
+};
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
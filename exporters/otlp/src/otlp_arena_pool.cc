@@ -0,0 +1,106 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
+
+#include <mutex>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+google::protobuf::ArenaOptions MakeArenaOptions(char *initial_block)
+{
+  google::protobuf::ArenaOptions options;
+  // The arena never frees a block it did not allocate, so this one is kept by Reset()
+  options.initial_block      = initial_block;
+  options.initial_block_size = OtlpArenaPool::kInitialBlockSize;
+  options.max_block_size     = OtlpArenaPool::kMaxBlockSize;
+  return options;
+}
+}  // namespace
+
+constexpr std::size_t OtlpArenaPool::kInitialBlockSize;
+constexpr std::size_t OtlpArenaPool::kMaxBlockSize;
+constexpr std::size_t OtlpArenaPool::kRecordablesPerArena;
+
+OtlpArenaPool::PooledArena::PooledArena()
+    : initial_block(new char[kInitialBlockSize]), arena(MakeArenaOptions(initial_block.get()))
+{}
+
+OtlpArenaPool::OtlpArenaPool(std::size_t max_idle_arenas) : max_idle_arenas_(max_idle_arenas) {}
+
+std::shared_ptr<google::protobuf::Arena> OtlpArenaPool::Acquire()
+{
+  std::unique_ptr<PooledArena> arena;
+  {
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+    if (!idle_arenas_.empty())
+    {
+      arena = std::move(idle_arenas_.back());
+      idle_arenas_.pop_back();
+    }
+  }
+  if (!arena)
+  {
+    arena.reset(new PooledArena());
+  }
+
+  // The pool is not kept alive by its arenas, as it keeps a reference to the recordable arena.
+  std::weak_ptr<OtlpArenaPool> pool       = shared_from_this();
+  google::protobuf::Arena *protobuf_arena = &arena->arena;
+  std::shared_ptr<PooledArena> owner(arena.release(), [pool](PooledArena *released) {
+    std::shared_ptr<OtlpArenaPool> self = pool.lock();
+    if (self)
+    {
+      self->Release(released);
+    }
+    else
+    {
+      delete released;
+    }
+  });
+  return std::shared_ptr<google::protobuf::Arena>(owner, protobuf_arena);
+}
+
+std::shared_ptr<google::protobuf::Arena> OtlpArenaPool::AcquireRecordableArena()
+{
+  {
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+    if (recordable_arena_uses_ < kRecordablesPerArena)
+    {
+      std::shared_ptr<google::protobuf::Arena> arena = recordable_arena_.lock();
+      if (arena)
+      {
+        ++recordable_arena_uses_;
+        return arena;
+      }
+    }
+  }
+
+  std::shared_ptr<google::protobuf::Arena> arena = Acquire();
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  recordable_arena_      = arena;
+  recordable_arena_uses_ = 1;
+  return arena;
+}
+
+void OtlpArenaPool::Release(PooledArena *arena) noexcept
+{
+  std::unique_ptr<PooledArena> owned_arena(arena);
+  owned_arena->arena.Reset();
+
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  if (idle_arenas_.size() < max_idle_arenas_)
+  {
+    idle_arenas_.push_back(std::move(owned_arena));
+  }
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,421 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_disk_queue.h"
+
+#include "opentelemetry/sdk/common/global_log_handler.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <initializer_list>
+
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+
+// Each record starts with a header of 4 little endian uint32: magic, flags, size and checksum
+constexpr uint32_t kRecordMagic         = 0x51444f4f;  // "OODQ"
+constexpr std::size_t kRecordHeaderSize = 16;
+
+constexpr char kStateFileName[]     = "queue.state";
+constexpr char kTempStateFileName[] = "queue.state.tmp";
+
+const uint32_t *GetCrc32Table() noexcept
+{
+  struct Crc32Table
+  {
+    uint32_t values[256];
+
+    Crc32Table() noexcept
+    {
+      for (uint32_t i = 0; i < 256; ++i)
+      {
+        uint32_t value = i;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+          value = (value & 1) ? (0xedb88320 ^ (value >> 1)) : (value >> 1);
+        }
+        values[i] = value;
+      }
+    }
+  };
+  static const Crc32Table table;
+  return table.values;
+}
+
+uint32_t Crc32(const uint8_t *data, std::size_t size) noexcept
+{
+  const uint32_t *table = GetCrc32Table();
+  uint32_t crc          = 0xffffffff;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc ^ 0xffffffff;
+}
+
+void EncodeUint32(uint32_t value, uint8_t *output) noexcept
+{
+  for (int i = 0; i < 4; ++i)
+  {
+    output[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint32_t DecodeUint32(const uint8_t *input) noexcept
+{
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    value |= static_cast<uint32_t>(input[i]) << (8 * i);
+  }
+  return value;
+}
+
+// Flush the buffer of the file, and wait until its content is written to the disk
+bool SyncFile(std::FILE *file) noexcept
+{
+  if (std::fflush(file) != 0)
+  {
+    return false;
+  }
+#ifdef _WIN32
+  return _commit(_fileno(file)) == 0;
+#else
+  return fsync(fileno(file)) == 0;
+#endif
+}
+
+// Make the files created, renamed or removed in the directory durable
+void SyncDirectory(const std::string &path) noexcept
+{
+#ifndef _WIN32
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd >= 0)
+  {
+    fsync(fd);
+    close(fd);
+  }
+#else
+  (void)path;
+#endif
+}
+
+std::size_t GetFileSize(const std::string &path) noexcept
+{
+  std::FILE *file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr)
+  {
+    return 0;
+  }
+  long size = -1;
+  if (std::fseek(file, 0, SEEK_END) == 0)
+  {
+    size = std::ftell(file);
+  }
+  std::fclose(file);
+  return size > 0 ? static_cast<std::size_t>(size) : 0;
+}
+
+}  // namespace
+
+OtlpDiskQueue::OtlpDiskQueue(const OtlpDiskQueueOptions &options) : options_(options)
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  if (LoadState())
+  {
+    // The last segment may end with a partially written record, so it is never appended to
+    for (uint64_t sequence = read_sequence_; sequence <= write_sequence_; ++sequence)
+    {
+      segment_sizes_.push_back(GetFileSize(GetSegmentPath(sequence)));
+      total_size_ += segment_sizes_.back();
+    }
+    ++write_sequence_;
+  }
+  OpenWriteSegment();
+}
+
+OtlpDiskQueue::~OtlpDiskQueue()
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  if (unsaved_pops_ > 0)
+  {
+    SaveState();
+  }
+  CloseReadFile();
+  if (write_file_ != nullptr)
+  {
+    std::fclose(write_file_);
+    write_file_ = nullptr;
+  }
+}
+
+bool OtlpDiskQueue::Push(uint32_t flags, const uint8_t *data, std::size_t size) noexcept
+{
+  std::size_t record_size = kRecordHeaderSize + size;
+  if (size > UINT32_MAX || record_size > options_.max_size)
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP Disk Queue] Drop a record of "
+                            << size << " bytes, larger than the queue");
+    return false;
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  std::size_t write_segment_size = segment_sizes_.back();
+  if (write_file_ == nullptr ||
+      (write_segment_size > 0 && write_segment_size + record_size > options_.max_segment_size) ||
+      (read_sequence_ == write_sequence_ && total_size_ + record_size > options_.max_size))
+  {
+    if (!RollWriteSegment())
+    {
+      return false;
+    }
+  }
+  while (total_size_ + record_size > options_.max_size && read_sequence_ < write_sequence_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[OTLP Disk Queue] The queue is full, drop the oldest records");
+    DropFirstSegment();
+  }
+
+  uint8_t header[kRecordHeaderSize];
+  EncodeUint32(kRecordMagic, header);
+  EncodeUint32(flags, header + 4);
+  EncodeUint32(static_cast<uint32_t>(size), header + 8);
+  EncodeUint32(Crc32(data, size), header + 12);
+  if (std::fwrite(header, 1, kRecordHeaderSize, write_file_) != kRecordHeaderSize ||
+      std::fwrite(data, 1, size, write_file_) != size || !SyncFile(write_file_))
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP Disk Queue] Failed to write in " << options_.directory);
+    // The record may be partially written, so the next ones go to a new segment
+    std::fclose(write_file_);
+    write_file_ = nullptr;
+    return false;
+  }
+  segment_sizes_.back() += record_size;
+  total_size_ += record_size;
+  return true;
+}
+
+bool OtlpDiskQueue::Front(Record &record) noexcept
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  return ReadFront(&record);
+}
+
+bool OtlpDiskQueue::Pop(const Position &position) noexcept
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  auto is_front = [this, &position] {
+    return position.sequence == read_sequence_ && position.offset == read_offset_;
+  };
+  // The front record is read again if its segment was closed, which may drop the segment if it
+  // is not readable anymore
+  if (!is_front() || (front_size_ == 0 && (!ReadFront(nullptr) || !is_front())))
+  {
+    return false;
+  }
+  read_offset_ += front_size_;
+  front_size_ = 0;
+
+  // Start again with empty files once every record has been read
+  if (read_sequence_ == write_sequence_ && read_offset_ >= segment_sizes_.back())
+  {
+    if (RollWriteSegment())
+    {
+      DropFirstSegment();
+      return true;
+    }
+  }
+  if (++unsaved_pops_ >= options_.state_save_batch_size)
+  {
+    SaveState();
+  }
+  return true;
+}
+
+std::size_t OtlpDiskQueue::Size() const noexcept
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  return total_size_;
+}
+
+bool OtlpDiskQueue::ReadFront(Record *record) noexcept
+{
+  while (true)
+  {
+    if (read_file_ == nullptr)
+    {
+      read_file_ = std::fopen(GetSegmentPath(read_sequence_).c_str(), "rb");
+    }
+    if (read_file_ != nullptr && ReadRecord(record))
+    {
+      return true;
+    }
+    // The end of the segment is reached, or the rest of it is not readable
+    if (read_sequence_ == write_sequence_)
+    {
+      CloseReadFile();
+      return false;
+    }
+    DropFirstSegment();
+  }
+}
+
+bool OtlpDiskQueue::ReadRecord(Record *record) noexcept
+{
+  uint8_t header[kRecordHeaderSize];
+  if (std::fseek(read_file_, static_cast<long>(read_offset_), SEEK_SET) != 0 ||
+      std::fread(header, 1, kRecordHeaderSize, read_file_) != kRecordHeaderSize ||
+      DecodeUint32(header) != kRecordMagic)
+  {
+    return false;
+  }
+  std::size_t size = DecodeUint32(header + 8);
+  if (size > options_.max_size)
+  {
+    return false;
+  }
+
+  std::vector<uint8_t> payload(size);
+  if (std::fread(payload.data(), 1, size, read_file_) != size ||
+      Crc32(payload.data(), size) != DecodeUint32(header + 12))
+  {
+    return false;
+  }
+
+  front_size_ = kRecordHeaderSize + size;
+  if (record != nullptr)
+  {
+    record->flags             = DecodeUint32(header + 4);
+    record->position.sequence = read_sequence_;
+    record->position.offset   = read_offset_;
+    record->payload.swap(payload);
+  }
+  return true;
+}
+
+bool OtlpDiskQueue::OpenWriteSegment() noexcept
+{
+  write_file_ = std::fopen(GetSegmentPath(write_sequence_).c_str(), "wb");
+  segment_sizes_.push_back(0);
+  SaveState();
+  if (write_file_ == nullptr)
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP Disk Queue] Failed to create a segment in "
+                            << options_.directory);
+    return false;
+  }
+  return true;
+}
+
+bool OtlpDiskQueue::RollWriteSegment() noexcept
+{
+  if (write_file_ != nullptr)
+  {
+    std::fclose(write_file_);
+    write_file_ = nullptr;
+  }
+  ++write_sequence_;
+  return OpenWriteSegment();
+}
+
+void OtlpDiskQueue::DropFirstSegment() noexcept
+{
+  CloseReadFile();
+  std::remove(GetSegmentPath(read_sequence_).c_str());
+  total_size_ -= segment_sizes_.front();
+  segment_sizes_.erase(segment_sizes_.begin());
+  ++read_sequence_;
+  read_offset_ = 0;
+  front_size_  = 0;
+  SaveState();
+}
+
+void OtlpDiskQueue::CloseReadFile() noexcept
+{
+  if (read_file_ != nullptr)
+  {
+    std::fclose(read_file_);
+    read_file_ = nullptr;
+  }
+}
+
+void OtlpDiskQueue::SaveState() noexcept
+{
+  std::string path      = options_.directory + "/" + kStateFileName;
+  std::string temp_path = options_.directory + "/" + kTempStateFileName;
+
+  std::FILE *file = std::fopen(temp_path.c_str(), "w");
+  if (file == nullptr)
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP Disk Queue] Failed to save the state in " << options_.directory);
+    return;
+  }
+  std::fprintf(file, "%" PRIu64 " %" PRIu64 " %" PRIu64 "\n", read_sequence_,
+               static_cast<uint64_t>(read_offset_), write_sequence_);
+  bool synced = SyncFile(file);
+  if (std::fclose(file) != 0 || !synced)
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP Disk Queue] Failed to save the state in " << options_.directory);
+    return;
+  }
+
+  // The state is replaced atomically, except where rename() does not replace an existing file
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+  {
+    std::remove(path.c_str());
+    std::rename(temp_path.c_str(), path.c_str());
+  }
+  SyncDirectory(options_.directory);
+  unsaved_pops_ = 0;
+}
+
+bool OtlpDiskQueue::LoadState() noexcept
+{
+  // The temporary state is only left if the process stopped while replacing the state
+  for (const char *file_name : {kStateFileName, kTempStateFileName})
+  {
+    std::FILE *file = std::fopen((options_.directory + "/" + file_name).c_str(), "r");
+    if (file == nullptr)
+    {
+      continue;
+    }
+    uint64_t read_sequence  = 0;
+    uint64_t read_offset    = 0;
+    uint64_t write_sequence = 0;
+    int fields = std::fscanf(file, "%" SCNu64 " %" SCNu64 " %" SCNu64, &read_sequence, &read_offset,
+                             &write_sequence);
+    std::fclose(file);
+    if (fields == 3 && read_sequence <= write_sequence)
+    {
+      read_sequence_  = read_sequence;
+      read_offset_    = static_cast<std::size_t>(read_offset);
+      write_sequence_ = write_sequence;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string OtlpDiskQueue::GetSegmentPath(uint64_t sequence) const
+{
+  char file_name[32];
+  std::snprintf(file_name, sizeof(file_name), "%016" PRIx64 ".seg", sequence);
+  return options_.directory + "/" + file_name;
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
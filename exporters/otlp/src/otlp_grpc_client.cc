@@ -9,11 +9,16 @@
 #  include <assert.h>
 #endif
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iterator>
 #include <memory>
+#include <sstream>
 #include <string>
 
+#include "opentelemetry/common/timestamp.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_utils.h"
 #include "opentelemetry/ext/http/common/url_parser.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 
@@ -46,8 +51,167 @@ static std::string GetFileContentsOrInMemoryContents(const std::string &file_pat
   return contents;
 }
 
+// Format a duration as the string expected in a gRPC service config, for example "1.5s"
+std::string FormatServiceConfigDuration(std::chrono::milliseconds duration)
+{
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%lld.%03llds",
+                static_cast<long long>(duration.count() / 1000),
+                static_cast<long long>(duration.count() % 1000));
+  return buffer;
+}
+
+// Build the service config retrying the export calls of every OTLP service, with the retryable
+// status codes of the OTLP specification. RESOURCE_EXHAUSTED is only retryable when the server
+// sends a RetryInfo, which the retries of gRPC do not look at, so it is not retried. Retries are
+// throttled while most calls of the channel fail, so that an overloaded collector is not flooded.
+std::string MakeRetryServiceConfig(const OtlpRetryPolicy &policy)
+{
+  std::ostringstream config;
+  config << R"({"retryThrottling": {"maxTokens": 10, "tokenRatio": 0.1}, )"
+         << R"("methodConfig": [{"name": [)"
+         << R"({"service": "opentelemetry.proto.collector.trace.v1.TraceService"}, )"
+         << R"({"service": "opentelemetry.proto.collector.metrics.v1.MetricsService"}, )"
+         << R"({"service": "opentelemetry.proto.collector.logs.v1.LogsService"}], )"
+         << R"("retryPolicy": {"maxAttempts": )" << policy.max_attempts
+         << R"(, "initialBackoff": ")" << FormatServiceConfigDuration(policy.initial_backoff)
+         << R"(", "maxBackoff": ")" << FormatServiceConfigDuration(policy.max_backoff)
+         << R"(", "backoffMultiplier": )" << policy.backoff_multiplier
+         << R"(, "retryableStatusCodes": ["CANCELLED", "ABORTED", "OUT_OF_RANGE", )"
+         << R"("UNAVAILABLE", "DATA_LOSS"]}}]})";
+  return config.str();
+}
+
+#ifdef ENABLE_ASYNC_EXPORT
+
+// How long the destructor of the client waits for the in-flight requests.
+constexpr std::chrono::seconds kDestructorFlushTimeout{5};
+
+// The data of an in-flight request, kept alive until the request completes.
+template <class RequestType, class ResponseType>
+struct AsyncRequest
+{
+  OtlpGrpcClient::AsyncData *async_data;
+  std::unique_ptr<grpc::ClientContext> context;
+  std::shared_ptr<RequestType> request;
+  ResponseType response;
+  OtlpGrpcClient::ResultCallback result_callback;
+};
+
+// Waits until a new request can be sent, returns false if the client is shut down. The stub is
+// kept alive with the shared state.
+static bool AcquireRequestSlot(OtlpGrpcClient::AsyncData &async_data,
+                               const std::shared_ptr<void> &stub)
+{
+  std::unique_lock<std::mutex> lock(async_data.requests_lock);
+  async_data.requests_cv.wait(lock, [&async_data]() {
+    return async_data.is_shutdown.load(std::memory_order_acquire) ||
+           async_data.max_concurrent_requests == 0 ||
+           async_data.running_requests.load(std::memory_order_acquire) <
+               async_data.max_concurrent_requests;
+  });
+  if (async_data.is_shutdown.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  if (std::find(async_data.stubs.begin(), async_data.stubs.end(), stub) == async_data.stubs.end())
+  {
+    async_data.stubs.push_back(stub);
+  }
+  async_data.running_requests.fetch_add(1, std::memory_order_release);
+  return true;
+}
+
+// Notifies under the lock, since the client may be destroyed as soon as it is released.
+static void ReleaseRequestSlot(OtlpGrpcClient::AsyncData &async_data)
+{
+  std::lock_guard<std::mutex> lock(async_data.requests_lock);
+  async_data.running_requests.fetch_sub(1, std::memory_order_release);
+  async_data.requests_cv.notify_all();
+}
+
+static opentelemetry::sdk::common::ExportResult GetExportResult(const grpc::Status &status)
+{
+  if (!status.ok())
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP GRPC Client] Export() failed with status_code: \""
+                            << grpc_utils::grpc_status_code_to_string(status.error_code())
+                            << "\" error_message: \"" << status.error_message() << "\"");
+    return opentelemetry::sdk::common::ExportResult::kFailure;
+  }
+  return opentelemetry::sdk::common::ExportResult::kSuccess;
+}
+
+template <class StubType, class RequestType, class ResponseType>
+static opentelemetry::sdk::common::ExportResult InternalDelegateAsyncExport(
+    OtlpGrpcClient::AsyncData &async_data,
+    const std::shared_ptr<StubType> &stub,
+    std::unique_ptr<grpc::ClientContext> &&context,
+    std::shared_ptr<RequestType> &&request,
+    OtlpGrpcClient::ResultCallback &&result_callback) noexcept
+{
+  if (!AcquireRequestSlot(async_data, stub))
+  {
+    OTEL_INTERNAL_LOG_ERROR("[OTLP GRPC Client] Export() failed, the client is shutdown");
+    result_callback(opentelemetry::sdk::common::ExportResult::kFailure);
+    return opentelemetry::sdk::common::ExportResult::kFailure;
+  }
+
+  auto async_stub = stub->async();
+  if (async_stub == nullptr)
+  {
+    ResponseType response;
+    auto result = GetExportResult(stub->Export(context.get(), *request, &response));
+    result_callback(result);
+    ReleaseRequestSlot(async_data);
+    return result;
+  }
+
+  std::shared_ptr<AsyncRequest<RequestType, ResponseType>> async_request(
+      new AsyncRequest<RequestType, ResponseType>{&async_data, std::move(context),
+                                                  std::move(request), ResponseType(),
+                                                  std::move(result_callback)});
+  async_stub->Export(
+      async_request->context.get(), async_request->request.get(), &async_request->response,
+      [async_request](grpc::Status status) mutable {
+        async_request->result_callback(GetExportResult(status));
+
+        // The slot is released last, so that ForceFlush() also waits for the callback. The client
+        // may then destroy the stubs and their channel, so the request and the call held by its
+        // context must be released before. gRPC does not support destroying the channel from one
+        // of its callbacks either, so the request does not own the stub.
+        OtlpGrpcClient::AsyncData *async_data = async_request->async_data;
+        async_request.reset();
+        ReleaseRequestSlot(*async_data);
+      });
+  return opentelemetry::sdk::common::ExportResult::kSuccess;
+}
+
+#endif
+
 }  // namespace
 
+#ifdef ENABLE_ASYNC_EXPORT
+
+OtlpGrpcClient::OtlpGrpcClient(const OtlpGrpcClientOptions &options)
+    : async_data_(new AsyncData())
+{
+  async_data_->max_concurrent_requests = options.max_concurrent_requests;
+}
+
+OtlpGrpcClient::~OtlpGrpcClient()
+{
+  if (!Shutdown(kDestructorFlushTimeout))
+  {
+    // The requests still in flight use the shared state and the stubs it keeps alive, which are
+    // leaked rather than destroyed before the requests complete.
+    OTEL_INTERNAL_LOG_WARN("[OTLP GRPC Client] Requests still in flight at destruction.");
+    static_cast<void>(async_data_.release());
+  }
+}
+
+#endif
+
 std::shared_ptr<grpc::Channel> OtlpGrpcClient::MakeChannel(const OtlpGrpcClientOptions &options)
 {
   std::shared_ptr<grpc::Channel> channel;
@@ -70,6 +234,21 @@ std::shared_ptr<grpc::Channel> OtlpGrpcClient::MakeChannel(const OtlpGrpcClientO
   grpc::ChannelArguments grpc_arguments;
   grpc_arguments.SetUserAgentPrefix(options.user_agent);
 
+  if (options.compression == "gzip")
+  {
+    grpc_arguments.SetCompressionAlgorithm(GRPC_COMPRESS_GZIP);
+  }
+  else if (!options.compression.empty() && options.compression != "none")
+  {
+    OTEL_INTERNAL_LOG_WARN("[OTLP GRPC Client] unsupported compression: " << options.compression);
+  }
+
+  if (options.retry_policy.max_attempts > 1)
+  {
+    // gRPC keeps the serialized request and sends it again, within the deadline of the call
+    grpc_arguments.SetServiceConfigJSON(MakeRetryServiceConfig(options.retry_policy));
+  }
+
   if (options.use_ssl_credentials)
   {
     grpc::SslCredentialsOptions ssl_opts;
@@ -165,6 +344,74 @@ grpc::Status OtlpGrpcClient::DelegateExport(
   return stub->Export(context, request, response);
 }
 
+#ifdef ENABLE_ASYNC_EXPORT
+
+opentelemetry::sdk::common::ExportResult OtlpGrpcClient::DelegateAsyncExport(
+    const std::shared_ptr<proto::collector::trace::v1::TraceService::StubInterface> &stub,
+    std::unique_ptr<grpc::ClientContext> &&context,
+    std::shared_ptr<proto::collector::trace::v1::ExportTraceServiceRequest> &&request,
+    ResultCallback &&result_callback) noexcept
+{
+  return InternalDelegateAsyncExport<proto::collector::trace::v1::TraceService::StubInterface,
+                                     proto::collector::trace::v1::ExportTraceServiceRequest,
+                                     proto::collector::trace::v1::ExportTraceServiceResponse>(
+      *async_data_, stub, std::move(context), std::move(request), std::move(result_callback));
+}
+
+opentelemetry::sdk::common::ExportResult OtlpGrpcClient::DelegateAsyncExport(
+    const std::shared_ptr<proto::collector::metrics::v1::MetricsService::StubInterface> &stub,
+    std::unique_ptr<grpc::ClientContext> &&context,
+    std::shared_ptr<proto::collector::metrics::v1::ExportMetricsServiceRequest> &&request,
+    ResultCallback &&result_callback) noexcept
+{
+  return InternalDelegateAsyncExport<proto::collector::metrics::v1::MetricsService::StubInterface,
+                                     proto::collector::metrics::v1::ExportMetricsServiceRequest,
+                                     proto::collector::metrics::v1::ExportMetricsServiceResponse>(
+      *async_data_, stub, std::move(context), std::move(request), std::move(result_callback));
+}
+
+opentelemetry::sdk::common::ExportResult OtlpGrpcClient::DelegateAsyncExport(
+    const std::shared_ptr<proto::collector::logs::v1::LogsService::StubInterface> &stub,
+    std::unique_ptr<grpc::ClientContext> &&context,
+    std::shared_ptr<proto::collector::logs::v1::ExportLogsServiceRequest> &&request,
+    ResultCallback &&result_callback) noexcept
+{
+  return InternalDelegateAsyncExport<proto::collector::logs::v1::LogsService::StubInterface,
+                                     proto::collector::logs::v1::ExportLogsServiceRequest,
+                                     proto::collector::logs::v1::ExportLogsServiceResponse>(
+      *async_data_, stub, std::move(context), std::move(request), std::move(result_callback));
+}
+
+bool OtlpGrpcClient::ForceFlush(std::chrono::microseconds timeout) noexcept
+{
+  std::unique_lock<std::mutex> lock(async_data_->requests_lock);
+  auto is_idle = [this]() {
+    return async_data_->running_requests.load(std::memory_order_acquire) == 0;
+  };
+
+  timeout = opentelemetry::common::DurationUtil::AdjustWaitForTimeout(
+      timeout, std::chrono::microseconds::zero());
+  if (timeout <= std::chrono::microseconds::zero())
+  {
+    async_data_->requests_cv.wait(lock, is_idle);
+    return true;
+  }
+  return async_data_->requests_cv.wait_for(lock, timeout, is_idle);
+}
+
+bool OtlpGrpcClient::Shutdown(std::chrono::microseconds timeout) noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock(async_data_->requests_lock);
+    async_data_->is_shutdown.store(true, std::memory_order_release);
+  }
+  // Wake up the exports waiting for a slot, which fail now.
+  async_data_->requests_cv.notify_all();
+  return ForceFlush(timeout);
+}
+
+#endif
+
 }  // namespace otlp
 }  // namespace exporter
 OPENTELEMETRY_END_NAMESPACE
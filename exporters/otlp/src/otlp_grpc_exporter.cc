@@ -24,18 +24,27 @@ OtlpGrpcExporter::OtlpGrpcExporter() : OtlpGrpcExporter(OtlpGrpcExporterOptions(
 
 OtlpGrpcExporter::OtlpGrpcExporter(const OtlpGrpcExporterOptions &options)
     : options_(options), trace_service_stub_(OtlpGrpcClient::MakeTraceServiceStub(options))
-{}
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  client_ = std::make_shared<OtlpGrpcClient>(options_);
+#endif
+}
 
 OtlpGrpcExporter::OtlpGrpcExporter(
     std::unique_ptr<proto::collector::trace::v1::TraceService::StubInterface> stub)
     : options_(OtlpGrpcExporterOptions()), trace_service_stub_(std::move(stub))
-{}
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  client_ = std::make_shared<OtlpGrpcClient>(options_);
+#endif
+}
 
 // ----------------------------- Exporter methods ------------------------------
 
 std::unique_ptr<sdk::trace::Recordable> OtlpGrpcExporter::MakeRecordable() noexcept
 {
-  return std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+  return std::unique_ptr<sdk::trace::Recordable>(
+      new OtlpRecordable(arena_pool_->AcquireRecordableArena()));
 }
 
 sdk::common::ExportResult OtlpGrpcExporter::Export(
@@ -52,14 +61,29 @@ sdk::common::ExportResult OtlpGrpcExporter::Export(
     return sdk::common::ExportResult::kSuccess;
   }
 
-  proto::collector::trace::v1::ExportTraceServiceRequest request;
-  OtlpRecordableUtils::PopulateRequest(spans, &request);
-
+  auto request = arena_pool_->CreateMessage<proto::collector::trace::v1::ExportTraceServiceRequest>(
+      OtlpRecordableUtils::GetArena(spans));
+  OtlpRecordableUtils::PopulateRequest(spans, request.get(), &resource_cache_);
+
+#ifdef ENABLE_ASYNC_EXPORT
+  std::size_t span_count = spans.size();
+  return client_->DelegateAsyncExport(
+      trace_service_stub_, OtlpGrpcClient::MakeClientContext(options_), std::move(request),
+      [span_count](sdk::common::ExportResult result) {
+        if (result != sdk::common::ExportResult::kSuccess)
+        {
+          OTEL_INTERNAL_LOG_ERROR("[OTLP TRACE GRPC Exporter] ERROR: Export "
+                                  << span_count << " trace span(s) error: "
+                                  << static_cast<int>(result));
+        }
+        return true;
+      });
+#else
   auto context = OtlpGrpcClient::MakeClientContext(options_);
   proto::collector::trace::v1::ExportTraceServiceResponse response;
 
   grpc::Status status =
-      OtlpGrpcClient::DelegateExport(trace_service_stub_.get(), context.get(), request, &response);
+      OtlpGrpcClient::DelegateExport(trace_service_stub_.get(), context.get(), *request, &response);
 
   if (!status.ok())
   {
@@ -69,20 +93,31 @@ sdk::common::ExportResult OtlpGrpcExporter::Export(
     return sdk::common::ExportResult::kFailure;
   }
   return sdk::common::ExportResult::kSuccess;
+#endif
 }
 
-bool OtlpGrpcExporter::ForceFlush(std::chrono::microseconds /* timeout */) noexcept
+bool OtlpGrpcExporter::ForceFlush(
+    std::chrono::microseconds timeout OPENTELEMETRY_MAYBE_UNUSED) noexcept
 {
-  // TODO: When we implement async exporting in OTLP gRPC exporter in the future, we need wait the
-  //       running exporting finished here.
+#ifdef ENABLE_ASYNC_EXPORT
+  return client_->ForceFlush(timeout);
+#else
   return true;
+#endif
 }
 
-bool OtlpGrpcExporter::Shutdown(std::chrono::microseconds /* timeout */) noexcept
+bool OtlpGrpcExporter::Shutdown(
+    std::chrono::microseconds timeout OPENTELEMETRY_MAYBE_UNUSED) noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  is_shutdown_ = true;
+  {
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+    is_shutdown_ = true;
+  }
+#ifdef ENABLE_ASYNC_EXPORT
+  return client_->Shutdown(timeout);
+#else
   return true;
+#endif
 }
 
 bool OtlpGrpcExporter::isShutdown() const noexcept
@@ -26,9 +26,14 @@ OtlpGrpcExporterOptions::OtlpGrpcExporterOptions()
   ssl_client_cert_string = GetOtlpDefaultTracesSslClientCertificateString();
 #endif
 
-  timeout    = GetOtlpDefaultTracesTimeout();
-  metadata   = GetOtlpDefaultTracesHeaders();
-  user_agent = GetOtlpDefaultUserAgent();
+  timeout     = GetOtlpDefaultTracesTimeout();
+  metadata    = GetOtlpDefaultTracesHeaders();
+  user_agent  = GetOtlpDefaultUserAgent();
+  compression = GetOtlpDefaultTracesCompression();
+
+#ifdef ENABLE_ASYNC_EXPORT
+  max_concurrent_requests = 64;
+#endif
 }
 
 OtlpGrpcExporterOptions::~OtlpGrpcExporterOptions() {}
@@ -36,19 +36,28 @@ OtlpGrpcLogRecordExporter::OtlpGrpcLogRecordExporter()
 OtlpGrpcLogRecordExporter::OtlpGrpcLogRecordExporter(
     const OtlpGrpcLogRecordExporterOptions &options)
     : options_(options), log_service_stub_(OtlpGrpcClient::MakeLogsServiceStub(options))
-{}
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  client_ = std::make_shared<OtlpGrpcClient>(options_);
+#endif
+}
 
 OtlpGrpcLogRecordExporter::OtlpGrpcLogRecordExporter(
     std::unique_ptr<proto::collector::logs::v1::LogsService::StubInterface> stub)
     : options_(OtlpGrpcLogRecordExporterOptions()), log_service_stub_(std::move(stub))
-{}
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  client_ = std::make_shared<OtlpGrpcClient>(options_);
+#endif
+}
 
 // ----------------------------- Exporter methods ------------------------------
 
 std::unique_ptr<opentelemetry::sdk::logs::Recordable>
 OtlpGrpcLogRecordExporter::MakeRecordable() noexcept
 {
-  return std::unique_ptr<opentelemetry::sdk::logs::Recordable>(new OtlpLogRecordable());
+  return std::unique_ptr<opentelemetry::sdk::logs::Recordable>(
+      new OtlpLogRecordable(arena_pool_->AcquireRecordableArena()));
 }
 
 opentelemetry::sdk::common::ExportResult OtlpGrpcLogRecordExporter::Export(
@@ -65,14 +74,28 @@ opentelemetry::sdk::common::ExportResult OtlpGrpcLogRecordExporter::Export(
     return sdk::common::ExportResult::kSuccess;
   }
 
-  proto::collector::logs::v1::ExportLogsServiceRequest request;
-  OtlpRecordableUtils::PopulateRequest(logs, &request);
-
+  auto request = arena_pool_->CreateMessage<proto::collector::logs::v1::ExportLogsServiceRequest>(
+      OtlpRecordableUtils::GetArena(logs));
+  OtlpRecordableUtils::PopulateRequest(logs, request.get(), &resource_cache_);
+
+#ifdef ENABLE_ASYNC_EXPORT
+  std::size_t log_count = logs.size();
+  return client_->DelegateAsyncExport(
+      log_service_stub_, OtlpGrpcClient::MakeClientContext(options_), std::move(request),
+      [log_count](sdk::common::ExportResult result) {
+        if (result != sdk::common::ExportResult::kSuccess)
+        {
+          OTEL_INTERNAL_LOG_ERROR("[OTLP LOG GRPC Exporter] ERROR: Export "
+                                  << log_count << " log(s) error: " << static_cast<int>(result));
+        }
+        return true;
+      });
+#else
   auto context = OtlpGrpcClient::MakeClientContext(options_);
   proto::collector::logs::v1::ExportLogsServiceResponse response;
 
   grpc::Status status =
-      OtlpGrpcClient::DelegateExport(log_service_stub_.get(), context.get(), request, &response);
+      OtlpGrpcClient::DelegateExport(log_service_stub_.get(), context.get(), *request, &response);
 
   if (!status.ok())
   {
@@ -80,20 +103,31 @@ opentelemetry::sdk::common::ExportResult OtlpGrpcLogRecordExporter::Export(
     return sdk::common::ExportResult::kFailure;
   }
   return sdk::common::ExportResult::kSuccess;
+#endif
 }
 
-bool OtlpGrpcLogRecordExporter::Shutdown(std::chrono::microseconds /* timeout */) noexcept
+bool OtlpGrpcLogRecordExporter::Shutdown(
+    std::chrono::microseconds timeout OPENTELEMETRY_MAYBE_UNUSED) noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  is_shutdown_ = true;
+  {
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+    is_shutdown_ = true;
+  }
+#ifdef ENABLE_ASYNC_EXPORT
+  return client_->Shutdown(timeout);
+#else
   return true;
+#endif
 }
 
-bool OtlpGrpcLogRecordExporter::ForceFlush(std::chrono::microseconds /* timeout */) noexcept
+bool OtlpGrpcLogRecordExporter::ForceFlush(
+    std::chrono::microseconds timeout OPENTELEMETRY_MAYBE_UNUSED) noexcept
 {
-  // TODO: When we implement async exporting in OTLP gRPC exporter in the future, we need wait the
-  //       running exporting finished here.
+#ifdef ENABLE_ASYNC_EXPORT
+  return client_->ForceFlush(timeout);
+#else
   return true;
+#endif
 }
 
 bool OtlpGrpcLogRecordExporter::isShutdown() const noexcept
@@ -24,9 +24,14 @@ OtlpGrpcLogRecordExporterOptions::OtlpGrpcLogRecordExporterOptions()
   ssl_client_cert_string = GetOtlpDefaultLogsSslClientCertificateString();
 #endif
 
-  timeout    = GetOtlpDefaultLogsTimeout();
-  metadata   = GetOtlpDefaultLogsHeaders();
-  user_agent = GetOtlpDefaultUserAgent();
+  timeout     = GetOtlpDefaultLogsTimeout();
+  metadata    = GetOtlpDefaultLogsHeaders();
+  user_agent  = GetOtlpDefaultUserAgent();
+  compression = GetOtlpDefaultLogsCompression();
+
+#ifdef ENABLE_ASYNC_EXPORT
+  max_concurrent_requests = 64;
+#endif
 }
 
 OtlpGrpcLogRecordExporterOptions::~OtlpGrpcLogRecordExporterOptions() {}
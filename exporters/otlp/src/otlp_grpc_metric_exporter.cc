@@ -26,7 +26,11 @@ OtlpGrpcMetricExporter::OtlpGrpcMetricExporter(const OtlpGrpcMetricExporterOptio
       aggregation_temporality_selector_{
           OtlpMetricUtils::ChooseTemporalitySelector(options_.aggregation_temporality)},
       metrics_service_stub_(OtlpGrpcClient::MakeMetricsServiceStub(options))
-{}
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  client_ = std::make_shared<OtlpGrpcClient>(options_);
+#endif
+}
 
 OtlpGrpcMetricExporter::OtlpGrpcMetricExporter(
     std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface> stub)
@@ -34,7 +38,11 @@ OtlpGrpcMetricExporter::OtlpGrpcMetricExporter(
       aggregation_temporality_selector_{
           OtlpMetricUtils::ChooseTemporalitySelector(options_.aggregation_temporality)},
       metrics_service_stub_(std::move(stub))
-{}
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  client_ = std::make_shared<OtlpGrpcClient>(options_);
+#endif
+}
 
 // ----------------------------- Exporter methods ------------------------------
 
@@ -60,14 +68,29 @@ opentelemetry::sdk::common::ExportResult OtlpGrpcMetricExporter::Export(
     return sdk::common::ExportResult::kSuccess;
   }
 
-  proto::collector::metrics::v1::ExportMetricsServiceRequest request;
-  OtlpMetricUtils::PopulateRequest(data, &request);
-
+  auto request =
+      arena_pool_->CreateMessage<proto::collector::metrics::v1::ExportMetricsServiceRequest>();
+  OtlpMetricUtils::PopulateRequest(data, request.get(), &resource_cache_);
+
+#ifdef ENABLE_ASYNC_EXPORT
+  std::size_t metric_count = data.scope_metric_data_.size();
+  return client_->DelegateAsyncExport(
+      metrics_service_stub_, OtlpGrpcClient::MakeClientContext(options_), std::move(request),
+      [metric_count](sdk::common::ExportResult result) {
+        if (result != sdk::common::ExportResult::kSuccess)
+        {
+          OTEL_INTERNAL_LOG_ERROR("[OTLP METRIC GRPC Exporter] ERROR: Export "
+                                  << metric_count << " metric(s) error: "
+                                  << static_cast<int>(result));
+        }
+        return true;
+      });
+#else
   auto context = OtlpGrpcClient::MakeClientContext(options_);
   proto::collector::metrics::v1::ExportMetricsServiceResponse response;
 
   grpc::Status status = OtlpGrpcClient::DelegateExport(metrics_service_stub_.get(), context.get(),
-                                                       request, &response);
+                                                       *request, &response);
 
   if (!status.ok())
   {
@@ -76,19 +99,31 @@ opentelemetry::sdk::common::ExportResult OtlpGrpcMetricExporter::Export(
     return sdk::common::ExportResult::kFailure;
   }
   return opentelemetry::sdk::common::ExportResult::kSuccess;
+#endif
 }
 
-bool OtlpGrpcMetricExporter::ForceFlush(std::chrono::microseconds /* timeout */) noexcept
+bool OtlpGrpcMetricExporter::ForceFlush(
+    std::chrono::microseconds timeout OPENTELEMETRY_MAYBE_UNUSED) noexcept
 {
-  // TODO: OTLP gRPC exporter does not support concurrency exporting now.
+#ifdef ENABLE_ASYNC_EXPORT
+  return client_->ForceFlush(timeout);
+#else
   return true;
+#endif
 }
 
-bool OtlpGrpcMetricExporter::Shutdown(std::chrono::microseconds /* timeout */) noexcept
+bool OtlpGrpcMetricExporter::Shutdown(
+    std::chrono::microseconds timeout OPENTELEMETRY_MAYBE_UNUSED) noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  is_shutdown_ = true;
+  {
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+    is_shutdown_ = true;
+  }
+#ifdef ENABLE_ASYNC_EXPORT
+  return client_->Shutdown(timeout);
+#else
   return true;
+#endif
 }
 
 bool OtlpGrpcMetricExporter::isShutdown() const noexcept
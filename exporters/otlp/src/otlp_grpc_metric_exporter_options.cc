@@ -24,9 +24,14 @@ OtlpGrpcMetricExporterOptions::OtlpGrpcMetricExporterOptions()
   ssl_client_cert_string = GetOtlpDefaultMetricsSslClientCertificateString();
 #endif
 
-  timeout    = GetOtlpDefaultMetricsTimeout();
-  metadata   = GetOtlpDefaultMetricsHeaders();
-  user_agent = GetOtlpDefaultUserAgent();
+  timeout     = GetOtlpDefaultMetricsTimeout();
+  metadata    = GetOtlpDefaultMetricsHeaders();
+  user_agent  = GetOtlpDefaultUserAgent();
+  compression = GetOtlpDefaultMetricsCompression();
+
+#ifdef ENABLE_ASYNC_EXPORT
+  max_concurrent_requests = 64;
+#endif
 
   aggregation_temporality = PreferredAggregationTemporality::kCumulative;
 }
@@ -3,35 +3,39 @@
 
 #include "opentelemetry/exporters/otlp/otlp_http_client.h"
 
-#if defined(HAVE_GSL)
-#  include <gsl/gsl>
-#else
-#  include <assert.h>
-#endif
-
+#include "opentelemetry/exporters/otlp/otlp_json_writer.h"
 #include "opentelemetry/ext/http/client/http_client_factory.h"
 #include "opentelemetry/ext/http/common/url_parser.h"
 
 #include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
 #include "google/protobuf/message.h"
-#include "google/protobuf/reflection.h"
 #include "google/protobuf/stubs/common.h"
-#include "nlohmann/json.hpp"
+
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+#  include "google/protobuf/io/coded_stream.h"
+#  include "google/protobuf/io/gzip_stream.h"
+#  include "google/protobuf/io/zero_copy_stream.h"
+#endif
 
 #include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
 
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/string_view.h"
-#include "opentelemetry/sdk/common/base64.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk_config.h"
 
+#include <algorithm>
 #include <atomic>
+#include <cctype>
+#include <cmath>
 #include <condition_variable>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <mutex>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -52,6 +56,93 @@ namespace otlp
 namespace
 {
 
+// The flags of the requests in the disk queue
+constexpr uint32_t kDiskQueueJsonFlag = 1;
+constexpr uint32_t kDiskQueueGzipFlag = 2;
+
+/**
+ * Whether a request which failed with this HTTP status code may succeed if it is sent again.
+ */
+bool IsRetryableStatusCode(http_client::StatusCode status_code) noexcept
+{
+  return status_code == 429 || status_code == 502 || status_code == 503 || status_code == 504;
+}
+
+/**
+ * Parse the value of a Retry-After header, which is either a number of seconds or an HTTP date.
+ * @param max_delay the delay returned instead of any longer one. The delay is compared in seconds,
+ * before its conversion to the clock resolution can overflow.
+ * @return the delay requested by the server, or zero if the value is invalid
+ */
+std::chrono::system_clock::duration ParseRetryAfter(nostd::string_view value,
+                                                    std::chrono::milliseconds max_delay) noexcept
+{
+  auto clamp = [max_delay](int64_t delay_seconds) {
+    if (delay_seconds > std::chrono::duration_cast<std::chrono::seconds>(max_delay).count())
+    {
+      return std::chrono::duration_cast<std::chrono::system_clock::duration>(max_delay);
+    }
+    return std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::seconds((std::max)(delay_seconds, int64_t{0})));
+  };
+
+  std::string trimmed(value.data(), value.size());
+  trimmed.erase(0, trimmed.find_first_not_of(" \t"));
+  trimmed.erase(trimmed.find_last_not_of(" \t\r\n") + 1);
+  if (trimmed.empty())
+  {
+    return std::chrono::system_clock::duration::zero();
+  }
+
+  if (std::all_of(trimmed.begin(), trimmed.end(),
+                  [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }))
+  {
+    // Values beyond the range of long long saturate to LLONG_MAX
+    return clamp(std::strtoll(trimmed.c_str(), nullptr, 10));
+  }
+
+  // The preferred format of HTTP dates, for example "Sun, 06 Nov 1994 08:49:37 GMT"
+  int day = 0, year = 0, hour = 0, minute = 0, second = 0;
+  char month_name[4] = {0};
+  if (std::sscanf(trimmed.c_str(), "%*3s, %2d %3s %4d %2d:%2d:%2d GMT", &day, month_name, &year,
+                  &hour, &minute, &second) != 6)
+  {
+    return std::chrono::system_clock::duration::zero();
+  }
+  static const char *const kMonthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                            "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  int month = 0;
+  while (month < 12 && std::strcmp(kMonthNames[month], month_name) != 0)
+  {
+    ++month;
+  }
+  if (month == 12)
+  {
+    return std::chrono::system_clock::duration::zero();
+  }
+
+  // Days since 1970-01-01 of the date in the proleptic Gregorian calendar
+  int y                = month < 2 ? year - 1 : year;
+  int era              = (y >= 0 ? y : y - 399) / 400;
+  int year_of_era      = y - era * 400;
+  int day_of_year      = (153 * (month < 2 ? month + 10 : month - 2) + 2) / 5 + day - 1;
+  int day_of_era       = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  int64_t days         = static_cast<int64_t>(era) * 146097 + day_of_era - 719468;
+  int64_t epoch_second = days * 86400 + hour * 3600 + minute * 60 + second;
+
+  auto now = std::chrono::system_clock::now();
+  int64_t delay_seconds =
+      epoch_second -
+      std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+  if (delay_seconds <= 0 ||
+      delay_seconds > std::chrono::duration_cast<std::chrono::seconds>(max_delay).count())
+  {
+    return clamp(delay_seconds);
+  }
+  auto delay = std::chrono::system_clock::time_point(std::chrono::seconds(epoch_second)) - now;
+  return (std::max)(delay, std::chrono::system_clock::duration::zero());
+}
+
 /**
  * This class handles the response message from the HTTP request
  */
@@ -61,9 +152,15 @@ class ResponseHandler : public http_client::EventHandler
   /**
    * Creates a response handler, that by default doesn't display to console
    */
-  ResponseHandler(std::function<bool(opentelemetry::sdk::common::ExportResult)> &&callback,
-                  bool console_debug = false)
-      : result_callback_{std::move(callback)}, console_debug_{console_debug}
+  ResponseHandler(
+      std::function<bool(opentelemetry::sdk::common::ExportResult)> &&callback,
+      bool console_debug                                                   = false,
+      OtlpHttpClient::RetryableFailureCallback &&retryable_failure_callback = nullptr,
+      std::chrono::milliseconds max_retry_after                             = {})
+      : result_callback_{std::move(callback)},
+        retryable_failure_callback_{std::move(retryable_failure_callback)},
+        max_retry_after_{max_retry_after},
+        console_debug_{console_debug}
   {}
 
   std::string BuildResponseLogMessage(http_client::Response &response,
@@ -87,7 +184,9 @@ class ResponseHandler : public http_client::EventHandler
    */
   void OnResponse(http_client::Response &response) noexcept override
   {
-    sdk::common::ExportResult result = sdk::common::ExportResult::kSuccess;
+    sdk::common::ExportResult result                = sdk::common::ExportResult::kSuccess;
+    bool retryable                                  = false;
+    std::chrono::system_clock::duration retry_after = std::chrono::system_clock::duration::zero();
     std::string log_message;
     // Lock the private members so they can't be read while being modified
     {
@@ -101,7 +200,17 @@ class ResponseHandler : public http_client::EventHandler
         log_message = BuildResponseLogMessage(response, body_);
 
         OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] Export failed, " << log_message);
-        result = sdk::common::ExportResult::kFailure;
+        result    = sdk::common::ExportResult::kFailure;
+        retryable = IsRetryableStatusCode(response.GetStatusCode());
+        if (retryable)
+        {
+          response.ForEachHeader("Retry-After",
+                                 [this, &retry_after](nostd::string_view,
+                                                      nostd::string_view value) {
+                                   retry_after = ParseRetryAfter(value, max_retry_after_);
+                                   return false;
+                                 });
+        }
       }
       else if (console_debug_)
       {
@@ -117,7 +226,7 @@ class ResponseHandler : public http_client::EventHandler
       bool expected = false;
       if (stopping_.compare_exchange_strong(expected, true, std::memory_order_release))
       {
-        Unbind(result);
+        Unbind(result, retryable, retry_after);
       }
     }
   }
@@ -138,14 +247,20 @@ class ResponseHandler : public http_client::EventHandler
   {
     // need to modify stopping_ under lock before calling callback
     bool need_stop = false;
+    bool retryable = false;
     switch (state)
     {
-      case http_client::SessionState::CreateFailed:
       case http_client::SessionState::ConnectFailed:
       case http_client::SessionState::SendFailed:
-      case http_client::SessionState::SSLHandshakeFailed:
       case http_client::SessionState::TimedOut:
-      case http_client::SessionState::NetworkError:
+      case http_client::SessionState::NetworkError: {
+        need_stop = true;
+        retryable = true;
+      }
+      break;
+
+      case http_client::SessionState::CreateFailed:
+      case http_client::SessionState::SSLHandshakeFailed:
       case http_client::SessionState::Cancelled: {
         need_stop = true;
       }
@@ -300,12 +415,15 @@ class ResponseHandler : public http_client::EventHandler
       bool expected = false;
       if (stopping_.compare_exchange_strong(expected, true, std::memory_order_release))
       {
-        Unbind(sdk::common::ExportResult::kFailure);
+        Unbind(sdk::common::ExportResult::kFailure, retryable,
+               std::chrono::system_clock::duration::zero());
       }
     }
   }
 
-  void Unbind(sdk::common::ExportResult result)
+  void Unbind(sdk::common::ExportResult result,
+              bool retryable,
+              std::chrono::system_clock::duration retry_after)
   {
     // ReleaseSession may destroy this object, so we need to move owner and session into stack
     // first.
@@ -317,10 +435,15 @@ class ResponseHandler : public http_client::EventHandler
 
     if (nullptr != owner && nullptr != session)
     {
+      // The request may be sent again, and then its result is reported later. This is decided
+      // before the session is released, so that the request is never seen as finished meanwhile.
+      bool taken_over = retryable && retryable_failure_callback_ &&
+                        retryable_failure_callback_(retry_after, result_callback_);
+
       // Release the session at last
       owner->ReleaseSession(*session);
 
-      if (result_callback_)
+      if (!taken_over && result_callback_)
       {
         result_callback_(result);
       }
@@ -351,298 +474,99 @@ class ResponseHandler : public http_client::EventHandler
   // Result callback when in async mode
   std::function<bool(opentelemetry::sdk::common::ExportResult)> result_callback_;
 
+  // Callback when the request failed because the collector is unreachable or throttling
+  OtlpHttpClient::RetryableFailureCallback retryable_failure_callback_;
+
+  // The longest delay requested by the server which is honored as is
+  std::chrono::milliseconds max_retry_after_;
+
   // Whether to print the results from the callback
   bool console_debug_ = false;
 };
 
-static inline char HexEncode(unsigned char byte)
+bool SerializeToHttpBody(http_client::Body &output, const google::protobuf::Message &message)
 {
-#if defined(HAVE_GSL)
-  Expects(byte <= 16);
-#else
-  assert(byte <= 16);
-#endif
-  if (byte >= 10)
-  {
-    return byte - 10 + 'a';
-  }
-  else
+  auto body_size = message.ByteSizeLong();
+  if (body_size > 0)
   {
-    return byte + '0';
+    output.resize(body_size);
+    return message.SerializeWithCachedSizesToArray(
+        reinterpret_cast<google::protobuf::uint8 *>(&output[0]));
   }
+  return true;
 }
 
-static std::string HexEncode(const std::string &bytes)
-{
-  std::string ret;
-  ret.reserve(bytes.size() * 2);
-  for (std::string::size_type i = 0; i < bytes.size(); ++i)
-  {
-    unsigned char byte = static_cast<unsigned char>(bytes[i]);
-    ret.push_back(HexEncode(byte >> 4));
-    ret.push_back(HexEncode(byte & 0x0f));
-  }
-  return ret;
-}
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+// The first block allocated for a compressed body, the body then grows geometrically.
+constexpr std::size_t kMinHttpBodyBlockSize = 4096;
 
-static std::string BytesMapping(const std::string &bytes,
-                                const google::protobuf::FieldDescriptor *field_descriptor,
-                                JsonBytesMappingKind kind)
+/**
+ * A ZeroCopyOutputStream writing into an HTTP body, so that the compressed output is written
+ * directly into the request buffer.
+ */
+class HttpBodyOutputStream : public google::protobuf::io::ZeroCopyOutputStream
 {
-  switch (kind)
+public:
+  explicit HttpBodyOutputStream(http_client::Body &output) : output_(output) { output_.clear(); }
+
+  bool Next(void **data, int *size) override
   {
-    case JsonBytesMappingKind::kHexId: {
-      if (field_descriptor->lowercase_name() == "trace_id" ||
-          field_descriptor->lowercase_name() == "span_id" ||
-          field_descriptor->lowercase_name() == "parent_span_id")
-      {
-        return HexEncode(bytes);
-      }
-      else
-      {
-        return opentelemetry::sdk::common::Base64Escape(bytes);
-      }
-    }
-    case JsonBytesMappingKind::kBase64: {
-      // Base64 is the default bytes mapping of protobuf
-      return opentelemetry::sdk::common::Base64Escape(bytes);
-    }
-    case JsonBytesMappingKind::kHex:
-      return HexEncode(bytes);
-    default:
-      return bytes;
+    std::size_t old_size = output_.size();
+    std::size_t new_size = (std::max)(old_size * 2, kMinHttpBodyBlockSize);
+    output_.resize(new_size);
+    *data = &output_[old_size];
+    *size = static_cast<int>(new_size - old_size);
+    return true;
   }
-}
 
-static void ConvertGenericFieldToJson(nlohmann::json &value,
-                                      const google::protobuf::Message &message,
-                                      const google::protobuf::FieldDescriptor *field_descriptor,
-                                      const OtlpHttpClientOptions &options);
+  void BackUp(int count) override { output_.resize(output_.size() - count); }
 
-static void ConvertListFieldToJson(nlohmann::json &value,
-                                   const google::protobuf::Message &message,
-                                   const google::protobuf::FieldDescriptor *field_descriptor,
-                                   const OtlpHttpClientOptions &options);
+  int64_t ByteCount() const override { return static_cast<int64_t>(output_.size()); }
 
-static void ConvertGenericMessageToJson(nlohmann::json &value,
-                                        const google::protobuf::Message &message,
-                                        const OtlpHttpClientOptions &options)
-{
-  std::vector<const google::protobuf::FieldDescriptor *> fields_with_data;
-  message.GetReflection()->ListFields(message, &fields_with_data);
-  for (std::size_t i = 0; i < fields_with_data.size(); ++i)
-  {
-    const google::protobuf::FieldDescriptor *field_descriptor = fields_with_data[i];
-    nlohmann::json &child_value = options.use_json_name ? value[field_descriptor->json_name()]
-                                                        : value[field_descriptor->camelcase_name()];
-    if (field_descriptor->is_repeated())
-    {
-      ConvertListFieldToJson(child_value, message, field_descriptor, options);
-    }
-    else
-    {
-      ConvertGenericFieldToJson(child_value, message, field_descriptor, options);
-    }
-  }
-}
+private:
+  http_client::Body &output_;
+};
 
-bool SerializeToHttpBody(http_client::Body &output, const google::protobuf::Message &message)
+google::protobuf::io::GzipOutputStream::Options GetGzipOptions()
 {
-  auto body_size = message.ByteSizeLong();
-  if (body_size > 0)
-  {
-    output.resize(body_size);
-    return message.SerializeWithCachedSizesToArray(
-        reinterpret_cast<google::protobuf::uint8 *>(&output[0]));
-  }
-  return true;
+  google::protobuf::io::GzipOutputStream::Options options;
+  options.format = google::protobuf::io::GzipOutputStream::GZIP;
+  return options;
 }
 
-void ConvertGenericFieldToJson(nlohmann::json &value,
-                               const google::protobuf::Message &message,
-                               const google::protobuf::FieldDescriptor *field_descriptor,
-                               const OtlpHttpClientOptions &options)
+/**
+ * Serialize the message through a gzip stream into the body, without an uncompressed copy.
+ */
+bool SerializeToCompressedHttpBody(http_client::Body &output,
+                                   const google::protobuf::Message &message)
 {
-  switch (field_descriptor->cpp_type())
+  HttpBodyOutputStream body_stream(output);
+  google::protobuf::io::GzipOutputStream gzip_stream(&body_stream, GetGzipOptions());
+  if (!message.SerializeToZeroCopyStream(&gzip_stream))
   {
-    case google::protobuf::FieldDescriptor::CPPTYPE_INT32: {
-      value = message.GetReflection()->GetInt32(message, field_descriptor);
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_INT64: {
-      // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded as
-      // decimal strings, and either numbers or strings are accepted when decoding.
-      value = std::to_string(message.GetReflection()->GetInt64(message, field_descriptor));
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_UINT32: {
-      value = message.GetReflection()->GetUInt32(message, field_descriptor);
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_UINT64: {
-      // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded as
-      // decimal strings, and either numbers or strings are accepted when decoding.
-      value = std::to_string(message.GetReflection()->GetUInt64(message, field_descriptor));
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_STRING: {
-      std::string empty;
-      if (field_descriptor->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
-      {
-        value = BytesMapping(
-            message.GetReflection()->GetStringReference(message, field_descriptor, &empty),
-            field_descriptor, options.json_bytes_mapping);
-      }
-      else
-      {
-        value = message.GetReflection()->GetStringReference(message, field_descriptor, &empty);
-      }
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE: {
-      ConvertGenericMessageToJson(
-          value, message.GetReflection()->GetMessage(message, field_descriptor, nullptr), options);
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE: {
-      value = message.GetReflection()->GetDouble(message, field_descriptor);
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT: {
-      value = message.GetReflection()->GetFloat(message, field_descriptor);
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_BOOL: {
-      value = message.GetReflection()->GetBool(message, field_descriptor);
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: {
-      value = message.GetReflection()->GetEnumValue(message, field_descriptor);
-      break;
-    }
-    default: {
-      break;
-    }
+    return false;
   }
+  return gzip_stream.Close();
 }
 
-void ConvertListFieldToJson(nlohmann::json &value,
-                            const google::protobuf::Message &message,
-                            const google::protobuf::FieldDescriptor *field_descriptor,
-                            const OtlpHttpClientOptions &options)
+/**
+ * Compress the given data into the body.
+ */
+bool CompressToHttpBody(http_client::Body &output, nostd::string_view data)
 {
-  auto field_size = message.GetReflection()->FieldSize(message, field_descriptor);
-
-  switch (field_descriptor->cpp_type())
+  HttpBodyOutputStream body_stream(output);
+  google::protobuf::io::GzipOutputStream gzip_stream(&body_stream, GetGzipOptions());
   {
-    case google::protobuf::FieldDescriptor::CPPTYPE_INT32: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        value.push_back(message.GetReflection()->GetRepeatedInt32(message, field_descriptor, i));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_INT64: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded
-        // as decimal strings, and either numbers or strings are accepted when decoding.
-        value.push_back(std::to_string(
-            message.GetReflection()->GetRepeatedInt64(message, field_descriptor, i)));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_UINT32: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        value.push_back(message.GetReflection()->GetRepeatedUInt32(message, field_descriptor, i));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_UINT64: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded
-        // as decimal strings, and either numbers or strings are accepted when decoding.
-        value.push_back(std::to_string(
-            message.GetReflection()->GetRepeatedUInt64(message, field_descriptor, i)));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_STRING: {
-      std::string empty;
-      if (field_descriptor->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
-      {
-        for (int i = 0; i < field_size; ++i)
-        {
-          value.push_back(BytesMapping(message.GetReflection()->GetRepeatedStringReference(
-                                           message, field_descriptor, i, &empty),
-                                       field_descriptor, options.json_bytes_mapping));
-        }
-      }
-      else
-      {
-        for (int i = 0; i < field_size; ++i)
-        {
-          value.push_back(message.GetReflection()->GetRepeatedStringReference(
-              message, field_descriptor, i, &empty));
-        }
-      }
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        nlohmann::json sub_value;
-        ConvertGenericMessageToJson(
-            sub_value, message.GetReflection()->GetRepeatedMessage(message, field_descriptor, i),
-            options);
-        value.push_back(std::move(sub_value));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        value.push_back(message.GetReflection()->GetRepeatedDouble(message, field_descriptor, i));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        value.push_back(message.GetReflection()->GetRepeatedFloat(message, field_descriptor, i));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_BOOL: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        value.push_back(message.GetReflection()->GetRepeatedBool(message, field_descriptor, i));
-      }
-
-      break;
-    }
-    case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: {
-      for (int i = 0; i < field_size; ++i)
-      {
-        value.push_back(
-            message.GetReflection()->GetRepeatedEnumValue(message, field_descriptor, i));
-      }
-      break;
-    }
-    default: {
-      break;
+    google::protobuf::io::CodedOutputStream coded_stream(&gzip_stream);
+    coded_stream.WriteRaw(data.data(), static_cast<int>(data.size()));
+    if (coded_stream.HadError())
+    {
+      return false;
     }
   }
+  return gzip_stream.Close();
 }
+#endif
 
 }  // namespace
 
@@ -650,6 +574,10 @@ OtlpHttpClient::OtlpHttpClient(OtlpHttpClientOptions &&options)
     : is_shutdown_(false), options_(options), http_client_(http_client::HttpClientFactory::Create())
 {
   http_client_->SetMaxSessionsPerConnection(options_.max_requests_per_connection);
+  http_client_->SetConnectionOptions(options_.connection_options);
+  checkCompression();
+  startRetries();
+  startDiskQueue();
 }
 
 OtlpHttpClient::~OtlpHttpClient()
@@ -689,6 +617,28 @@ OtlpHttpClient::OtlpHttpClient(OtlpHttpClientOptions &&options,
     : is_shutdown_(false), options_(options), http_client_(http_client)
 {
   http_client_->SetMaxSessionsPerConnection(options_.max_requests_per_connection);
+  http_client_->SetConnectionOptions(options_.connection_options);
+  checkCompression();
+  startRetries();
+  startDiskQueue();
+}
+
+void OtlpHttpClient::checkCompression() noexcept
+{
+  if (options_.compression == "gzip")
+  {
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+    use_gzip_ = true;
+#else
+    OTEL_INTERNAL_LOG_WARN(
+        "[OTLP HTTP Client] gzip compression is not supported in this build, requests are sent "
+        "uncompressed. Build with WITH_OTLP_HTTP_COMPRESSION to enable it.");
+#endif
+  }
+  else if (!options_.compression.empty() && options_.compression != "none")
+  {
+    OTEL_INTERNAL_LOG_WARN("[OTLP HTTP Client] unsupported compression: " << options_.compression);
+  }
 }
 
 // ----------------------------- HTTP Client methods ------------------------------
@@ -727,6 +677,90 @@ sdk::common::ExportResult OtlpHttpClient::Export(
     std::size_t max_running_requests) noexcept
 {
   auto session = createSession(message, std::move(result_callback));
+  return sendSession(std::move(session), result_callback, max_running_requests);
+}
+
+opentelemetry::sdk::common::ExportResult OtlpHttpClient::Export(
+    http_client::Body &&request_body) noexcept
+{
+  std::shared_ptr<opentelemetry::sdk::common::ExportResult> session_result =
+      std::make_shared<opentelemetry::sdk::common::ExportResult>(
+          opentelemetry::sdk::common::ExportResult::kSuccess);
+  opentelemetry::sdk::common::ExportResult export_result = Export(
+      std::move(request_body),
+      [session_result](opentelemetry::sdk::common::ExportResult result) {
+        *session_result = result;
+        return result == opentelemetry::sdk::common::ExportResult::kSuccess;
+      },
+      0);
+
+  if (opentelemetry::sdk::common::ExportResult::kSuccess != export_result)
+  {
+    return export_result;
+  }
+
+  return *session_result;
+}
+
+sdk::common::ExportResult OtlpHttpClient::Export(
+    http_client::Body &&request_body,
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback) noexcept
+{
+  return Export(std::move(request_body), std::move(result_callback),
+                options_.max_concurrent_requests);
+}
+
+sdk::common::ExportResult OtlpHttpClient::Export(
+    http_client::Body &&request_body,
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback,
+    std::size_t max_running_requests) noexcept
+{
+  nostd::variant<sdk::common::ExportResult, HttpSessionData> session =
+      sdk::common::ExportResult::kFailure;
+  if (options_.content_type != HttpRequestContentType::kBinary)
+  {
+    OTEL_INTERNAL_LOG_ERROR(
+        "[OTLP HTTP Client] Export failed, serialized requests need the binary content type");
+  }
+  else
+  {
+    if (options_.console_debug)
+    {
+      OTEL_INTERNAL_LOG_DEBUG("[OTLP HTTP Client] Request body(Binary): " << request_body.size()
+                                                                          << " bytes");
+    }
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+    if (use_gzip_)
+    {
+      http_client::Body compressed_body;
+      if (CompressToHttpBody(compressed_body,
+                             nostd::string_view(reinterpret_cast<const char *>(request_body.data()),
+                                                request_body.size())))
+      {
+        session = createSession(
+            std::make_shared<const http_client::Body>(std::move(compressed_body)),
+            kHttpBinaryContentType, true, std::move(result_callback));
+      }
+      else
+      {
+        OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] Compress body failed(Binary)");
+      }
+    }
+    else
+#endif
+    {
+      session = createSession(std::make_shared<const http_client::Body>(std::move(request_body)),
+                              kHttpBinaryContentType, false, std::move(result_callback));
+    }
+  }
+  return sendSession(std::move(session), result_callback, max_running_requests);
+}
+
+sdk::common::ExportResult OtlpHttpClient::sendSession(
+    nostd::variant<sdk::common::ExportResult, HttpSessionData> &&session,
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback,
+    std::size_t max_running_requests) noexcept
+{
   if (opentelemetry::nostd::holds_alternative<sdk::common::ExportResult>(session))
   {
     sdk::common::ExportResult result =
@@ -750,13 +784,26 @@ sdk::common::ExportResult OtlpHttpClient::Export(
         << " milliseconds)");
   }
 
+  // A sync export also waits for the retries of its request
+  std::chrono::system_clock::duration timeout = options_.timeout;
+  if (max_running_requests == 0 && options_.retry_policy.max_attempts > 1)
+  {
+    timeout += options_.retry_policy.max_elapsed_time;
+  }
+
   // Wait for any session to finish if there are to many sessions
   std::unique_lock<std::mutex> lock(session_waker_lock_);
-  bool wait_successful =
-      session_waker_.wait_for(lock, options_.timeout, [this, max_running_requests] {
-        std::lock_guard<std::recursive_mutex> guard{session_manager_lock_};
-        return running_sessions_.size() <= max_running_requests;
-      });
+  bool wait_successful = session_waker_.wait_for(lock, timeout, [this, max_running_requests] {
+    std::lock_guard<std::recursive_mutex> guard{session_manager_lock_};
+    // Requests waiting for a retry do not take a slot of a running request. disk_queue_thread_
+    // does not wait for them, they include the requests it has yet to write to the disk queue.
+    std::size_t running_requests = running_sessions_.size();
+    if (max_running_requests == 0 && std::this_thread::get_id() != disk_queue_thread_.get_id())
+    {
+      running_requests += pending_retries_.load();
+    }
+    return running_requests <= max_running_requests;
+  });
 
   cleanupGCSessions();
 
@@ -789,7 +836,7 @@ bool OtlpHttpClient::ForceFlush(std::chrono::microseconds timeout) noexcept
   {
     {
       std::lock_guard<std::recursive_mutex> guard{session_manager_lock_};
-      if (running_sessions_.empty())
+      if (running_sessions_.empty() && pending_retries_.load() == 0)
       {
         break;
       }
@@ -824,6 +871,10 @@ bool OtlpHttpClient::Shutdown(std::chrono::microseconds timeout) noexcept
     http_client_->FinishAllSessions();
   }
 
+  // The requests waiting for a retry are pushed to the disk queue before it is stopped
+  stopRetries();
+  stopDiskQueue();
+
   ForceFlush(timeout);
 
   while (cleanupGCSessions())
@@ -862,37 +913,22 @@ OtlpHttpClient::createSession(
     const google::protobuf::Message &message,
     std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback) noexcept
 {
-  // Parse uri and store it to cache
-  if (http_uri_.empty())
+  http_client::Body body_vec;
+  const char *content_type;
+  if (options_.content_type == HttpRequestContentType::kBinary)
   {
-    auto parse_url = opentelemetry::ext::http::common::UrlParser(std::string(options_.url));
-    if (!parse_url.success_)
+    bool serialized;
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+    if (use_gzip_)
     {
-      std::string error_message = "[OTLP HTTP Client] Export failed, invalid url: " + options_.url;
-      if (options_.console_debug)
-      {
-        std::cerr << error_message << std::endl;
-      }
-      OTEL_INTERNAL_LOG_ERROR(error_message.c_str());
-
-      return opentelemetry::sdk::common::ExportResult::kFailure;
-    }
-
-    if (!parse_url.path_.empty() && parse_url.path_[0] == '/')
-    {
-      http_uri_ = parse_url.path_.substr(1);
+      serialized = SerializeToCompressedHttpBody(body_vec, message);
     }
     else
+#endif
     {
-      http_uri_ = parse_url.path_;
+      serialized = SerializeToHttpBody(body_vec, message);
     }
-  }
-
-  http_client::Body body_vec;
-  std::string content_type;
-  if (options_.content_type == HttpRequestContentType::kBinary)
-  {
-    if (SerializeToHttpBody(body_vec, message))
+    if (serialized)
     {
       if (options_.console_debug)
       {
@@ -913,21 +949,80 @@ OtlpHttpClient::createSession(
   }
   else
   {
-    nlohmann::json json_request;
+    OtlpJsonOptions json_options;
+    json_options.json_bytes_mapping = options_.json_bytes_mapping;
+    json_options.use_json_name      = options_.use_json_name;
 
-    // Convert from proto into json object
-    ConvertGenericMessageToJson(json_request, message, options_);
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+    std::vector<uint8_t> json_body;
+    std::vector<uint8_t> &json_output = use_gzip_ ? json_body : body_vec;
+#else
+    std::vector<uint8_t> &json_output = body_vec;
+#endif
+    // Reserve as much as the last request, which is usually close to the size of this one.
+    json_output.reserve(last_json_body_size_.load(std::memory_order_relaxed));
+    OtlpJsonWriter::Write(message, json_options, json_output);
+    last_json_body_size_.store(json_output.size(), std::memory_order_relaxed);
 
-    std::string post_body_json =
-        json_request.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
     if (options_.console_debug)
     {
-      OTEL_INTERNAL_LOG_DEBUG("[OTLP HTTP Client] Request body(Json)" << post_body_json);
+      OTEL_INTERNAL_LOG_DEBUG("[OTLP HTTP Client] Request body(Json)"
+                              << std::string(json_output.begin(), json_output.end()));
     }
-    body_vec.assign(post_body_json.begin(), post_body_json.end());
+#ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+    if (use_gzip_)
+    {
+      if (!CompressToHttpBody(body_vec,
+                              nostd::string_view(reinterpret_cast<const char *>(json_body.data()),
+                                                 json_body.size())))
+      {
+        OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] Compress body failed(Json)");
+        return opentelemetry::sdk::common::ExportResult::kFailure;
+      }
+    }
+#endif
     content_type = kHttpJsonContentType;
   }
 
+  return createSession(std::make_shared<const http_client::Body>(std::move(body_vec)),
+                       content_type, use_gzip_, std::move(result_callback));
+}
+
+opentelemetry::nostd::variant<opentelemetry::sdk::common::ExportResult,
+                              OtlpHttpClient::HttpSessionData>
+OtlpHttpClient::createSession(
+    std::shared_ptr<const http_client::Body> body,
+    const char *content_type,
+    bool compressed,
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> &&result_callback,
+    RetryableFailureCallback &&retryable_failure_callback) noexcept
+{
+  // Parse uri and store it to cache
+  if (http_uri_.empty())
+  {
+    auto parse_url = opentelemetry::ext::http::common::UrlParser(std::string(options_.url));
+    if (!parse_url.success_)
+    {
+      std::string error_message = "[OTLP HTTP Client] Export failed, invalid url: " + options_.url;
+      if (options_.console_debug)
+      {
+        std::cerr << error_message << std::endl;
+      }
+      OTEL_INTERNAL_LOG_ERROR(error_message.c_str());
+
+      return opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+
+    if (!parse_url.path_.empty() && parse_url.path_[0] == '/')
+    {
+      http_uri_ = parse_url.path_.substr(1);
+    }
+    else
+    {
+      http_uri_ = parse_url.path_;
+    }
+  }
+
   // Send the request
   std::lock_guard<std::recursive_mutex> guard{session_manager_lock_};
   // Return failure if this exporter has been shutdown
@@ -954,15 +1049,31 @@ OtlpHttpClient::createSession(
   request->SetSslOptions(options_.ssl_options);
   request->SetTimeoutMs(std::chrono::duration_cast<std::chrono::milliseconds>(options_.timeout));
   request->SetMethod(http_client::Method::Post);
-  request->SetBody(body_vec);
   request->ReplaceHeader("Content-Type", content_type);
   request->ReplaceHeader("User-Agent", options_.user_agent);
+  if (compressed)
+  {
+    request->ReplaceHeader("Content-Encoding", "gzip");
+  }
+
+  if (!retryable_failure_callback && (options_.retry_policy.max_attempts > 1 || disk_queue_))
+  {
+    std::shared_ptr<RetryableRequest> retryable_request(new RetryableRequest{
+        body, content_type, compressed, 1,
+        std::chrono::steady_clock::now() + options_.retry_policy.max_elapsed_time});
+    retryable_failure_callback = makeRetryableFailureCallback(std::move(retryable_request));
+  }
+  // The body is shared with the retries of the request, rather than copied for each attempt
+  request->SetBodySlices({http_client::BodySlice(std::move(body))});
+
+  // A server delay beyond max_elapsed_time can't be honored before the deadline of the request
+  std::shared_ptr<opentelemetry::ext::http::client::EventHandler> event_handle{
+      new ResponseHandler(std::move(result_callback), options_.console_debug,
+                          std::move(retryable_failure_callback),
+                          options_.retry_policy.max_elapsed_time)};
 
   // Returns the created session data
-  return HttpSessionData{
-      std::move(session),
-      std::shared_ptr<opentelemetry::ext::http::client::EventHandler>{
-          new ResponseHandler(std::move(result_callback), options_.console_debug)}};
+  return HttpSessionData{std::move(session), std::move(event_handle)};
 }
 
 void OtlpHttpClient::addSession(HttpSessionData &&session_data) noexcept
@@ -1005,6 +1116,336 @@ bool OtlpHttpClient::cleanupGCSessions() noexcept
   return !gc_sessions_.empty();
 }
 
+void OtlpHttpClient::startRetries() noexcept
+{
+  if (options_.retry_policy.max_attempts > 1)
+  {
+    retry_thread_ = std::thread(&OtlpHttpClient::runRetries, this);
+  }
+}
+
+void OtlpHttpClient::stopRetries() noexcept
+{
+  {
+    std::lock_guard<std::mutex> guard{retry_lock_};
+    retry_stopping_ = true;
+  }
+  retry_waker_.notify_all();
+  if (retry_thread_.joinable())
+  {
+    retry_thread_.join();
+  }
+
+  std::multimap<std::chrono::steady_clock::time_point, ScheduledRetry> scheduled_retries;
+  {
+    std::lock_guard<std::mutex> guard{retry_lock_};
+    scheduled_retries.swap(scheduled_retries_);
+  }
+  for (auto &scheduled_retry : scheduled_retries)
+  {
+    // The requests waiting for a retry are kept in the disk queue if it is enabled, which is
+    // stopped after the retries
+    bool kept =
+        pushToDiskQueue(scheduled_retry.second.request, scheduled_retry.second.result_callback);
+    if (!kept && scheduled_retry.second.result_callback)
+    {
+      scheduled_retry.second.result_callback(sdk::common::ExportResult::kFailure);
+    }
+    finishRetry();
+  }
+}
+
+void OtlpHttpClient::runRetries() noexcept
+{
+  std::unique_lock<std::mutex> lock(retry_lock_);
+  while (!retry_stopping_)
+  {
+    if (scheduled_retries_.empty())
+    {
+      retry_waker_.wait(lock);
+      continue;
+    }
+    auto next_retry = scheduled_retries_.begin();
+    if (next_retry->first > std::chrono::steady_clock::now())
+    {
+      retry_waker_.wait_until(lock, next_retry->first);
+      continue;
+    }
+
+    ScheduledRetry retry = std::move(next_retry->second);
+    scheduled_retries_.erase(next_retry);
+    lock.unlock();
+    sendRetry(std::move(retry));
+    lock.lock();
+  }
+}
+
+void OtlpHttpClient::sendRetry(ScheduledRetry &&retry) noexcept
+{
+  const RetryableRequest &request = *retry.request;
+  if (options_.console_debug)
+  {
+    OTEL_INTERNAL_LOG_DEBUG("[OTLP HTTP Client] Retry a request, attempt " << request.attempts);
+  }
+
+  auto session = createSession(request.body, request.content_type, request.compressed,
+                               std::move(retry.result_callback),
+                               makeRetryableFailureCallback(retry.request));
+  if (opentelemetry::nostd::holds_alternative<sdk::common::ExportResult>(session))
+  {
+    if (retry.result_callback)
+    {
+      retry.result_callback(opentelemetry::nostd::get<sdk::common::ExportResult>(session));
+    }
+  }
+  else
+  {
+    addSession(std::move(opentelemetry::nostd::get<HttpSessionData>(session)));
+  }
+  finishRetry();
+}
+
+bool OtlpHttpClient::retryRequest(
+    const std::shared_ptr<RetryableRequest> &request,
+    std::chrono::system_clock::duration retry_after,
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback) noexcept
+{
+  const OtlpRetryPolicy &policy = options_.retry_policy;
+  if (request->attempts < policy.max_attempts)
+  {
+    // The server may ask for a delay, otherwise it is chosen randomly up to the backoff, which
+    // grows exponentially
+    std::chrono::steady_clock::duration delay =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(retry_after);
+    if (delay <= std::chrono::steady_clock::duration::zero())
+    {
+      double backoff =
+          static_cast<double>(policy.initial_backoff.count()) *
+          std::pow(static_cast<double>(policy.backoff_multiplier), request->attempts - 1);
+      backoff = (std::min)(backoff, static_cast<double>(policy.max_backoff.count()));
+
+      static thread_local std::default_random_engine random_engine{std::random_device{}()};
+      std::uniform_real_distribution<double> distribution(0, backoff);
+      delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double, std::milli>(distribution(random_engine)));
+    }
+
+    std::chrono::steady_clock::time_point next_attempt = std::chrono::steady_clock::now() + delay;
+    if (next_attempt <= request->deadline)
+    {
+      std::unique_lock<std::mutex> lock(retry_lock_);
+      if (!retry_stopping_)
+      {
+        ++request->attempts;
+        ++pending_retries_;
+        scheduled_retries_.emplace(next_attempt,
+                                   ScheduledRetry{request, std::move(result_callback)});
+        lock.unlock();
+        retry_waker_.notify_all();
+        return true;
+      }
+    }
+  }
+
+  // The request is not retried anymore, but it may be kept in the disk queue
+  return pushToDiskQueue(request, result_callback);
+}
+
+OtlpHttpClient::RetryableFailureCallback OtlpHttpClient::makeRetryableFailureCallback(
+    std::shared_ptr<RetryableRequest> request) noexcept
+{
+  return [this, request](
+             std::chrono::system_clock::duration retry_after,
+             std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback) {
+    return retryRequest(request, retry_after, result_callback);
+  };
+}
+
+void OtlpHttpClient::finishRetry() noexcept
+{
+  std::lock_guard<std::recursive_mutex> guard{session_manager_lock_};
+  --pending_retries_;
+  session_waker_.notify_all();
+}
+
+void OtlpHttpClient::startDiskQueue() noexcept
+{
+  if (options_.disk_queue.directory.empty())
+  {
+    return;
+  }
+  disk_queue_.reset(new OtlpDiskQueue(options_.disk_queue));
+  disk_queue_thread_ = std::thread(&OtlpHttpClient::drainDiskQueue, this);
+}
+
+void OtlpHttpClient::stopDiskQueue() noexcept
+{
+  {
+    std::lock_guard<std::mutex> guard{disk_queue_lock_};
+    disk_queue_stopping_ = true;
+  }
+  disk_queue_waker_.notify_all();
+  if (disk_queue_thread_.joinable())
+  {
+    disk_queue_thread_.join();
+  }
+  // The requests handed over while the thread was stopping are written here
+  {
+    std::lock_guard<std::mutex> guard{disk_queue_lock_};
+    disk_queue_stopped_ = true;
+  }
+  writeDiskQueueRecords();
+}
+
+bool OtlpHttpClient::pushToDiskQueue(
+    const std::shared_ptr<RetryableRequest> &request,
+    std::function<bool(opentelemetry::sdk::common::ExportResult)> &result_callback) noexcept
+{
+  if (!disk_queue_)
+  {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> guard{disk_queue_lock_};
+    if (disk_queue_stopped_)
+    {
+      return false;
+    }
+    ++pending_retries_;
+    disk_queue_pending_.push_back(ScheduledRetry{request, std::move(result_callback)});
+  }
+  disk_queue_waker_.notify_all();
+  return true;
+}
+
+void OtlpHttpClient::writeDiskQueueRecords() noexcept
+{
+  std::vector<ScheduledRetry> pending;
+  {
+    std::lock_guard<std::mutex> guard{disk_queue_lock_};
+    pending.swap(disk_queue_pending_);
+  }
+  for (auto &retry : pending)
+  {
+    const RetryableRequest &request = *retry.request;
+    uint32_t flags                  = 0;
+    if (std::strcmp(request.content_type, kHttpJsonContentType) == 0)
+    {
+      flags |= kDiskQueueJsonFlag;
+    }
+    if (request.compressed)
+    {
+      flags |= kDiskQueueGzipFlag;
+    }
+    bool kept = disk_queue_->Push(flags, request.body->data(), request.body->size());
+    if (kept)
+    {
+      OTEL_INTERNAL_LOG_WARN(
+          "[OTLP HTTP Client] The request is kept in the disk queue to be retried");
+    }
+    if (retry.result_callback)
+    {
+      retry.result_callback(kept ? sdk::common::ExportResult::kSuccess
+                                 : sdk::common::ExportResult::kFailure);
+    }
+    finishRetry();
+  }
+}
+
+void OtlpHttpClient::drainDiskQueue() noexcept
+{
+  std::chrono::milliseconds backoff                = options_.disk_queue.initial_backoff;
+  std::chrono::steady_clock::time_point next_retry = std::chrono::steady_clock::now();
+  auto is_woken_up = [this] { return disk_queue_stopping_ || !disk_queue_pending_.empty(); };
+
+  std::unique_lock<std::mutex> lock(disk_queue_lock_);
+  while (!disk_queue_stopping_)
+  {
+    if (!disk_queue_pending_.empty())
+    {
+      lock.unlock();
+      writeDiskQueueRecords();
+      lock.lock();
+      continue;
+    }
+    if (std::chrono::steady_clock::now() < next_retry)
+    {
+      disk_queue_waker_.wait_until(lock, next_retry, is_woken_up);
+      continue;
+    }
+
+    OtlpDiskQueue::Record record;
+    if (!disk_queue_->Front(record))
+    {
+      disk_queue_waker_.wait(lock, is_woken_up);
+      // The collector was unreachable when the request was pushed, so it is not retried at once
+      next_retry = std::chrono::steady_clock::now() + backoff;
+      continue;
+    }
+
+    // The record is only removed if it is still at the front once sent, since a push to a full
+    // queue may drop it meanwhile
+    OtlpDiskQueue::Position position = record.position;
+    lock.unlock();
+    bool retryable                   = false;
+    sdk::common::ExportResult result = sendDiskQueueRecord(std::move(record), retryable);
+    lock.lock();
+
+    if (result == sdk::common::ExportResult::kSuccess)
+    {
+      disk_queue_->Pop(position);
+      backoff = options_.disk_queue.initial_backoff;
+    }
+    else if (retryable || IsShutdown())
+    {
+      next_retry = std::chrono::steady_clock::now() + backoff;
+      backoff    = (std::min)(backoff * 2, options_.disk_queue.max_backoff);
+    }
+    else
+    {
+      OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] Drop a request of the disk queue, it failed");
+      disk_queue_->Pop(position);
+    }
+  }
+}
+
+sdk::common::ExportResult OtlpHttpClient::sendDiskQueueRecord(OtlpDiskQueue::Record &&record,
+                                                              bool &retryable) noexcept
+{
+  std::shared_ptr<sdk::common::ExportResult> session_result =
+      std::make_shared<sdk::common::ExportResult>(sdk::common::ExportResult::kSuccess);
+  std::shared_ptr<std::atomic<bool>> session_retryable = std::make_shared<std::atomic<bool>>(false);
+  std::function<bool(opentelemetry::sdk::common::ExportResult)> result_callback =
+      [session_result](opentelemetry::sdk::common::ExportResult result) {
+        *session_result = result;
+        return result == opentelemetry::sdk::common::ExportResult::kSuccess;
+      };
+
+  // The request stays in the disk queue if the collector is unreachable
+  RetryableFailureCallback retryable_failure_callback =
+      [session_retryable](std::chrono::system_clock::duration,
+                          std::function<bool(opentelemetry::sdk::common::ExportResult)> &) {
+        *session_retryable = true;
+        return false;
+      };
+
+  const char *content_type = (record.flags & kDiskQueueJsonFlag) != 0 ? kHttpJsonContentType
+                                                                       : kHttpBinaryContentType;
+  bool compressed          = (record.flags & kDiskQueueGzipFlag) != 0;
+  auto session = createSession(
+      std::make_shared<const http_client::Body>(std::move(record.payload)), content_type,
+      compressed, std::move(result_callback), std::move(retryable_failure_callback));
+  sdk::common::ExportResult export_result = sendSession(std::move(session), result_callback, 0);
+
+  // The request is retried if it could not be sent, or is still running after the timeout
+  retryable = *session_retryable || export_result != sdk::common::ExportResult::kSuccess;
+  if (export_result != sdk::common::ExportResult::kSuccess)
+  {
+    return export_result;
+  }
+  return *session_result;
+}
+
 bool OtlpHttpClient::IsShutdown() const noexcept
 {
   return is_shutdown_;
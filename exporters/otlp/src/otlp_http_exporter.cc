@@ -4,6 +4,7 @@
 #include "opentelemetry/exporters/otlp/otlp_http_exporter.h"
 #include "opentelemetry/exporters/otlp/otlp_recordable.h"
 #include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+#include "opentelemetry/exporters/otlp/otlp_wire_recordable.h"
 
 #include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
@@ -21,34 +22,47 @@ namespace exporter
 namespace otlp
 {
 
+namespace
+{
+OtlpHttpClientOptions MakeOtlpHttpClientOptions(const OtlpHttpExporterOptions &options)
+{
+  OtlpHttpClientOptions client_options(options.url,
+                                       options.ssl_insecure_skip_verify,
+                                       options.ssl_ca_cert_path,
+                                       options.ssl_ca_cert_string,
+                                       options.ssl_client_key_path,
+                                       options.ssl_client_key_string,
+                                       options.ssl_client_cert_path,
+                                       options.ssl_client_cert_string,
+                                       options.ssl_min_tls,
+                                       options.ssl_max_tls,
+                                       options.ssl_cipher,
+                                       options.ssl_cipher_suite,
+                                       options.content_type,
+                                       options.json_bytes_mapping,
+                                       options.use_json_name,
+                                       options.console_debug,
+                                       options.timeout,
+                                       options.http_headers
+#ifdef ENABLE_ASYNC_EXPORT
+                                       ,
+                                       options.max_concurrent_requests,
+                                       options.max_requests_per_connection
+#endif
+                                       );
+  client_options.compression        = options.compression;
+  client_options.retry_policy       = options.retry_policy;
+  client_options.disk_queue         = options.disk_queue;
+  client_options.connection_options = options.connection_options;
+  return client_options;
+}
+}  // namespace
+
 OtlpHttpExporter::OtlpHttpExporter() : OtlpHttpExporter(OtlpHttpExporterOptions()) {}
 
 OtlpHttpExporter::OtlpHttpExporter(const OtlpHttpExporterOptions &options)
     : options_(options),
-      http_client_(new OtlpHttpClient(OtlpHttpClientOptions(options.url,
-                                                            options.ssl_insecure_skip_verify,
-                                                            options.ssl_ca_cert_path,
-                                                            options.ssl_ca_cert_string,
-                                                            options.ssl_client_key_path,
-                                                            options.ssl_client_key_string,
-                                                            options.ssl_client_cert_path,
-                                                            options.ssl_client_cert_string,
-                                                            options.ssl_min_tls,
-                                                            options.ssl_max_tls,
-                                                            options.ssl_cipher,
-                                                            options.ssl_cipher_suite,
-                                                            options.content_type,
-                                                            options.json_bytes_mapping,
-                                                            options.use_json_name,
-                                                            options.console_debug,
-                                                            options.timeout,
-                                                            options.http_headers
-#ifdef ENABLE_ASYNC_EXPORT
-                                                            ,
-                                                            options.max_concurrent_requests,
-                                                            options.max_requests_per_connection
-#endif
-                                                            )))
+      http_client_(new OtlpHttpClient(MakeOtlpHttpClientOptions(options)))
 {}
 
 OtlpHttpExporter::OtlpHttpExporter(std::unique_ptr<OtlpHttpClient> http_client)
@@ -58,10 +72,14 @@ OtlpHttpExporter::OtlpHttpExporter(std::unique_ptr<OtlpHttpClient> http_client)
   options.url                      = http_client_->GetOptions().url;
   options.content_type             = http_client_->GetOptions().content_type;
   options.json_bytes_mapping       = http_client_->GetOptions().json_bytes_mapping;
+  options.compression              = http_client_->GetOptions().compression;
   options.use_json_name            = http_client_->GetOptions().use_json_name;
   options.console_debug            = http_client_->GetOptions().console_debug;
   options.timeout                  = http_client_->GetOptions().timeout;
   options.http_headers             = http_client_->GetOptions().http_headers;
+  options.disk_queue               = http_client_->GetOptions().disk_queue;
+  options.retry_policy             = http_client_->GetOptions().retry_policy;
+  options.connection_options       = http_client_->GetOptions().connection_options;
 #ifdef ENABLE_ASYNC_EXPORT
   options.max_concurrent_requests     = http_client_->GetOptions().max_concurrent_requests;
   options.max_requests_per_connection = http_client_->GetOptions().max_requests_per_connection;
@@ -71,8 +89,13 @@ OtlpHttpExporter::OtlpHttpExporter(std::unique_ptr<OtlpHttpClient> http_client)
 
 std::unique_ptr<opentelemetry::sdk::trace::Recordable> OtlpHttpExporter::MakeRecordable() noexcept
 {
+  if (IsDirectSpanEncoding())
+  {
+    return std::unique_ptr<opentelemetry::sdk::trace::Recordable>(
+        new exporter::otlp::OtlpWireRecordable());
+  }
   return std::unique_ptr<opentelemetry::sdk::trace::Recordable>(
-      new exporter::otlp::OtlpRecordable());
+      new exporter::otlp::OtlpRecordable(arena_pool_->AcquireRecordableArena()));
 }
 
 opentelemetry::sdk::common::ExportResult OtlpHttpExporter::Export(
@@ -91,28 +114,53 @@ opentelemetry::sdk::common::ExportResult OtlpHttpExporter::Export(
     return opentelemetry::sdk::common::ExportResult::kSuccess;
   }
 
-  proto::collector::trace::v1::ExportTraceServiceRequest service_request;
-  OtlpRecordableUtils::PopulateRequest(spans, &service_request);
   std::size_t span_count = spans.size();
 #ifdef ENABLE_ASYNC_EXPORT
-  http_client_->Export(
-      service_request, [span_count](opentelemetry::sdk::common::ExportResult result) {
-        if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
-        {
-          OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
-                                  << span_count
-                                  << " trace span(s) error: " << static_cast<int>(result));
-        }
-        else
-        {
-          OTEL_INTERNAL_LOG_DEBUG("[OTLP HTTP Client] Export " << span_count
-                                                               << " trace span(s) success");
-        }
-        return true;
-      });
+  auto result_callback = [span_count](opentelemetry::sdk::common::ExportResult result) {
+    if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
+    {
+      OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
+                              << span_count
+                              << " trace span(s) error: " << static_cast<int>(result));
+    }
+    else
+    {
+      OTEL_INTERNAL_LOG_DEBUG("[OTLP HTTP Client] Export " << span_count
+                                                           << " trace span(s) success");
+    }
+    return true;
+  };
+  if (IsDirectSpanEncoding())
+  {
+    ext::http::client::Body request_body;
+    OtlpWireRecordable::SerializeRequest(spans, &request_body, &resource_cache_);
+    http_client_->Export(std::move(request_body), std::move(result_callback));
+  }
+  else
+  {
+    auto service_request =
+        arena_pool_->CreateMessage<proto::collector::trace::v1::ExportTraceServiceRequest>(
+            OtlpRecordableUtils::GetArena(spans));
+    OtlpRecordableUtils::PopulateRequest(spans, service_request.get(), &resource_cache_);
+    http_client_->Export(*service_request, std::move(result_callback));
+  }
   return opentelemetry::sdk::common::ExportResult::kSuccess;
 #else
-  opentelemetry::sdk::common::ExportResult result = http_client_->Export(service_request);
+  opentelemetry::sdk::common::ExportResult result;
+  if (IsDirectSpanEncoding())
+  {
+    ext::http::client::Body request_body;
+    OtlpWireRecordable::SerializeRequest(spans, &request_body, &resource_cache_);
+    result = http_client_->Export(std::move(request_body));
+  }
+  else
+  {
+    auto service_request =
+        arena_pool_->CreateMessage<proto::collector::trace::v1::ExportTraceServiceRequest>(
+            OtlpRecordableUtils::GetArena(spans));
+    OtlpRecordableUtils::PopulateRequest(spans, service_request.get(), &resource_cache_);
+    result = http_client_->Export(*service_request);
+  }
   if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
   {
     OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
@@ -126,6 +174,12 @@ opentelemetry::sdk::common::ExportResult OtlpHttpExporter::Export(
 #endif
 }
 
+bool OtlpHttpExporter::IsDirectSpanEncoding() const noexcept
+{
+  return options_.direct_span_encoding &&
+         http_client_->GetOptions().content_type == HttpRequestContentType::kBinary;
+}
+
 bool OtlpHttpExporter::ForceFlush(std::chrono::microseconds timeout) noexcept
 {
   return http_client_->ForceFlush(timeout);
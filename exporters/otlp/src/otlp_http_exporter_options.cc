@@ -16,13 +16,15 @@ namespace otlp
 
 OtlpHttpExporterOptions::OtlpHttpExporterOptions()
 {
-  url                = GetOtlpDefaultHttpTracesEndpoint();
-  content_type       = HttpRequestContentType::kJson;
-  json_bytes_mapping = JsonBytesMappingKind::kHexId;
-  use_json_name      = false;
-  console_debug      = false;
-  timeout            = GetOtlpDefaultTracesTimeout();
-  http_headers       = GetOtlpDefaultTracesHeaders();
+  url                  = GetOtlpDefaultHttpTracesEndpoint();
+  content_type         = HttpRequestContentType::kJson;
+  json_bytes_mapping   = JsonBytesMappingKind::kHexId;
+  use_json_name        = false;
+  console_debug        = false;
+  timeout              = GetOtlpDefaultTracesTimeout();
+  http_headers         = GetOtlpDefaultTracesHeaders();
+  compression          = GetOtlpDefaultTracesCompression();
+  direct_span_encoding = false;
 
 #ifdef ENABLE_ASYNC_EXPORT
   max_concurrent_requests     = 64;
@@ -21,6 +21,42 @@ namespace exporter
 namespace otlp
 {
 
+namespace
+{
+OtlpHttpClientOptions MakeOtlpHttpClientOptions(const OtlpHttpLogRecordExporterOptions &options)
+{
+  OtlpHttpClientOptions client_options(options.url,
+                                       options.ssl_insecure_skip_verify,
+                                       options.ssl_ca_cert_path,
+                                       options.ssl_ca_cert_string,
+                                       options.ssl_client_key_path,
+                                       options.ssl_client_key_string,
+                                       options.ssl_client_cert_path,
+                                       options.ssl_client_cert_string,
+                                       options.ssl_min_tls,
+                                       options.ssl_max_tls,
+                                       options.ssl_cipher,
+                                       options.ssl_cipher_suite,
+                                       options.content_type,
+                                       options.json_bytes_mapping,
+                                       options.use_json_name,
+                                       options.console_debug,
+                                       options.timeout,
+                                       options.http_headers
+#ifdef ENABLE_ASYNC_EXPORT
+                                       ,
+                                       options.max_concurrent_requests,
+                                       options.max_requests_per_connection
+#endif
+                                       );
+  client_options.compression        = options.compression;
+  client_options.retry_policy       = options.retry_policy;
+  client_options.disk_queue         = options.disk_queue;
+  client_options.connection_options = options.connection_options;
+  return client_options;
+}
+}  // namespace
+
 OtlpHttpLogRecordExporter::OtlpHttpLogRecordExporter()
     : OtlpHttpLogRecordExporter(OtlpHttpLogRecordExporterOptions())
 {}
@@ -28,30 +64,7 @@ OtlpHttpLogRecordExporter::OtlpHttpLogRecordExporter()
 OtlpHttpLogRecordExporter::OtlpHttpLogRecordExporter(
     const OtlpHttpLogRecordExporterOptions &options)
     : options_(options),
-      http_client_(new OtlpHttpClient(OtlpHttpClientOptions(options.url,
-                                                            options.ssl_insecure_skip_verify,
-                                                            options.ssl_ca_cert_path,
-                                                            options.ssl_ca_cert_string,
-                                                            options.ssl_client_key_path,
-                                                            options.ssl_client_key_string,
-                                                            options.ssl_client_cert_path,
-                                                            options.ssl_client_cert_string,
-                                                            options.ssl_min_tls,
-                                                            options.ssl_max_tls,
-                                                            options.ssl_cipher,
-                                                            options.ssl_cipher_suite,
-                                                            options.content_type,
-                                                            options.json_bytes_mapping,
-                                                            options.use_json_name,
-                                                            options.console_debug,
-                                                            options.timeout,
-                                                            options.http_headers
-#ifdef ENABLE_ASYNC_EXPORT
-                                                            ,
-                                                            options.max_concurrent_requests,
-                                                            options.max_requests_per_connection
-#endif
-                                                            )))
+      http_client_(new OtlpHttpClient(MakeOtlpHttpClientOptions(options)))
 {}
 
 OtlpHttpLogRecordExporter::OtlpHttpLogRecordExporter(std::unique_ptr<OtlpHttpClient> http_client)
@@ -62,10 +75,14 @@ OtlpHttpLogRecordExporter::OtlpHttpLogRecordExporter(std::unique_ptr<OtlpHttpCli
   options.url                = http_client_->GetOptions().url;
   options.content_type       = http_client_->GetOptions().content_type;
   options.json_bytes_mapping = http_client_->GetOptions().json_bytes_mapping;
+  options.compression        = http_client_->GetOptions().compression;
   options.use_json_name      = http_client_->GetOptions().use_json_name;
   options.console_debug      = http_client_->GetOptions().console_debug;
   options.timeout            = http_client_->GetOptions().timeout;
   options.http_headers       = http_client_->GetOptions().http_headers;
+  options.disk_queue         = http_client_->GetOptions().disk_queue;
+  options.retry_policy       = http_client_->GetOptions().retry_policy;
+  options.connection_options = http_client_->GetOptions().connection_options;
 #ifdef ENABLE_ASYNC_EXPORT
   options.max_concurrent_requests     = http_client_->GetOptions().max_concurrent_requests;
   options.max_requests_per_connection = http_client_->GetOptions().max_requests_per_connection;
@@ -76,7 +93,8 @@ OtlpHttpLogRecordExporter::OtlpHttpLogRecordExporter(std::unique_ptr<OtlpHttpCli
 std::unique_ptr<opentelemetry::sdk::logs::Recordable>
 OtlpHttpLogRecordExporter::MakeRecordable() noexcept
 {
-  return std::unique_ptr<opentelemetry::sdk::logs::Recordable>(new OtlpLogRecordable());
+  return std::unique_ptr<opentelemetry::sdk::logs::Recordable>(
+      new OtlpLogRecordable(arena_pool_->AcquireRecordableArena()));
 }
 
 opentelemetry::sdk::common::ExportResult OtlpHttpLogRecordExporter::Export(
@@ -94,12 +112,14 @@ opentelemetry::sdk::common::ExportResult OtlpHttpLogRecordExporter::Export(
   {
     return opentelemetry::sdk::common::ExportResult::kSuccess;
   }
-  proto::collector::logs::v1::ExportLogsServiceRequest service_request;
-  OtlpRecordableUtils::PopulateRequest(logs, &service_request);
+  auto service_request =
+      arena_pool_->CreateMessage<proto::collector::logs::v1::ExportLogsServiceRequest>(
+          OtlpRecordableUtils::GetArena(logs));
+  OtlpRecordableUtils::PopulateRequest(logs, service_request.get(), &resource_cache_);
   std::size_t log_count = logs.size();
 #ifdef ENABLE_ASYNC_EXPORT
   http_client_->Export(
-      service_request, [log_count](opentelemetry::sdk::common::ExportResult result) {
+      *service_request, [log_count](opentelemetry::sdk::common::ExportResult result) {
         if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
         {
           OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
@@ -113,7 +133,7 @@ opentelemetry::sdk::common::ExportResult OtlpHttpLogRecordExporter::Export(
       });
   return opentelemetry::sdk::common::ExportResult::kSuccess;
 #else
-  opentelemetry::sdk::common::ExportResult result = http_client_->Export(service_request);
+  opentelemetry::sdk::common::ExportResult result = http_client_->Export(*service_request);
   if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
   {
     OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
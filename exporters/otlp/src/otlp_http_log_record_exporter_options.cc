@@ -23,6 +23,7 @@ OtlpHttpLogRecordExporterOptions::OtlpHttpLogRecordExporterOptions()
   console_debug      = false;
   timeout            = GetOtlpDefaultLogsTimeout();
   http_headers       = GetOtlpDefaultLogsHeaders();
+  compression        = GetOtlpDefaultLogsCompression();
 
 #ifdef ENABLE_ASYNC_EXPORT
   max_concurrent_requests     = 64;
@@ -20,6 +20,42 @@ namespace exporter
 namespace otlp
 {
 
+namespace
+{
+OtlpHttpClientOptions MakeOtlpHttpClientOptions(const OtlpHttpMetricExporterOptions &options)
+{
+  OtlpHttpClientOptions client_options(options.url,
+                                       options.ssl_insecure_skip_verify,
+                                       options.ssl_ca_cert_path,
+                                       options.ssl_ca_cert_string,
+                                       options.ssl_client_key_path,
+                                       options.ssl_client_key_string,
+                                       options.ssl_client_cert_path,
+                                       options.ssl_client_cert_string,
+                                       options.ssl_min_tls,
+                                       options.ssl_max_tls,
+                                       options.ssl_cipher,
+                                       options.ssl_cipher_suite,
+                                       options.content_type,
+                                       options.json_bytes_mapping,
+                                       options.use_json_name,
+                                       options.console_debug,
+                                       options.timeout,
+                                       options.http_headers
+#ifdef ENABLE_ASYNC_EXPORT
+                                       ,
+                                       options.max_concurrent_requests,
+                                       options.max_requests_per_connection
+#endif
+                                       );
+  client_options.compression        = options.compression;
+  client_options.retry_policy       = options.retry_policy;
+  client_options.disk_queue         = options.disk_queue;
+  client_options.connection_options = options.connection_options;
+  return client_options;
+}
+}  // namespace
+
 OtlpHttpMetricExporter::OtlpHttpMetricExporter()
     : OtlpHttpMetricExporter(OtlpHttpMetricExporterOptions())
 {}
@@ -28,30 +64,7 @@ OtlpHttpMetricExporter::OtlpHttpMetricExporter(const OtlpHttpMetricExporterOptio
     : options_(options),
       aggregation_temporality_selector_{
           OtlpMetricUtils::ChooseTemporalitySelector(options_.aggregation_temporality)},
-      http_client_(new OtlpHttpClient(OtlpHttpClientOptions(options.url,
-                                                            options.ssl_insecure_skip_verify,
-                                                            options.ssl_ca_cert_path,
-                                                            options.ssl_ca_cert_string,
-                                                            options.ssl_client_key_path,
-                                                            options.ssl_client_key_string,
-                                                            options.ssl_client_cert_path,
-                                                            options.ssl_client_cert_string,
-                                                            options.ssl_min_tls,
-                                                            options.ssl_max_tls,
-                                                            options.ssl_cipher,
-                                                            options.ssl_cipher_suite,
-                                                            options.content_type,
-                                                            options.json_bytes_mapping,
-                                                            options.use_json_name,
-                                                            options.console_debug,
-                                                            options.timeout,
-                                                            options.http_headers
-#ifdef ENABLE_ASYNC_EXPORT
-                                                            ,
-                                                            options.max_concurrent_requests,
-                                                            options.max_requests_per_connection
-#endif
-                                                            )))
+      http_client_(new OtlpHttpClient(MakeOtlpHttpClientOptions(options)))
 {}
 
 OtlpHttpMetricExporter::OtlpHttpMetricExporter(std::unique_ptr<OtlpHttpClient> http_client)
@@ -64,10 +77,14 @@ OtlpHttpMetricExporter::OtlpHttpMetricExporter(std::unique_ptr<OtlpHttpClient> h
   options.url                            = http_client_->GetOptions().url;
   options.content_type                   = http_client_->GetOptions().content_type;
   options.json_bytes_mapping             = http_client_->GetOptions().json_bytes_mapping;
+  options.compression                    = http_client_->GetOptions().compression;
   options.use_json_name                  = http_client_->GetOptions().use_json_name;
   options.console_debug                  = http_client_->GetOptions().console_debug;
   options.timeout                        = http_client_->GetOptions().timeout;
   options.http_headers                   = http_client_->GetOptions().http_headers;
+  options.disk_queue                     = http_client_->GetOptions().disk_queue;
+  options.retry_policy                   = http_client_->GetOptions().retry_policy;
+  options.connection_options             = http_client_->GetOptions().connection_options;
 #ifdef ENABLE_ASYNC_EXPORT
   options.max_concurrent_requests     = http_client_->GetOptions().max_concurrent_requests;
   options.max_requests_per_connection = http_client_->GetOptions().max_requests_per_connection;
@@ -97,12 +114,13 @@ opentelemetry::sdk::common::ExportResult OtlpHttpMetricExporter::Export(
   {
     return opentelemetry::sdk::common::ExportResult::kSuccess;
   }
-  proto::collector::metrics::v1::ExportMetricsServiceRequest service_request;
-  OtlpMetricUtils::PopulateRequest(data, &service_request);
+  auto service_request =
+      arena_pool_->CreateMessage<proto::collector::metrics::v1::ExportMetricsServiceRequest>();
+  OtlpMetricUtils::PopulateRequest(data, service_request.get(), &resource_cache_);
   std::size_t metric_count = data.scope_metric_data_.size();
 #ifdef ENABLE_ASYNC_EXPORT
-  http_client_->Export(service_request, [metric_count](
-                                            opentelemetry::sdk::common::ExportResult result) {
+  http_client_->Export(*service_request, [metric_count](
+                                             opentelemetry::sdk::common::ExportResult result) {
     if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
     {
       OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
@@ -116,7 +134,7 @@ opentelemetry::sdk::common::ExportResult OtlpHttpMetricExporter::Export(
   });
   return opentelemetry::sdk::common::ExportResult::kSuccess;
 #else
-  opentelemetry::sdk::common::ExportResult result = http_client_->Export(service_request);
+  opentelemetry::sdk::common::ExportResult result = http_client_->Export(*service_request);
   if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
   {
     OTEL_INTERNAL_LOG_ERROR("[OTLP HTTP Client] ERROR: Export "
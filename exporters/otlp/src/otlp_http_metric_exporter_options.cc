@@ -23,6 +23,7 @@ OtlpHttpMetricExporterOptions::OtlpHttpMetricExporterOptions()
   console_debug           = false;
   timeout                 = GetOtlpDefaultMetricsTimeout();
   http_headers            = GetOtlpDefaultMetricsHeaders();
+  compression             = GetOtlpDefaultMetricsCompression();
   aggregation_temporality = PreferredAggregationTemporality::kCumulative;
 
 #ifdef ENABLE_ASYNC_EXPORT
@@ -0,0 +1,1199 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_json_writer.h"
+
+#if defined(HAVE_GSL)
+#  include <gsl/gsl>
+#else
+#  include <assert.h>
+#endif
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "google/protobuf/message.h"
+#include "google/protobuf/reflection.h"
+#include "google/protobuf/stubs/common.h"
+#include "nlohmann/json.hpp"
+#include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include "opentelemetry/sdk/common/base64.h"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+
+static inline char HexEncode(unsigned char byte)
+{
+#if defined(HAVE_GSL)
+  Expects(byte <= 16);
+#else
+  assert(byte <= 16);
+#endif
+  if (byte >= 10)
+  {
+    return byte - 10 + 'a';
+  }
+  else
+  {
+    return byte + '0';
+  }
+}
+
+static std::string HexEncode(const std::string &bytes)
+{
+  std::string ret;
+  ret.reserve(bytes.size() * 2);
+  for (std::string::size_type i = 0; i < bytes.size(); ++i)
+  {
+    unsigned char byte = static_cast<unsigned char>(bytes[i]);
+    ret.push_back(HexEncode(byte >> 4));
+    ret.push_back(HexEncode(byte & 0x0f));
+  }
+  return ret;
+}
+
+static std::string BytesMapping(const std::string &bytes,
+                                const google::protobuf::FieldDescriptor *field_descriptor,
+                                JsonBytesMappingKind kind)
+{
+  switch (kind)
+  {
+    case JsonBytesMappingKind::kHexId: {
+      if (field_descriptor->lowercase_name() == "trace_id" ||
+          field_descriptor->lowercase_name() == "span_id" ||
+          field_descriptor->lowercase_name() == "parent_span_id")
+      {
+        return HexEncode(bytes);
+      }
+      else
+      {
+        return opentelemetry::sdk::common::Base64Escape(bytes);
+      }
+    }
+    case JsonBytesMappingKind::kBase64: {
+      // Base64 is the default bytes mapping of protobuf
+      return opentelemetry::sdk::common::Base64Escape(bytes);
+    }
+    case JsonBytesMappingKind::kHex:
+      return HexEncode(bytes);
+    default:
+      return bytes;
+  }
+}
+
+static void ConvertGenericFieldToJson(nlohmann::json &value,
+                                      const google::protobuf::Message &message,
+                                      const google::protobuf::FieldDescriptor *field_descriptor,
+                                      const OtlpJsonOptions &options);
+
+static void ConvertListFieldToJson(nlohmann::json &value,
+                                   const google::protobuf::Message &message,
+                                   const google::protobuf::FieldDescriptor *field_descriptor,
+                                   const OtlpJsonOptions &options);
+
+static void ConvertGenericMessageToJson(nlohmann::json &value,
+                                        const google::protobuf::Message &message,
+                                        const OtlpJsonOptions &options)
+{
+  std::vector<const google::protobuf::FieldDescriptor *> fields_with_data;
+  message.GetReflection()->ListFields(message, &fields_with_data);
+  for (std::size_t i = 0; i < fields_with_data.size(); ++i)
+  {
+    const google::protobuf::FieldDescriptor *field_descriptor = fields_with_data[i];
+    nlohmann::json &child_value = options.use_json_name ? value[field_descriptor->json_name()]
+                                                        : value[field_descriptor->camelcase_name()];
+    if (field_descriptor->is_repeated())
+    {
+      ConvertListFieldToJson(child_value, message, field_descriptor, options);
+    }
+    else
+    {
+      ConvertGenericFieldToJson(child_value, message, field_descriptor, options);
+    }
+  }
+}
+
+void ConvertGenericFieldToJson(nlohmann::json &value,
+                               const google::protobuf::Message &message,
+                               const google::protobuf::FieldDescriptor *field_descriptor,
+                               const OtlpJsonOptions &options)
+{
+  switch (field_descriptor->cpp_type())
+  {
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT32: {
+      value = message.GetReflection()->GetInt32(message, field_descriptor);
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT64: {
+      // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded as
+      // decimal strings, and either numbers or strings are accepted when decoding.
+      value = std::to_string(message.GetReflection()->GetInt64(message, field_descriptor));
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT32: {
+      value = message.GetReflection()->GetUInt32(message, field_descriptor);
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT64: {
+      // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded as
+      // decimal strings, and either numbers or strings are accepted when decoding.
+      value = std::to_string(message.GetReflection()->GetUInt64(message, field_descriptor));
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_STRING: {
+      std::string empty;
+      if (field_descriptor->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
+      {
+        value = BytesMapping(
+            message.GetReflection()->GetStringReference(message, field_descriptor, &empty),
+            field_descriptor, options.json_bytes_mapping);
+      }
+      else
+      {
+        value = message.GetReflection()->GetStringReference(message, field_descriptor, &empty);
+      }
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE: {
+      ConvertGenericMessageToJson(
+          value, message.GetReflection()->GetMessage(message, field_descriptor, nullptr), options);
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE: {
+      value = message.GetReflection()->GetDouble(message, field_descriptor);
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT: {
+      value = message.GetReflection()->GetFloat(message, field_descriptor);
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_BOOL: {
+      value = message.GetReflection()->GetBool(message, field_descriptor);
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: {
+      value = message.GetReflection()->GetEnumValue(message, field_descriptor);
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
+void ConvertListFieldToJson(nlohmann::json &value,
+                            const google::protobuf::Message &message,
+                            const google::protobuf::FieldDescriptor *field_descriptor,
+                            const OtlpJsonOptions &options)
+{
+  auto field_size = message.GetReflection()->FieldSize(message, field_descriptor);
+
+  switch (field_descriptor->cpp_type())
+  {
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT32: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        value.push_back(message.GetReflection()->GetRepeatedInt32(message, field_descriptor, i));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT64: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded
+        // as decimal strings, and either numbers or strings are accepted when decoding.
+        value.push_back(std::to_string(
+            message.GetReflection()->GetRepeatedInt64(message, field_descriptor, i)));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT32: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        value.push_back(message.GetReflection()->GetRepeatedUInt32(message, field_descriptor, i));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT64: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded
+        // as decimal strings, and either numbers or strings are accepted when decoding.
+        value.push_back(std::to_string(
+            message.GetReflection()->GetRepeatedUInt64(message, field_descriptor, i)));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_STRING: {
+      std::string empty;
+      if (field_descriptor->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
+      {
+        for (int i = 0; i < field_size; ++i)
+        {
+          value.push_back(BytesMapping(message.GetReflection()->GetRepeatedStringReference(
+                                           message, field_descriptor, i, &empty),
+                                       field_descriptor, options.json_bytes_mapping));
+        }
+      }
+      else
+      {
+        for (int i = 0; i < field_size; ++i)
+        {
+          value.push_back(message.GetReflection()->GetRepeatedStringReference(
+              message, field_descriptor, i, &empty));
+        }
+      }
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        nlohmann::json sub_value;
+        ConvertGenericMessageToJson(
+            sub_value, message.GetReflection()->GetRepeatedMessage(message, field_descriptor, i),
+            options);
+        value.push_back(std::move(sub_value));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        value.push_back(message.GetReflection()->GetRepeatedDouble(message, field_descriptor, i));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        value.push_back(message.GetReflection()->GetRepeatedFloat(message, field_descriptor, i));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_BOOL: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        value.push_back(message.GetReflection()->GetRepeatedBool(message, field_descriptor, i));
+      }
+
+      break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: {
+      for (int i = 0; i < field_size; ++i)
+      {
+        value.push_back(
+            message.GetReflection()->GetRepeatedEnumValue(message, field_descriptor, i));
+      }
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
+/**
+ * Writes JSON tokens into a byte buffer. Commas are inserted between the members of objects and
+ * the elements of arrays.
+ */
+class JsonWriter
+{
+public:
+  JsonWriter(std::vector<uint8_t> &output, JsonBytesMappingKind json_bytes_mapping)
+      : output_(output), json_bytes_mapping_(json_bytes_mapping)
+  {}
+
+  void BeginObject()
+  {
+    BeginValue();
+    Put('{');
+    need_comma_ = false;
+  }
+
+  void EndObject()
+  {
+    Put('}');
+    need_comma_ = true;
+  }
+
+  void BeginArray()
+  {
+    BeginValue();
+    Put('[');
+    need_comma_ = false;
+  }
+
+  void EndArray()
+  {
+    Put(']');
+    need_comma_ = true;
+  }
+
+  // Keys are field names, which never need to be escaped.
+  void Key(const char *key)
+  {
+    BeginValue();
+    Put('"');
+    Append(key, std::strlen(key));
+    Put('"');
+    Put(':');
+    need_comma_ = false;
+  }
+
+  void String(const std::string &value)
+  {
+    BeginValue();
+    AppendEscaped(value);
+    need_comma_ = true;
+  }
+
+  void Bool(bool value)
+  {
+    BeginValue();
+    value ? Append("true", 4) : Append("false", 5);
+    need_comma_ = true;
+  }
+
+  void Int(int64_t value)
+  {
+    BeginValue();
+    AppendInt(value);
+    need_comma_ = true;
+  }
+
+  // According to Protobuf specs 64-bit integer numbers in JSON-encoded payloads are encoded as
+  // decimal strings, and either numbers or strings are accepted when decoding.
+  void Int64(int64_t value)
+  {
+    BeginValue();
+    Put('"');
+    AppendInt(value);
+    Put('"');
+    need_comma_ = true;
+  }
+
+  void Uint64(uint64_t value)
+  {
+    BeginValue();
+    Put('"');
+    AppendUint(value);
+    Put('"');
+    need_comma_ = true;
+  }
+
+  void Double(double value)
+  {
+    BeginValue();
+    if (!std::isfinite(value))
+    {
+      // Same as nlohmann::json
+      Append("null", 4);
+    }
+    else
+    {
+      // The shortest representation which reads back to the same value, formatted like
+      // nlohmann::json does and independently of the locale.
+      char buffer[64];
+      char *end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value);
+      Append(buffer, static_cast<std::size_t>(end - buffer));
+    }
+    need_comma_ = true;
+  }
+
+  void Bytes(const std::string &value, bool is_id)
+  {
+    BeginValue();
+    Put('"');
+    if (json_bytes_mapping_ == JsonBytesMappingKind::kHex ||
+        (json_bytes_mapping_ == JsonBytesMappingKind::kHexId && is_id))
+    {
+      static const char kHexDigits[] = "0123456789abcdef";
+      for (char c : value)
+      {
+        unsigned char byte = static_cast<unsigned char>(c);
+        Put(kHexDigits[byte >> 4]);
+        Put(kHexDigits[byte & 0x0f]);
+      }
+    }
+    else
+    {
+      opentelemetry::sdk::common::Base64Escape(value, &base64_buffer_);
+      Append(base64_buffer_.data(), base64_buffer_.size());
+    }
+    Put('"');
+    need_comma_ = true;
+  }
+
+private:
+  void BeginValue()
+  {
+    if (need_comma_)
+    {
+      Put(',');
+    }
+  }
+
+  void Put(char c) { output_.push_back(static_cast<uint8_t>(c)); }
+
+  void Append(const char *data, std::size_t size)
+  {
+    output_.insert(output_.end(), reinterpret_cast<const uint8_t *>(data),
+                   reinterpret_cast<const uint8_t *>(data) + size);
+  }
+
+  void AppendRange(const unsigned char *begin, const unsigned char *end)
+  {
+    output_.insert(output_.end(), begin, end);
+  }
+
+  void AppendUint(uint64_t value)
+  {
+    char buffer[20];
+    char *end = buffer + sizeof(buffer);
+    char *begin = end;
+    do
+    {
+      *--begin = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value != 0);
+    Append(begin, static_cast<std::size_t>(end - begin));
+  }
+
+  void AppendInt(int64_t value)
+  {
+    if (value < 0)
+    {
+      Put('-');
+      AppendUint(0 - static_cast<uint64_t>(value));
+    }
+    else
+    {
+      AppendUint(static_cast<uint64_t>(value));
+    }
+  }
+
+  // Returns the length of the UTF-8 sequence at the beginning of [begin, end), and whether it is
+  // valid. An invalid sequence spans its longest valid prefix, or the first byte, which are
+  // replaced together.
+  static std::size_t GetUtf8SequenceLength(const unsigned char *begin,
+                                           const unsigned char *end,
+                                           bool &valid)
+  {
+    unsigned char lead = begin[0];
+    std::size_t length;
+    unsigned char min = 0x80;
+    unsigned char max = 0xbf;
+    valid             = false;
+    if (lead >= 0xc2 && lead <= 0xdf)
+    {
+      length = 2;
+    }
+    else if (lead >= 0xe0 && lead <= 0xef)
+    {
+      length = 3;
+      min    = lead == 0xe0 ? 0xa0 : 0x80;  // overlong
+      max    = lead == 0xed ? 0x9f : 0xbf;  // surrogates
+    }
+    else if (lead >= 0xf0 && lead <= 0xf4)
+    {
+      length = 4;
+      min    = lead == 0xf0 ? 0x90 : 0x80;  // overlong
+      max    = lead == 0xf4 ? 0x8f : 0xbf;  // above U+10FFFF
+    }
+    else
+    {
+      return 1;
+    }
+    std::size_t i = 1;
+    for (; i < length && begin + i < end && begin[i] >= min && begin[i] <= max; i++)
+    {
+      min = 0x80;
+      max = 0xbf;
+    }
+    valid = i == length;
+    return i;
+  }
+
+  // Writes a quoted string. Invalid UTF-8 sequences are replaced with U+FFFD, as
+  // nlohmann::json does with error_handler_t::replace.
+  void AppendEscaped(const std::string &value)
+  {
+    static const char kHexDigits[] = "0123456789abcdef";
+    const unsigned char *current   = reinterpret_cast<const unsigned char *>(value.data());
+    const unsigned char *end       = current + value.size();
+    // Start of the bytes which are copied as-is
+    const unsigned char *unescaped = current;
+
+    Put('"');
+    while (current < end)
+    {
+      unsigned char c = *current;
+      if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\')
+      {
+        ++current;
+        continue;
+      }
+      bool valid         = false;
+      std::size_t length = c < 0x80 ? 1 : GetUtf8SequenceLength(current, end, valid);
+      if (valid)
+      {
+        current += length;
+        continue;
+      }
+
+      AppendRange(unescaped, current);
+      switch (c)
+      {
+        case '"':
+          Append("\\\"", 2);
+          break;
+        case '\\':
+          Append("\\\\", 2);
+          break;
+        case '\b':
+          Append("\\b", 2);
+          break;
+        case '\f':
+          Append("\\f", 2);
+          break;
+        case '\n':
+          Append("\\n", 2);
+          break;
+        case '\r':
+          Append("\\r", 2);
+          break;
+        case '\t':
+          Append("\\t", 2);
+          break;
+        default:
+          if (c < 0x20)
+          {
+            Append("\\u00", 4);
+            Put(kHexDigits[c >> 4]);
+            Put(kHexDigits[c & 0x0f]);
+          }
+          else
+          {
+            Append("\xef\xbf\xbd", 3);
+          }
+          break;
+      }
+      current += length;
+      unescaped = current;
+    }
+    AppendRange(unescaped, current);
+    Put('"');
+  }
+
+  std::vector<uint8_t> &output_;
+  JsonBytesMappingKind json_bytes_mapping_;
+  bool need_comma_ = false;
+  std::string base64_buffer_;
+};
+
+// Fields are only written when they are set, like the reflection API lists them: proto3 scalars
+// when they are not zero or empty, messages when present, repeated fields when not empty.
+
+void WriteString(JsonWriter &writer, const char *key, const std::string &value)
+{
+  if (!value.empty())
+  {
+    writer.Key(key);
+    writer.String(value);
+  }
+}
+
+void WriteId(JsonWriter &writer, const char *key, const std::string &value)
+{
+  if (!value.empty())
+  {
+    writer.Key(key);
+    writer.Bytes(value, true);
+  }
+}
+
+void WriteInt(JsonWriter &writer, const char *key, int64_t value)
+{
+  if (value != 0)
+  {
+    writer.Key(key);
+    writer.Int(value);
+  }
+}
+
+void WriteUint64(JsonWriter &writer, const char *key, uint64_t value)
+{
+  if (value != 0)
+  {
+    writer.Key(key);
+    writer.Uint64(value);
+  }
+}
+
+void WriteDouble(JsonWriter &writer, const char *key, double value)
+{
+  if (value != 0)
+  {
+    writer.Key(key);
+    writer.Double(value);
+  }
+}
+
+template <class ValueType, class WriteFunction>
+void WriteArray(JsonWriter &writer,
+                const char *key,
+                const google::protobuf::RepeatedPtrField<ValueType> &values,
+                WriteFunction write)
+{
+  if (values.size() == 0)
+  {
+    return;
+  }
+  writer.Key(key);
+  writer.BeginArray();
+  for (const auto &value : values)
+  {
+    write(writer, value);
+  }
+  writer.EndArray();
+}
+
+void WriteKeyValue(JsonWriter &writer, const proto::common::v1::KeyValue &key_value);
+
+void WriteAnyValue(JsonWriter &writer, const proto::common::v1::AnyValue &any_value)
+{
+  writer.BeginObject();
+  switch (any_value.value_case())
+  {
+    case proto::common::v1::AnyValue::kStringValue:
+      writer.Key("stringValue");
+      writer.String(any_value.string_value());
+      break;
+    case proto::common::v1::AnyValue::kBoolValue:
+      writer.Key("boolValue");
+      writer.Bool(any_value.bool_value());
+      break;
+    case proto::common::v1::AnyValue::kIntValue:
+      writer.Key("intValue");
+      writer.Int64(any_value.int_value());
+      break;
+    case proto::common::v1::AnyValue::kDoubleValue:
+      writer.Key("doubleValue");
+      writer.Double(any_value.double_value());
+      break;
+    case proto::common::v1::AnyValue::kArrayValue:
+      writer.Key("arrayValue");
+      writer.BeginObject();
+      WriteArray(writer, "values", any_value.array_value().values(), WriteAnyValue);
+      writer.EndObject();
+      break;
+    case proto::common::v1::AnyValue::kKvlistValue:
+      writer.Key("kvlistValue");
+      writer.BeginObject();
+      WriteArray(writer, "values", any_value.kvlist_value().values(), WriteKeyValue);
+      writer.EndObject();
+      break;
+    case proto::common::v1::AnyValue::kBytesValue:
+      writer.Key("bytesValue");
+      writer.Bytes(any_value.bytes_value(), false);
+      break;
+    default:
+      break;
+  }
+  writer.EndObject();
+}
+
+void WriteKeyValue(JsonWriter &writer, const proto::common::v1::KeyValue &key_value)
+{
+  writer.BeginObject();
+  WriteString(writer, "key", key_value.key());
+  if (key_value.has_value())
+  {
+    writer.Key("value");
+    WriteAnyValue(writer, key_value.value());
+  }
+  writer.EndObject();
+}
+
+void WriteResource(JsonWriter &writer, const proto::resource::v1::Resource &resource)
+{
+  writer.BeginObject();
+  WriteArray(writer, "attributes", resource.attributes(), WriteKeyValue);
+  WriteInt(writer, "droppedAttributesCount", resource.dropped_attributes_count());
+  writer.EndObject();
+}
+
+void WriteInstrumentationScope(JsonWriter &writer,
+                               const proto::common::v1::InstrumentationScope &scope)
+{
+  writer.BeginObject();
+  WriteString(writer, "name", scope.name());
+  WriteString(writer, "version", scope.version());
+  WriteArray(writer, "attributes", scope.attributes(), WriteKeyValue);
+  WriteInt(writer, "droppedAttributesCount", scope.dropped_attributes_count());
+  writer.EndObject();
+}
+
+// ----------------------------- Traces ------------------------------
+
+void WriteSpanEvent(JsonWriter &writer, const proto::trace::v1::Span::Event &event)
+{
+  writer.BeginObject();
+  WriteUint64(writer, "timeUnixNano", event.time_unix_nano());
+  WriteString(writer, "name", event.name());
+  WriteArray(writer, "attributes", event.attributes(), WriteKeyValue);
+  WriteInt(writer, "droppedAttributesCount", event.dropped_attributes_count());
+  writer.EndObject();
+}
+
+void WriteSpanLink(JsonWriter &writer, const proto::trace::v1::Span::Link &link)
+{
+  writer.BeginObject();
+  WriteId(writer, "traceId", link.trace_id());
+  WriteId(writer, "spanId", link.span_id());
+  WriteString(writer, "traceState", link.trace_state());
+  WriteArray(writer, "attributes", link.attributes(), WriteKeyValue);
+  WriteInt(writer, "droppedAttributesCount", link.dropped_attributes_count());
+  writer.EndObject();
+}
+
+void WriteSpan(JsonWriter &writer, const proto::trace::v1::Span &span)
+{
+  writer.BeginObject();
+  WriteId(writer, "traceId", span.trace_id());
+  WriteId(writer, "spanId", span.span_id());
+  WriteString(writer, "traceState", span.trace_state());
+  WriteId(writer, "parentSpanId", span.parent_span_id());
+  WriteString(writer, "name", span.name());
+  WriteInt(writer, "kind", span.kind());
+  WriteUint64(writer, "startTimeUnixNano", span.start_time_unix_nano());
+  WriteUint64(writer, "endTimeUnixNano", span.end_time_unix_nano());
+  WriteArray(writer, "attributes", span.attributes(), WriteKeyValue);
+  WriteInt(writer, "droppedAttributesCount", span.dropped_attributes_count());
+  WriteArray(writer, "events", span.events(), WriteSpanEvent);
+  WriteInt(writer, "droppedEventsCount", span.dropped_events_count());
+  WriteArray(writer, "links", span.links(), WriteSpanLink);
+  WriteInt(writer, "droppedLinksCount", span.dropped_links_count());
+  if (span.has_status())
+  {
+    writer.Key("status");
+    writer.BeginObject();
+    WriteString(writer, "message", span.status().message());
+    WriteInt(writer, "code", span.status().code());
+    writer.EndObject();
+  }
+  writer.EndObject();
+}
+
+void WriteScopeSpans(JsonWriter &writer, const proto::trace::v1::ScopeSpans &scope_spans)
+{
+  writer.BeginObject();
+  if (scope_spans.has_scope())
+  {
+    writer.Key("scope");
+    WriteInstrumentationScope(writer, scope_spans.scope());
+  }
+  WriteArray(writer, "spans", scope_spans.spans(), WriteSpan);
+  WriteString(writer, "schemaUrl", scope_spans.schema_url());
+  writer.EndObject();
+}
+
+void WriteResourceSpans(JsonWriter &writer, const proto::trace::v1::ResourceSpans &resource_spans)
+{
+  writer.BeginObject();
+  if (resource_spans.has_resource())
+  {
+    writer.Key("resource");
+    WriteResource(writer, resource_spans.resource());
+  }
+  WriteArray(writer, "scopeSpans", resource_spans.scope_spans(), WriteScopeSpans);
+  WriteString(writer, "schemaUrl", resource_spans.schema_url());
+  writer.EndObject();
+}
+
+// ----------------------------- Logs ------------------------------
+
+void WriteLogRecord(JsonWriter &writer, const proto::logs::v1::LogRecord &log_record)
+{
+  writer.BeginObject();
+  WriteUint64(writer, "timeUnixNano", log_record.time_unix_nano());
+  WriteUint64(writer, "observedTimeUnixNano", log_record.observed_time_unix_nano());
+  WriteInt(writer, "severityNumber", log_record.severity_number());
+  WriteString(writer, "severityText", log_record.severity_text());
+  if (log_record.has_body())
+  {
+    writer.Key("body");
+    WriteAnyValue(writer, log_record.body());
+  }
+  WriteArray(writer, "attributes", log_record.attributes(), WriteKeyValue);
+  WriteInt(writer, "droppedAttributesCount", log_record.dropped_attributes_count());
+  WriteInt(writer, "flags", log_record.flags());
+  WriteId(writer, "traceId", log_record.trace_id());
+  WriteId(writer, "spanId", log_record.span_id());
+  writer.EndObject();
+}
+
+void WriteScopeLogs(JsonWriter &writer, const proto::logs::v1::ScopeLogs &scope_logs)
+{
+  writer.BeginObject();
+  if (scope_logs.has_scope())
+  {
+    writer.Key("scope");
+    WriteInstrumentationScope(writer, scope_logs.scope());
+  }
+  WriteArray(writer, "logRecords", scope_logs.log_records(), WriteLogRecord);
+  WriteString(writer, "schemaUrl", scope_logs.schema_url());
+  writer.EndObject();
+}
+
+void WriteResourceLogs(JsonWriter &writer, const proto::logs::v1::ResourceLogs &resource_logs)
+{
+  writer.BeginObject();
+  if (resource_logs.has_resource())
+  {
+    writer.Key("resource");
+    WriteResource(writer, resource_logs.resource());
+  }
+  WriteArray(writer, "scopeLogs", resource_logs.scope_logs(), WriteScopeLogs);
+  WriteString(writer, "schemaUrl", resource_logs.schema_url());
+  writer.EndObject();
+}
+
+// ----------------------------- Metrics ------------------------------
+
+void WriteExemplar(JsonWriter &writer, const proto::metrics::v1::Exemplar &exemplar)
+{
+  writer.BeginObject();
+  WriteArray(writer, "filteredAttributes", exemplar.filtered_attributes(), WriteKeyValue);
+  WriteUint64(writer, "timeUnixNano", exemplar.time_unix_nano());
+  if (exemplar.value_case() == proto::metrics::v1::Exemplar::kAsDouble)
+  {
+    writer.Key("asDouble");
+    writer.Double(exemplar.as_double());
+  }
+  else if (exemplar.value_case() == proto::metrics::v1::Exemplar::kAsInt)
+  {
+    writer.Key("asInt");
+    writer.Int64(exemplar.as_int());
+  }
+  WriteId(writer, "spanId", exemplar.span_id());
+  WriteId(writer, "traceId", exemplar.trace_id());
+  writer.EndObject();
+}
+
+void WriteNumberDataPoint(JsonWriter &writer, const proto::metrics::v1::NumberDataPoint &point)
+{
+  writer.BeginObject();
+  WriteArray(writer, "attributes", point.attributes(), WriteKeyValue);
+  WriteUint64(writer, "startTimeUnixNano", point.start_time_unix_nano());
+  WriteUint64(writer, "timeUnixNano", point.time_unix_nano());
+  if (point.value_case() == proto::metrics::v1::NumberDataPoint::kAsDouble)
+  {
+    writer.Key("asDouble");
+    writer.Double(point.as_double());
+  }
+  else if (point.value_case() == proto::metrics::v1::NumberDataPoint::kAsInt)
+  {
+    writer.Key("asInt");
+    writer.Int64(point.as_int());
+  }
+  WriteArray(writer, "exemplars", point.exemplars(), WriteExemplar);
+  WriteInt(writer, "flags", point.flags());
+  writer.EndObject();
+}
+
+void WriteHistogramDataPoint(JsonWriter &writer,
+                             const proto::metrics::v1::HistogramDataPoint &point)
+{
+  writer.BeginObject();
+  WriteArray(writer, "attributes", point.attributes(), WriteKeyValue);
+  WriteUint64(writer, "startTimeUnixNano", point.start_time_unix_nano());
+  WriteUint64(writer, "timeUnixNano", point.time_unix_nano());
+  WriteUint64(writer, "count", point.count());
+  if (point.has_sum())
+  {
+    writer.Key("sum");
+    writer.Double(point.sum());
+  }
+  if (point.bucket_counts_size() > 0)
+  {
+    writer.Key("bucketCounts");
+    writer.BeginArray();
+    for (auto count : point.bucket_counts())
+    {
+      writer.Uint64(count);
+    }
+    writer.EndArray();
+  }
+  if (point.explicit_bounds_size() > 0)
+  {
+    writer.Key("explicitBounds");
+    writer.BeginArray();
+    for (auto bound : point.explicit_bounds())
+    {
+      writer.Double(bound);
+    }
+    writer.EndArray();
+  }
+  WriteArray(writer, "exemplars", point.exemplars(), WriteExemplar);
+  WriteInt(writer, "flags", point.flags());
+  if (point.has_min())
+  {
+    writer.Key("min");
+    writer.Double(point.min());
+  }
+  if (point.has_max())
+  {
+    writer.Key("max");
+    writer.Double(point.max());
+  }
+  writer.EndObject();
+}
+
+void WriteExponentialHistogramBuckets(
+    JsonWriter &writer,
+    const char *key,
+    const proto::metrics::v1::ExponentialHistogramDataPoint::Buckets &buckets)
+{
+  writer.Key(key);
+  writer.BeginObject();
+  WriteInt(writer, "offset", buckets.offset());
+  if (buckets.bucket_counts_size() > 0)
+  {
+    writer.Key("bucketCounts");
+    writer.BeginArray();
+    for (auto count : buckets.bucket_counts())
+    {
+      writer.Uint64(count);
+    }
+    writer.EndArray();
+  }
+  writer.EndObject();
+}
+
+void WriteExponentialHistogramDataPoint(
+    JsonWriter &writer,
+    const proto::metrics::v1::ExponentialHistogramDataPoint &point)
+{
+  writer.BeginObject();
+  WriteArray(writer, "attributes", point.attributes(), WriteKeyValue);
+  WriteUint64(writer, "startTimeUnixNano", point.start_time_unix_nano());
+  WriteUint64(writer, "timeUnixNano", point.time_unix_nano());
+  WriteUint64(writer, "count", point.count());
+  if (point.has_sum())
+  {
+    writer.Key("sum");
+    writer.Double(point.sum());
+  }
+  WriteInt(writer, "scale", point.scale());
+  WriteUint64(writer, "zeroCount", point.zero_count());
+  if (point.has_positive())
+  {
+    WriteExponentialHistogramBuckets(writer, "positive", point.positive());
+  }
+  if (point.has_negative())
+  {
+    WriteExponentialHistogramBuckets(writer, "negative", point.negative());
+  }
+  WriteInt(writer, "flags", point.flags());
+  WriteArray(writer, "exemplars", point.exemplars(), WriteExemplar);
+  if (point.has_min())
+  {
+    writer.Key("min");
+    writer.Double(point.min());
+  }
+  if (point.has_max())
+  {
+    writer.Key("max");
+    writer.Double(point.max());
+  }
+  WriteDouble(writer, "zeroThreshold", point.zero_threshold());
+  writer.EndObject();
+}
+
+void WriteValueAtQuantile(JsonWriter &writer,
+                          const proto::metrics::v1::SummaryDataPoint::ValueAtQuantile &value)
+{
+  writer.BeginObject();
+  WriteDouble(writer, "quantile", value.quantile());
+  WriteDouble(writer, "value", value.value());
+  writer.EndObject();
+}
+
+void WriteSummaryDataPoint(JsonWriter &writer, const proto::metrics::v1::SummaryDataPoint &point)
+{
+  writer.BeginObject();
+  WriteArray(writer, "attributes", point.attributes(), WriteKeyValue);
+  WriteUint64(writer, "startTimeUnixNano", point.start_time_unix_nano());
+  WriteUint64(writer, "timeUnixNano", point.time_unix_nano());
+  WriteUint64(writer, "count", point.count());
+  WriteDouble(writer, "sum", point.sum());
+  WriteArray(writer, "quantileValues", point.quantile_values(), WriteValueAtQuantile);
+  WriteInt(writer, "flags", point.flags());
+  writer.EndObject();
+}
+
+void WriteMetric(JsonWriter &writer, const proto::metrics::v1::Metric &metric)
+{
+  writer.BeginObject();
+  WriteString(writer, "name", metric.name());
+  WriteString(writer, "description", metric.description());
+  WriteString(writer, "unit", metric.unit());
+  switch (metric.data_case())
+  {
+    case proto::metrics::v1::Metric::kGauge:
+      writer.Key("gauge");
+      writer.BeginObject();
+      WriteArray(writer, "dataPoints", metric.gauge().data_points(), WriteNumberDataPoint);
+      writer.EndObject();
+      break;
+    case proto::metrics::v1::Metric::kSum:
+      writer.Key("sum");
+      writer.BeginObject();
+      WriteArray(writer, "dataPoints", metric.sum().data_points(), WriteNumberDataPoint);
+      WriteInt(writer, "aggregationTemporality", metric.sum().aggregation_temporality());
+      if (metric.sum().is_monotonic())
+      {
+        writer.Key("isMonotonic");
+        writer.Bool(true);
+      }
+      writer.EndObject();
+      break;
+    case proto::metrics::v1::Metric::kHistogram:
+      writer.Key("histogram");
+      writer.BeginObject();
+      WriteArray(writer, "dataPoints", metric.histogram().data_points(), WriteHistogramDataPoint);
+      WriteInt(writer, "aggregationTemporality", metric.histogram().aggregation_temporality());
+      writer.EndObject();
+      break;
+    case proto::metrics::v1::Metric::kExponentialHistogram:
+      writer.Key("exponentialHistogram");
+      writer.BeginObject();
+      WriteArray(writer, "dataPoints", metric.exponential_histogram().data_points(),
+                 WriteExponentialHistogramDataPoint);
+      WriteInt(writer, "aggregationTemporality",
+               metric.exponential_histogram().aggregation_temporality());
+      writer.EndObject();
+      break;
+    case proto::metrics::v1::Metric::kSummary:
+      writer.Key("summary");
+      writer.BeginObject();
+      WriteArray(writer, "dataPoints", metric.summary().data_points(), WriteSummaryDataPoint);
+      writer.EndObject();
+      break;
+    default:
+      break;
+  }
+  writer.EndObject();
+}
+
+void WriteScopeMetrics(JsonWriter &writer, const proto::metrics::v1::ScopeMetrics &scope_metrics)
+{
+  writer.BeginObject();
+  if (scope_metrics.has_scope())
+  {
+    writer.Key("scope");
+    WriteInstrumentationScope(writer, scope_metrics.scope());
+  }
+  WriteArray(writer, "metrics", scope_metrics.metrics(), WriteMetric);
+  WriteString(writer, "schemaUrl", scope_metrics.schema_url());
+  writer.EndObject();
+}
+
+void WriteResourceMetrics(JsonWriter &writer,
+                          const proto::metrics::v1::ResourceMetrics &resource_metrics)
+{
+  writer.BeginObject();
+  if (resource_metrics.has_resource())
+  {
+    writer.Key("resource");
+    WriteResource(writer, resource_metrics.resource());
+  }
+  WriteArray(writer, "scopeMetrics", resource_metrics.scope_metrics(), WriteScopeMetrics);
+  WriteString(writer, "schemaUrl", resource_metrics.schema_url());
+  writer.EndObject();
+}
+
+}  // namespace
+
+void OtlpJsonWriter::Write(const google::protobuf::Message &message,
+                           const OtlpJsonOptions &options,
+                           std::vector<uint8_t> &output)
+{
+  // The json names of the OTLP fields are the same as their camel case names, so use_json_name
+  // does not change the output.
+  const google::protobuf::Descriptor *descriptor = message.GetDescriptor();
+  JsonWriter writer(output, options.json_bytes_mapping);
+  if (descriptor == proto::collector::trace::v1::ExportTraceServiceRequest::descriptor())
+  {
+    writer.BeginObject();
+    WriteArray(
+        writer, "resourceSpans",
+        static_cast<const proto::collector::trace::v1::ExportTraceServiceRequest &>(message)
+            .resource_spans(),
+        WriteResourceSpans);
+    writer.EndObject();
+  }
+  else if (descriptor == proto::collector::metrics::v1::ExportMetricsServiceRequest::descriptor())
+  {
+    writer.BeginObject();
+    WriteArray(
+        writer, "resourceMetrics",
+        static_cast<const proto::collector::metrics::v1::ExportMetricsServiceRequest &>(message)
+            .resource_metrics(),
+        WriteResourceMetrics);
+    writer.EndObject();
+  }
+  else if (descriptor == proto::collector::logs::v1::ExportLogsServiceRequest::descriptor())
+  {
+    writer.BeginObject();
+    WriteArray(writer, "resourceLogs",
+               static_cast<const proto::collector::logs::v1::ExportLogsServiceRequest &>(message)
+                   .resource_logs(),
+               WriteResourceLogs);
+    writer.EndObject();
+  }
+  else
+  {
+    WriteWithReflection(message, options, output);
+  }
+}
+
+void OtlpJsonWriter::WriteWithReflection(const google::protobuf::Message &message,
+                                         const OtlpJsonOptions &options,
+                                         std::vector<uint8_t> &output)
+{
+  nlohmann::json json_request;
+
+  // Convert from proto into json object
+  ConvertGenericMessageToJson(json_request, message, options);
+
+  std::string json =
+      json_request.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
+  output.insert(output.end(), json.begin(), json.end());
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
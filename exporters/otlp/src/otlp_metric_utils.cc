@@ -41,6 +41,11 @@ metric_sdk::AggregationType OtlpMetricUtils::GetAggregationType(
   {
     return metric_sdk::AggregationType::kHistogram;
   }
+  else if (nostd::holds_alternative<sdk::metrics::ExponentialHistogramPointData>(
+               point_data_with_attributes.point_data))
+  {
+    return metric_sdk::AggregationType::kBase2ExponentialHistogram;
+  }
   else if (nostd::holds_alternative<sdk::metrics::LastValuePointData>(
                point_data_with_attributes.point_data))
   {
@@ -154,6 +159,55 @@ void OtlpMetricUtils::ConvertHistogramMetric(
   }
 }
 
+void OtlpMetricUtils::ConvertExponentialHistogramMetric(
+    const metric_sdk::MetricData &metric_data,
+    proto::metrics::v1::ExponentialHistogram *const histogram) noexcept
+{
+  histogram->set_aggregation_temporality(
+      GetProtoAggregationTemporality(metric_data.aggregation_temporality));
+  auto start_ts = metric_data.start_ts.time_since_epoch().count();
+  auto ts       = metric_data.end_ts.time_since_epoch().count();
+  for (auto &point_data_with_attributes : metric_data.point_data_attr_)
+  {
+    proto::metrics::v1::ExponentialHistogramDataPoint *proto_histogram_point_data =
+        histogram->add_data_points();
+    proto_histogram_point_data->set_start_time_unix_nano(start_ts);
+    proto_histogram_point_data->set_time_unix_nano(ts);
+    auto histogram_data = nostd::get<sdk::metrics::ExponentialHistogramPointData>(
+        point_data_with_attributes.point_data);
+    // sum, count
+    proto_histogram_point_data->set_sum(histogram_data.sum_);
+    proto_histogram_point_data->set_count(histogram_data.count_);
+    if (histogram_data.record_min_max_)
+    {
+      proto_histogram_point_data->set_min(histogram_data.min_);
+      proto_histogram_point_data->set_max(histogram_data.max_);
+    }
+    // buckets
+    proto_histogram_point_data->set_scale(histogram_data.scale_);
+    proto_histogram_point_data->set_zero_count(histogram_data.zero_count_);
+    proto_histogram_point_data->set_zero_threshold(histogram_data.zero_threshold_);
+    auto positive = proto_histogram_point_data->mutable_positive();
+    positive->set_offset(histogram_data.positive_buckets_.offset_);
+    for (auto bucket_value : histogram_data.positive_buckets_.counts_)
+    {
+      positive->add_bucket_counts(bucket_value);
+    }
+    auto negative = proto_histogram_point_data->mutable_negative();
+    negative->set_offset(histogram_data.negative_buckets_.offset_);
+    for (auto bucket_value : histogram_data.negative_buckets_.counts_)
+    {
+      negative->add_bucket_counts(bucket_value);
+    }
+    // attributes
+    for (auto &kv_attr : point_data_with_attributes.attributes)
+    {
+      OtlpPopulateAttributeUtils::PopulateAttribute(proto_histogram_point_data->add_attributes(),
+                                                    kv_attr.first, kv_attr.second);
+    }
+  }
+}
+
 void OtlpMetricUtils::ConvertGaugeMetric(const opentelemetry::sdk::metrics::MetricData &metric_data,
                                          proto::metrics::v1::Gauge *const gauge) noexcept
 {
@@ -202,6 +256,10 @@ void OtlpMetricUtils::PopulateInstrumentInfoMetrics(
       ConvertHistogramMetric(metric_data, metric->mutable_histogram());
       break;
     }
+    case metric_sdk::AggregationType::kBase2ExponentialHistogram: {
+      ConvertExponentialHistogramMetric(metric_data, metric->mutable_exponential_histogram());
+      break;
+    }
     case metric_sdk::AggregationType::kLastValue: {
       ConvertGaugeMetric(metric_data, metric->mutable_gauge());
       break;
@@ -213,10 +271,17 @@ void OtlpMetricUtils::PopulateInstrumentInfoMetrics(
 
 void OtlpMetricUtils::PopulateResourceMetrics(
     const opentelemetry::sdk::metrics::ResourceMetrics &data,
-    proto::metrics::v1::ResourceMetrics *resource_metrics) noexcept
+    proto::metrics::v1::ResourceMetrics *resource_metrics,
+    OtlpResourceCache *cache) noexcept
 {
-  OtlpPopulateAttributeUtils::PopulateAttribute(resource_metrics->mutable_resource(),
-                                                *(data.resource_));
+  if (cache)
+  {
+    cache->PopulateResource(*(data.resource_), resource_metrics->mutable_resource());
+  }
+  else
+  {
+    OtlpResourceCache::ConvertResource(*(data.resource_), resource_metrics->mutable_resource());
+  }
 
   for (auto &scope_metrics : data.scope_metric_data_)
   {
@@ -226,8 +291,14 @@ void OtlpMetricUtils::PopulateResourceMetrics(
     }
     auto scope_lib_metrics                         = resource_metrics->add_scope_metrics();
     proto::common::v1::InstrumentationScope *scope = scope_lib_metrics->mutable_scope();
-    scope->set_name(scope_metrics.scope_->GetName());
-    scope->set_version(scope_metrics.scope_->GetVersion());
+    if (cache)
+    {
+      cache->PopulateInstrumentationScope(*scope_metrics.scope_, scope);
+    }
+    else
+    {
+      OtlpResourceCache::ConvertInstrumentationScope(*scope_metrics.scope_, scope);
+    }
 
     for (auto &metric_data : scope_metrics.metric_data_)
     {
@@ -238,7 +309,8 @@ void OtlpMetricUtils::PopulateResourceMetrics(
 
 void OtlpMetricUtils::PopulateRequest(
     const opentelemetry::sdk::metrics::ResourceMetrics &data,
-    proto::collector::metrics::v1::ExportMetricsServiceRequest *request) noexcept
+    proto::collector::metrics::v1::ExportMetricsServiceRequest *request,
+    OtlpResourceCache *cache) noexcept
 {
   if (request == nullptr || data.resource_ == nullptr)
   {
@@ -246,7 +318,7 @@ void OtlpMetricUtils::PopulateRequest(
   }
 
   auto resource_metrics = request->add_resource_metrics();
-  PopulateResourceMetrics(data, resource_metrics);
+  PopulateResourceMetrics(data, resource_metrics, cache);
 }
 
 sdk::metrics::AggregationTemporalitySelector OtlpMetricUtils::ChooseTemporalitySelector(
@@ -11,11 +11,9 @@
 #include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
 
 #include "opentelemetry/exporters/otlp/otlp_log_recordable.h"
-#include "opentelemetry/exporters/otlp/otlp_populate_attribute_utils.h"
 #include "opentelemetry/exporters/otlp/otlp_recordable.h"
 
-#include <list>
-#include <unordered_map>
+#include <vector>
 
 namespace nostd = opentelemetry::nostd;
 
@@ -27,102 +25,157 @@ namespace otlp
 
 namespace
 {
-struct InstrumentationScopePointerHasher
+using InstrumentationScope = opentelemetry::sdk::instrumentationscope::InstrumentationScope;
+
+// The messages of a resource and an instrumentation scope in a request, and the SDK objects they
+// were populated from.
+template <class ResourceMessage, class ScopeMessage>
+struct ScopeEntry
+{
+  const opentelemetry::sdk::resource::Resource *resource;
+  const InstrumentationScope *scope;
+  ResourceMessage *resource_message;
+  ScopeMessage *scope_message;
+};
+
+// Most batches hold the records of a single resource and of a few instrumentation scopes, often in
+// runs. So the entry of a record is looked up linearly, starting with the entry of the previous
+// record, instead of grouping the records in maps first. Returns entries.size() if there is none.
+template <class Entry, class ScopeEqual>
+std::size_t FindScopeEntry(const std::vector<Entry> &entries,
+                           std::size_t last,
+                           const opentelemetry::sdk::resource::Resource *resource,
+                           const InstrumentationScope *scope,
+                           ScopeEqual scope_equal) noexcept
 {
-  std::size_t operator()(const opentelemetry::sdk::instrumentationscope::InstrumentationScope
-                             *instrumentation) const noexcept
+  if (last < entries.size() && entries[last].resource == resource &&
+      scope_equal(entries[last].scope, scope))
   {
-    return instrumentation->HashCode();
+    return last;
   }
-};
+  std::size_t index = 0;
+  while (index < entries.size() &&
+         (entries[index].resource != resource || !scope_equal(entries[index].scope, scope)))
+  {
+    ++index;
+  }
+  return index;
+}
 
-struct InstrumentationScopePointerEqual
+// Find the message of a resource among the entries, nullptr if it is not in the request yet.
+template <class ResourceMessage, class ScopeMessage>
+ResourceMessage *FindResourceMessage(
+    const std::vector<ScopeEntry<ResourceMessage, ScopeMessage>> &entries,
+    const opentelemetry::sdk::resource::Resource *resource) noexcept
 {
-  std::size_t operator()(
-      const opentelemetry::sdk::instrumentationscope::InstrumentationScope *left,
-      const opentelemetry::sdk::instrumentationscope::InstrumentationScope *right) const noexcept
+  for (auto &entry : entries)
   {
-    return *left == *right;
+    if (entry.resource == resource)
+    {
+      return entry.resource_message;
+    }
   }
-};
+  return nullptr;
+}
+
+void PopulateResource(OtlpResourceCache *cache,
+                      const opentelemetry::sdk::resource::Resource &resource,
+                      proto::resource::v1::Resource *proto_resource) noexcept
+{
+  if (cache)
+  {
+    cache->PopulateResource(resource, proto_resource);
+  }
+  else
+  {
+    OtlpResourceCache::ConvertResource(resource, proto_resource);
+  }
+}
+
+void PopulateInstrumentationScope(
+    OtlpResourceCache *cache,
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope,
+    proto::common::v1::InstrumentationScope *proto_scope) noexcept
+{
+  if (cache)
+  {
+    cache->PopulateInstrumentationScope(scope, proto_scope);
+  }
+  else
+  {
+    OtlpResourceCache::ConvertInstrumentationScope(scope, proto_scope);
+  }
+}
 }  // namespace
 
 void OtlpRecordableUtils::PopulateRequest(
     const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans,
-    proto::collector::trace::v1::ExportTraceServiceRequest *request) noexcept
+    proto::collector::trace::v1::ExportTraceServiceRequest *request,
+    OtlpResourceCache *cache) noexcept
 {
   if (nullptr == request)
   {
     return;
   }
 
-  using spans_by_scope =
-      std::unordered_map<const opentelemetry::sdk::instrumentationscope::InstrumentationScope *,
-                         std::vector<std::unique_ptr<OtlpRecordable>>>;
-  std::unordered_map<const opentelemetry::sdk::resource::Resource *, spans_by_scope> spans_index;
+  std::vector<ScopeEntry<proto::trace::v1::ResourceSpans, proto::trace::v1::ScopeSpans>> entries;
+  std::size_t last = 0;
+  auto same_scope  = [](const InstrumentationScope *left, const InstrumentationScope *right) {
+    return left == right;
+  };
 
-  // Collect spans per resource and instrumentation scope
   for (auto &recordable : spans)
   {
     auto rec = std::unique_ptr<OtlpRecordable>(static_cast<OtlpRecordable *>(recordable.release()));
     auto resource        = rec->GetResource();
     auto instrumentation = rec->GetInstrumentationScope();
 
-    spans_index[resource][instrumentation].emplace_back(std::move(rec));
-  }
-
-  // Add all resource spans
-  for (auto &input_resource_spans : spans_index)
-  {
-    // Add the resource
-    auto resource_spans = request->add_resource_spans();
-    if (input_resource_spans.first)
-    {
-      proto::resource::v1::Resource resource_proto;
-      OtlpPopulateAttributeUtils::PopulateAttribute(&resource_proto, *input_resource_spans.first);
-      *resource_spans->mutable_resource() = resource_proto;
-      resource_spans->set_schema_url(input_resource_spans.first->GetSchemaURL());
-    }
-
-    // Add all scope spans
-    for (auto &input_scope_spans : input_resource_spans.second)
+    last = FindScopeEntry(entries, last, resource, instrumentation, same_scope);
+    if (last == entries.size())
     {
-      // Add the instrumentation scope
-      auto scope_spans = resource_spans->add_scope_spans();
-      if (input_scope_spans.first)
+      // Add the resource
+      auto resource_spans = FindResourceMessage(entries, resource);
+      if (resource_spans == nullptr)
       {
-        proto::common::v1::InstrumentationScope instrumentation_scope_proto;
-        instrumentation_scope_proto.set_name(input_scope_spans.first->GetName());
-        instrumentation_scope_proto.set_version(input_scope_spans.first->GetVersion());
-        *scope_spans->mutable_scope() = instrumentation_scope_proto;
-        scope_spans->set_schema_url(input_scope_spans.first->GetSchemaURL());
+        resource_spans = request->add_resource_spans();
+        if (resource)
+        {
+          PopulateResource(cache, *resource, resource_spans->mutable_resource());
+          resource_spans->set_schema_url(resource->GetSchemaURL());
+        }
       }
 
-      // Add all spans to this scope spans
-      for (auto &input_span : input_scope_spans.second)
+      // Add the instrumentation scope
+      auto scope_spans = resource_spans->add_scope_spans();
+      if (instrumentation)
       {
-        *scope_spans->add_spans() = std::move(input_span->span());
+        PopulateInstrumentationScope(cache, *instrumentation, scope_spans->mutable_scope());
+        scope_spans->set_schema_url(instrumentation->GetSchemaURL());
       }
+      entries.push_back({resource, instrumentation, resource_spans, scope_spans});
     }
+
+    // Hand the span over to the request, which only copies the spans allocated on another arena
+    // than its own.
+    entries[last].scope_message->mutable_spans()->AddAllocated(rec->ReleaseSpan());
   }
 }
 
 void OtlpRecordableUtils::PopulateRequest(
     const nostd::span<std::unique_ptr<opentelemetry::sdk::logs::Recordable>> &logs,
-    proto::collector::logs::v1::ExportLogsServiceRequest *request) noexcept
+    proto::collector::logs::v1::ExportLogsServiceRequest *request,
+    OtlpResourceCache *cache) noexcept
 {
   if (nullptr == request)
   {
     return;
   }
 
-  using logs_index_by_instrumentation_type =
-      std::unordered_map<const opentelemetry::sdk::instrumentationscope::InstrumentationScope *,
-                         std::list<std::unique_ptr<OtlpLogRecordable>>,
-                         InstrumentationScopePointerHasher, InstrumentationScopePointerEqual>;
-  std::unordered_map<const opentelemetry::sdk::resource::Resource *,
-                     logs_index_by_instrumentation_type>
-      logs_index_by_resource;
+  std::vector<ScopeEntry<proto::logs::v1::ResourceLogs, proto::logs::v1::ScopeLogs>> entries;
+  std::size_t last = 0;
+  auto same_scope  = [](const InstrumentationScope *left, const InstrumentationScope *right) {
+    return left == right || *left == *right;
+  };
 
   for (auto &recordable : logs)
   {
@@ -131,45 +184,47 @@ void OtlpRecordableUtils::PopulateRequest(
     auto instrumentation = &rec->GetInstrumentationScope();
     auto resource        = &rec->GetResource();
 
-    logs_index_by_resource[resource][instrumentation].emplace_back(std::move(rec));
-  }
-
-  for (auto &input_resource_log : logs_index_by_resource)
-  {
-    auto output_resource_log = request->add_resource_logs();
-    for (auto &input_scope_log : input_resource_log.second)
+    last = FindScopeEntry(entries, last, resource, instrumentation, same_scope);
+    if (last == entries.size())
     {
-      auto output_scope_log = output_resource_log->add_scope_logs();
-      for (auto &input_log_record : input_scope_log.second)
+      auto resource_logs = FindResourceMessage(entries, resource);
+      if (resource_logs == nullptr)
       {
-        if (!output_resource_log->has_resource())
-        {
-          OtlpPopulateAttributeUtils::PopulateAttribute(output_resource_log->mutable_resource(),
-                                                        *input_resource_log.first);
-          output_resource_log->set_schema_url(input_resource_log.first->GetSchemaURL());
-        }
-
-        if (!output_scope_log->has_scope())
-        {
-          auto proto_scope = output_scope_log->mutable_scope();
-          if (proto_scope != nullptr)
-          {
-            proto_scope->set_name(input_scope_log.first->GetName());
-            proto_scope->set_version(input_scope_log.first->GetVersion());
-
-            for (auto &scope_attribute : input_scope_log.first->GetAttributes())
-            {
-              OtlpPopulateAttributeUtils::PopulateAttribute(
-                  proto_scope->add_attributes(), scope_attribute.first, scope_attribute.second);
-            }
-          }
-          output_scope_log->set_schema_url(input_scope_log.first->GetSchemaURL());
-        }
-
-        *output_scope_log->add_log_records() = std::move(input_log_record->log_record());
+        resource_logs = request->add_resource_logs();
+        PopulateResource(cache, *resource, resource_logs->mutable_resource());
+        resource_logs->set_schema_url(resource->GetSchemaURL());
       }
+
+      auto scope_logs = resource_logs->add_scope_logs();
+      PopulateInstrumentationScope(cache, *instrumentation, scope_logs->mutable_scope());
+      scope_logs->set_schema_url(instrumentation->GetSchemaURL());
+      entries.push_back({resource, instrumentation, resource_logs, scope_logs});
     }
+
+    // Hand the log record over to the request, which only copies the log records allocated on
+    // another arena than its own.
+    entries[last].scope_message->mutable_log_records()->AddAllocated(rec->ReleaseLogRecord());
+  }
+}
+
+std::shared_ptr<google::protobuf::Arena> OtlpRecordableUtils::GetArena(
+    const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans) noexcept
+{
+  if (spans.empty() || spans[0] == nullptr)
+  {
+    return nullptr;
+  }
+  return static_cast<const OtlpRecordable *>(spans[0].get())->GetArena();
+}
+
+std::shared_ptr<google::protobuf::Arena> OtlpRecordableUtils::GetArena(
+    const nostd::span<std::unique_ptr<opentelemetry::sdk::logs::Recordable>> &logs) noexcept
+{
+  if (logs.empty() || logs[0] == nullptr)
+  {
+    return nullptr;
   }
+  return static_cast<const OtlpLogRecordable *>(logs[0].get())->GetArena();
 }
 }  // namespace otlp
 }  // namespace exporter
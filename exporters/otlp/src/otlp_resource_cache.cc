@@ -0,0 +1,112 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
+#include "opentelemetry/exporters/otlp/otlp_populate_attribute_utils.h"
+
+#include <mutex>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+void OtlpResourceCache::PopulateResource(const opentelemetry::sdk::resource::Resource &resource,
+                                         proto::resource::v1::Resource *proto_resource) noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  proto_resource->CopyFrom(GetResourceEntry(resource).proto);
+}
+
+void OtlpResourceCache::PopulateInstrumentationScope(
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope,
+    proto::common::v1::InstrumentationScope *proto_scope) noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  proto_scope->CopyFrom(GetInstrumentationScopeEntry(scope).proto);
+}
+
+std::string OtlpResourceCache::GetSerializedResource(
+    const opentelemetry::sdk::resource::Resource &resource) noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  return GetResourceEntry(resource).serialized;
+}
+
+std::string OtlpResourceCache::GetSerializedInstrumentationScope(
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope) noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  return GetInstrumentationScopeEntry(scope).serialized;
+}
+
+OtlpResourceCache::ResourceEntry &OtlpResourceCache::GetResourceEntry(
+    const opentelemetry::sdk::resource::Resource &resource)
+{
+  auto it = resources_.find(&resource);
+  if (it != resources_.end() && it->second.schema_url == resource.GetSchemaURL() &&
+      it->second.attributes.GetAttributes() == resource.GetAttributes().GetAttributes())
+  {
+    return it->second;
+  }
+  if (it == resources_.end() && resources_.size() >= kMaxEntries)
+  {
+    resources_.clear();
+  }
+  ResourceEntry &entry = resources_[&resource];
+  entry.attributes     = resource.GetAttributes();
+  entry.schema_url     = resource.GetSchemaURL();
+  entry.proto.Clear();
+  ConvertResource(resource, &entry.proto);
+  entry.proto.SerializeToString(&entry.serialized);
+  return entry;
+}
+
+OtlpResourceCache::InstrumentationScopeEntry &OtlpResourceCache::GetInstrumentationScopeEntry(
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope)
+{
+  auto it = scopes_.find(&scope);
+  if (it != scopes_.end() &&
+      scope.equal(it->second.name, it->second.version, it->second.schema_url) &&
+      it->second.attributes.GetAttributes() == scope.GetAttributes().GetAttributes())
+  {
+    return it->second;
+  }
+  if (it == scopes_.end() && scopes_.size() >= kMaxEntries)
+  {
+    scopes_.clear();
+  }
+  InstrumentationScopeEntry &entry = scopes_[&scope];
+  entry.name                       = scope.GetName();
+  entry.version                    = scope.GetVersion();
+  entry.schema_url                 = scope.GetSchemaURL();
+  entry.attributes                 = scope.GetAttributes();
+  entry.proto.Clear();
+  ConvertInstrumentationScope(scope, &entry.proto);
+  entry.proto.SerializeToString(&entry.serialized);
+  return entry;
+}
+
+void OtlpResourceCache::ConvertResource(const opentelemetry::sdk::resource::Resource &resource,
+                                        proto::resource::v1::Resource *proto_resource) noexcept
+{
+  OtlpPopulateAttributeUtils::PopulateAttribute(proto_resource, resource);
+}
+
+void OtlpResourceCache::ConvertInstrumentationScope(
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope,
+    proto::common::v1::InstrumentationScope *proto_scope) noexcept
+{
+  proto_scope->set_name(scope.GetName());
+  proto_scope->set_version(scope.GetVersion());
+  for (auto &scope_attribute : scope.GetAttributes())
+  {
+    OtlpPopulateAttributeUtils::PopulateAttribute(proto_scope->add_attributes(),
+                                                  scope_attribute.first, scope_attribute.second);
+  }
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
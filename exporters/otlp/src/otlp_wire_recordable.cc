@@ -0,0 +1,747 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_wire_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+#include "opentelemetry/proto/common/v1/common.pb.h"
+#include "opentelemetry/proto/trace/v1/trace.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <cstring>
+#include <unordered_map>
+
+namespace nostd = opentelemetry::nostd;
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+
+using AnyValueProto = proto::common::v1::AnyValue;
+using KeyValueProto = proto::common::v1::KeyValue;
+using SpanProto     = proto::trace::v1::Span;
+
+constexpr uint32_t kWireTypeVarint          = 0;
+constexpr uint32_t kWireTypeFixed64         = 1;
+constexpr uint32_t kWireTypeLengthDelimited = 2;
+
+// Initial capacity of the encoded attributes, events and links of a span.
+constexpr std::size_t kInitialFieldsCapacity = 256;
+
+constexpr uint32_t MakeTag(int field, uint32_t wire_type)
+{
+  return (static_cast<uint32_t>(field) << 3) | wire_type;
+}
+
+std::size_t VarintSize(uint64_t value)
+{
+  std::size_t size = 1;
+  while (value >= 0x80)
+  {
+    value >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+uint8_t *WriteVarint(uint64_t value, uint8_t *target)
+{
+  while (value >= 0x80)
+  {
+    *target++ = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  *target++ = static_cast<uint8_t>(value);
+  return target;
+}
+
+uint8_t *WriteFixed64(uint64_t value, uint8_t *target)
+{
+  for (int i = 0; i < 8; ++i)
+  {
+    *target++ = static_cast<uint8_t>(value >> (8 * i));
+  }
+  return target;
+}
+
+// --------------------------- Sizes of encoded fields ---------------------------
+
+std::size_t VarintFieldSize(int field, uint64_t value)
+{
+  return VarintSize(MakeTag(field, kWireTypeVarint)) + VarintSize(value);
+}
+
+std::size_t Fixed64FieldSize(int field)
+{
+  return VarintSize(MakeTag(field, kWireTypeFixed64)) + 8;
+}
+
+std::size_t LengthDelimitedFieldSize(int field, std::size_t size)
+{
+  return VarintSize(MakeTag(field, kWireTypeLengthDelimited)) + VarintSize(size) + size;
+}
+
+// ------------------------ Fields written at a position -------------------------
+
+uint8_t *WriteVarintField(int field, uint64_t value, uint8_t *target)
+{
+  target = WriteVarint(MakeTag(field, kWireTypeVarint), target);
+  return WriteVarint(value, target);
+}
+
+uint8_t *WriteFixed64Field(int field, uint64_t value, uint8_t *target)
+{
+  target = WriteVarint(MakeTag(field, kWireTypeFixed64), target);
+  return WriteFixed64(value, target);
+}
+
+uint8_t *WriteLengthDelimitedHeader(int field, std::size_t size, uint8_t *target)
+{
+  target = WriteVarint(MakeTag(field, kWireTypeLengthDelimited), target);
+  return WriteVarint(size, target);
+}
+
+uint8_t *WriteBytesField(int field, const void *data, std::size_t size, uint8_t *target)
+{
+  target = WriteLengthDelimitedHeader(field, size, target);
+  if (size > 0)
+  {
+    std::memcpy(target, data, size);
+  }
+  return target + size;
+}
+
+// -------------------------- Fields appended to a buffer --------------------------
+
+void AppendVarint(uint64_t value, std::string &output)
+{
+  uint8_t buffer[10];
+  uint8_t *end = WriteVarint(value, buffer);
+  output.append(reinterpret_cast<const char *>(buffer), static_cast<std::size_t>(end - buffer));
+}
+
+void AppendVarintField(int field, uint64_t value, std::string &output)
+{
+  AppendVarint(MakeTag(field, kWireTypeVarint), output);
+  AppendVarint(value, output);
+}
+
+void AppendFixed64Field(int field, uint64_t value, std::string &output)
+{
+  uint8_t buffer[8];
+  AppendVarint(MakeTag(field, kWireTypeFixed64), output);
+  WriteFixed64(value, buffer);
+  output.append(reinterpret_cast<const char *>(buffer), sizeof(buffer));
+}
+
+void AppendBytesField(int field, const void *data, std::size_t size, std::string &output)
+{
+  AppendVarint(MakeTag(field, kWireTypeLengthDelimited), output);
+  AppendVarint(size, output);
+  output.append(static_cast<const char *>(data), size);
+}
+
+void AppendBytesField(int field, nostd::string_view value, std::string &output)
+{
+  AppendBytesField(field, value.data(), value.size(), output);
+}
+
+// Starts a message field whose size is not known yet, with one byte reserved for the size.
+// Returns the position of the content, to pass to EndMessageField.
+std::size_t BeginMessageField(int field, std::string &output)
+{
+  AppendVarint(MakeTag(field, kWireTypeLengthDelimited), output);
+  output.push_back('\0');
+  return output.size();
+}
+
+// Writes the size of a message field before its content, which is moved when the size does not
+// fit in the reserved byte.
+void EndMessageField(std::size_t start, std::string &output)
+{
+  std::size_t size = output.size() - start;
+  if (size < 0x80)
+  {
+    output[start - 1] = static_cast<char>(size);
+    return;
+  }
+  uint8_t buffer[10];
+  std::size_t size_length =
+      static_cast<std::size_t>(WriteVarint(static_cast<uint64_t>(size), buffer) - buffer);
+  output.insert(start, size_length - 1, '\0');
+  std::memcpy(&output[start - 1], buffer, size_length);
+}
+
+// ------------------------------- Attributes --------------------------------
+
+void AppendDoubleField(int field, double value, std::string &output)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  AppendFixed64Field(field, bits, output);
+}
+
+void AppendArrayElement(bool value, std::string &output)
+{
+  std::size_t start = BeginMessageField(proto::common::v1::ArrayValue::kValuesFieldNumber, output);
+  AppendVarintField(AnyValueProto::kBoolValueFieldNumber, value ? 1 : 0, output);
+  EndMessageField(start, output);
+}
+
+void AppendArrayElement(int64_t value, std::string &output)
+{
+  std::size_t start = BeginMessageField(proto::common::v1::ArrayValue::kValuesFieldNumber, output);
+  AppendVarintField(AnyValueProto::kIntValueFieldNumber, static_cast<uint64_t>(value), output);
+  EndMessageField(start, output);
+}
+
+void AppendArrayElement(double value, std::string &output)
+{
+  std::size_t start = BeginMessageField(proto::common::v1::ArrayValue::kValuesFieldNumber, output);
+  AppendDoubleField(AnyValueProto::kDoubleValueFieldNumber, value, output);
+  EndMessageField(start, output);
+}
+
+void AppendArrayElement(nostd::string_view value, std::string &output)
+{
+  std::size_t start = BeginMessageField(proto::common::v1::ArrayValue::kValuesFieldNumber, output);
+  AppendBytesField(AnyValueProto::kStringValueFieldNumber, value, output);
+  EndMessageField(start, output);
+}
+
+// Appends the array as the array_value of an AnyValue, with the elements converted to the type
+// of the AnyValue field.
+template <typename ElementType, typename T>
+void AppendArrayValue(nostd::span<const T> values, std::string &output)
+{
+  std::size_t start = BeginMessageField(AnyValueProto::kArrayValueFieldNumber, output);
+  for (const auto &value : values)
+  {
+    AppendArrayElement(static_cast<ElementType>(value), output);
+  }
+  EndMessageField(start, output);
+}
+
+// Appends the fields of an AnyValue, as OtlpPopulateAttributeUtils::PopulateAnyValue sets them.
+void AppendAnyValue(const opentelemetry::common::AttributeValue &value, std::string &output)
+{
+  // Assert size of variant to ensure that this method gets updated if the variant
+  // definition changes
+  static_assert(nostd::variant_size<opentelemetry::common::AttributeValue>::value == 16,
+                "AttributeValue contains unknown type");
+
+  if (nostd::holds_alternative<bool>(value))
+  {
+    AppendVarintField(AnyValueProto::kBoolValueFieldNumber, nostd::get<bool>(value) ? 1 : 0,
+                      output);
+  }
+  else if (nostd::holds_alternative<int>(value))
+  {
+    AppendVarintField(AnyValueProto::kIntValueFieldNumber,
+                      static_cast<uint64_t>(static_cast<int64_t>(nostd::get<int>(value))), output);
+  }
+  else if (nostd::holds_alternative<int64_t>(value))
+  {
+    AppendVarintField(AnyValueProto::kIntValueFieldNumber,
+                      static_cast<uint64_t>(nostd::get<int64_t>(value)), output);
+  }
+  else if (nostd::holds_alternative<unsigned int>(value))
+  {
+    AppendVarintField(AnyValueProto::kIntValueFieldNumber, nostd::get<unsigned int>(value),
+                      output);
+  }
+  else if (nostd::holds_alternative<uint64_t>(value))
+  {
+    AppendVarintField(AnyValueProto::kIntValueFieldNumber, nostd::get<uint64_t>(value), output);
+  }
+  else if (nostd::holds_alternative<double>(value))
+  {
+    AppendDoubleField(AnyValueProto::kDoubleValueFieldNumber, nostd::get<double>(value), output);
+  }
+  else if (nostd::holds_alternative<const char *>(value))
+  {
+    AppendBytesField(AnyValueProto::kStringValueFieldNumber,
+                     nostd::string_view(nostd::get<const char *>(value)), output);
+  }
+  else if (nostd::holds_alternative<nostd::string_view>(value))
+  {
+    AppendBytesField(AnyValueProto::kStringValueFieldNumber, nostd::get<nostd::string_view>(value),
+                     output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const uint8_t>>(value))
+  {
+    AppendArrayValue<int64_t>(nostd::get<nostd::span<const uint8_t>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const bool>>(value))
+  {
+    AppendArrayValue<bool>(nostd::get<nostd::span<const bool>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const int>>(value))
+  {
+    AppendArrayValue<int64_t>(nostd::get<nostd::span<const int>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const int64_t>>(value))
+  {
+    AppendArrayValue<int64_t>(nostd::get<nostd::span<const int64_t>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const unsigned int>>(value))
+  {
+    AppendArrayValue<int64_t>(nostd::get<nostd::span<const unsigned int>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const uint64_t>>(value))
+  {
+    AppendArrayValue<int64_t>(nostd::get<nostd::span<const uint64_t>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const double>>(value))
+  {
+    AppendArrayValue<double>(nostd::get<nostd::span<const double>>(value), output);
+  }
+  else if (nostd::holds_alternative<nostd::span<const nostd::string_view>>(value))
+  {
+    AppendArrayValue<nostd::string_view>(nostd::get<nostd::span<const nostd::string_view>>(value),
+                                         output);
+  }
+}
+
+void AppendAttribute(int field,
+                     nostd::string_view key,
+                     const opentelemetry::common::AttributeValue &value,
+                     std::string &output)
+{
+  std::size_t attribute_start = BeginMessageField(field, output);
+  AppendBytesField(KeyValueProto::kKeyFieldNumber, key, output);
+  std::size_t value_start = BeginMessageField(KeyValueProto::kValueFieldNumber, output);
+  AppendAnyValue(value, output);
+  EndMessageField(value_start, output);
+  EndMessageField(attribute_start, output);
+}
+
+void AppendAttributes(int field,
+                      const opentelemetry::common::KeyValueIterable &attributes,
+                      std::string &output)
+{
+  attributes.ForEachKeyValue(
+      [&](nostd::string_view key, opentelemetry::common::AttributeValue value) noexcept {
+        AppendAttribute(field, key, value, output);
+        return true;
+      });
+}
+
+// ---------------------------------- Status -----------------------------------
+
+std::size_t GetStatusSize(int code, const std::string &message)
+{
+  std::size_t size = 0;
+  if (!message.empty())
+  {
+    size += LengthDelimitedFieldSize(proto::trace::v1::Status::kMessageFieldNumber, message.size());
+  }
+  if (code != 0)
+  {
+    size += VarintFieldSize(proto::trace::v1::Status::kCodeFieldNumber, static_cast<uint64_t>(code));
+  }
+  return size;
+}
+
+// --------------------------- Resources and scopes ----------------------------
+
+std::string SerializeResource(OtlpResourceCache *cache,
+                              const opentelemetry::sdk::resource::Resource &resource)
+{
+  if (cache)
+  {
+    return cache->GetSerializedResource(resource);
+  }
+  proto::resource::v1::Resource proto_resource;
+  OtlpResourceCache::ConvertResource(resource, &proto_resource);
+  return proto_resource.SerializeAsString();
+}
+
+std::string SerializeInstrumentationScope(
+    OtlpResourceCache *cache,
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope &scope)
+{
+  if (cache)
+  {
+    return cache->GetSerializedInstrumentationScope(scope);
+  }
+  proto::common::v1::InstrumentationScope proto_scope;
+  OtlpResourceCache::ConvertInstrumentationScope(scope, &proto_scope);
+  return proto_scope.SerializeAsString();
+}
+
+}  // namespace
+
+OtlpWireRecordable::OtlpWireRecordable()
+{
+  fields_.reserve(kInitialFieldsCapacity);
+}
+
+std::size_t OtlpWireRecordable::GetEncodedSize() const noexcept
+{
+  std::size_t size = fields_.size();
+  if (has_identity_)
+  {
+    size += LengthDelimitedFieldSize(SpanProto::kTraceIdFieldNumber, trace_id_.size()) +
+            LengthDelimitedFieldSize(SpanProto::kSpanIdFieldNumber, span_id_.size());
+  }
+  if (!trace_state_.empty())
+  {
+    size += LengthDelimitedFieldSize(SpanProto::kTraceStateFieldNumber, trace_state_.size());
+  }
+  if (has_parent_span_id_)
+  {
+    size += LengthDelimitedFieldSize(SpanProto::kParentSpanIdFieldNumber, parent_span_id_.size());
+  }
+  if (!name_.empty())
+  {
+    size += LengthDelimitedFieldSize(SpanProto::kNameFieldNumber, name_.size());
+  }
+  if (kind_ != 0)
+  {
+    size += VarintFieldSize(SpanProto::kKindFieldNumber, static_cast<uint64_t>(kind_));
+  }
+  if (start_time_ != 0)
+  {
+    size += Fixed64FieldSize(SpanProto::kStartTimeUnixNanoFieldNumber);
+  }
+  if (end_time_ != 0)
+  {
+    size += Fixed64FieldSize(SpanProto::kEndTimeUnixNanoFieldNumber);
+  }
+  if (has_status_)
+  {
+    size += LengthDelimitedFieldSize(SpanProto::kStatusFieldNumber,
+                                     GetStatusSize(status_code_, status_message_));
+  }
+  return size;
+}
+
+uint8_t *OtlpWireRecordable::Encode(uint8_t *target) const noexcept
+{
+  if (has_identity_)
+  {
+    target = WriteBytesField(SpanProto::kTraceIdFieldNumber, trace_id_.data(), trace_id_.size(),
+                             target);
+    target =
+        WriteBytesField(SpanProto::kSpanIdFieldNumber, span_id_.data(), span_id_.size(), target);
+  }
+  if (!trace_state_.empty())
+  {
+    target = WriteBytesField(SpanProto::kTraceStateFieldNumber, trace_state_.data(),
+                             trace_state_.size(), target);
+  }
+  if (has_parent_span_id_)
+  {
+    target = WriteBytesField(SpanProto::kParentSpanIdFieldNumber, parent_span_id_.data(),
+                             parent_span_id_.size(), target);
+  }
+  if (!name_.empty())
+  {
+    target = WriteBytesField(SpanProto::kNameFieldNumber, name_.data(), name_.size(), target);
+  }
+  if (kind_ != 0)
+  {
+    target = WriteVarintField(SpanProto::kKindFieldNumber, static_cast<uint64_t>(kind_), target);
+  }
+  if (start_time_ != 0)
+  {
+    target = WriteFixed64Field(SpanProto::kStartTimeUnixNanoFieldNumber, start_time_, target);
+  }
+  if (end_time_ != 0)
+  {
+    target = WriteFixed64Field(SpanProto::kEndTimeUnixNanoFieldNumber, end_time_, target);
+  }
+  if (!fields_.empty())
+  {
+    std::memcpy(target, fields_.data(), fields_.size());
+    target += fields_.size();
+  }
+  if (has_status_)
+  {
+    target = WriteLengthDelimitedHeader(SpanProto::kStatusFieldNumber,
+                                        GetStatusSize(status_code_, status_message_), target);
+    if (!status_message_.empty())
+    {
+      target = WriteBytesField(proto::trace::v1::Status::kMessageFieldNumber,
+                               status_message_.data(), status_message_.size(), target);
+    }
+    if (status_code_ != 0)
+    {
+      target = WriteVarintField(proto::trace::v1::Status::kCodeFieldNumber,
+                                static_cast<uint64_t>(status_code_), target);
+    }
+  }
+  return target;
+}
+
+void OtlpWireRecordable::SerializeRequest(
+    const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans,
+    std::vector<uint8_t> *output,
+    OtlpResourceCache *cache) noexcept
+{
+  if (nullptr == output)
+  {
+    return;
+  }
+
+  using ResourceSpansProto = proto::trace::v1::ResourceSpans;
+  using ScopeSpansProto    = proto::trace::v1::ScopeSpans;
+
+  struct ScopeSpans
+  {
+    std::string scope;
+    std::string schema_url;
+    std::vector<std::pair<const OtlpWireRecordable *, std::size_t>> spans;
+    std::size_t size = 0;
+  };
+
+  struct ResourceSpans
+  {
+    std::string resource;
+    std::string schema_url;
+    std::unordered_map<const opentelemetry::sdk::instrumentationscope::InstrumentationScope *,
+                       ScopeSpans>
+        scope_spans;
+    std::size_t size = 0;
+  };
+
+  // Collect spans per resource and instrumentation scope, with their encoded size
+  std::unordered_map<const opentelemetry::sdk::resource::Resource *, ResourceSpans>
+      resource_spans_index;
+  for (auto &recordable : spans)
+  {
+    auto span = static_cast<const OtlpWireRecordable *>(recordable.get());
+    resource_spans_index[span->GetResource()]
+        .scope_spans[span->GetInstrumentationScope()]
+        .spans.emplace_back(span, span->GetEncodedSize());
+  }
+
+  // Compute the size of every message, so that they can be written in place
+  std::size_t request_size = 0;
+  for (auto &resource_spans_entry : resource_spans_index)
+  {
+    ResourceSpans &resource_spans = resource_spans_entry.second;
+    if (resource_spans_entry.first)
+    {
+      resource_spans.resource   = SerializeResource(cache, *resource_spans_entry.first);
+      resource_spans.schema_url = resource_spans_entry.first->GetSchemaURL();
+      resource_spans.size += LengthDelimitedFieldSize(ResourceSpansProto::kResourceFieldNumber,
+                                                      resource_spans.resource.size());
+    }
+    if (!resource_spans.schema_url.empty())
+    {
+      resource_spans.size += LengthDelimitedFieldSize(ResourceSpansProto::kSchemaUrlFieldNumber,
+                                                      resource_spans.schema_url.size());
+    }
+
+    for (auto &scope_spans_entry : resource_spans.scope_spans)
+    {
+      ScopeSpans &scope_spans = scope_spans_entry.second;
+      if (scope_spans_entry.first)
+      {
+        scope_spans.scope      = SerializeInstrumentationScope(cache, *scope_spans_entry.first);
+        scope_spans.schema_url = scope_spans_entry.first->GetSchemaURL();
+        scope_spans.size +=
+            LengthDelimitedFieldSize(ScopeSpansProto::kScopeFieldNumber, scope_spans.scope.size());
+      }
+      if (!scope_spans.schema_url.empty())
+      {
+        scope_spans.size += LengthDelimitedFieldSize(ScopeSpansProto::kSchemaUrlFieldNumber,
+                                                     scope_spans.schema_url.size());
+      }
+      for (auto &span : scope_spans.spans)
+      {
+        scope_spans.size += LengthDelimitedFieldSize(ScopeSpansProto::kSpansFieldNumber, span.second);
+      }
+      resource_spans.size +=
+          LengthDelimitedFieldSize(ResourceSpansProto::kScopeSpansFieldNumber, scope_spans.size);
+    }
+
+    request_size += LengthDelimitedFieldSize(
+        proto::collector::trace::v1::ExportTraceServiceRequest::kResourceSpansFieldNumber,
+        resource_spans.size);
+  }
+
+  // Write the request, copying the encoded spans
+  std::size_t offset = output->size();
+  output->resize(offset + request_size);
+  uint8_t *target = output->data() + offset;
+  for (auto &resource_spans_entry : resource_spans_index)
+  {
+    ResourceSpans &resource_spans = resource_spans_entry.second;
+    target                        = WriteLengthDelimitedHeader(
+        proto::collector::trace::v1::ExportTraceServiceRequest::kResourceSpansFieldNumber,
+        resource_spans.size, target);
+    if (resource_spans_entry.first)
+    {
+      target = WriteBytesField(ResourceSpansProto::kResourceFieldNumber,
+                               resource_spans.resource.data(), resource_spans.resource.size(),
+                               target);
+    }
+
+    for (auto &scope_spans_entry : resource_spans.scope_spans)
+    {
+      ScopeSpans &scope_spans = scope_spans_entry.second;
+      target = WriteLengthDelimitedHeader(ResourceSpansProto::kScopeSpansFieldNumber,
+                                          scope_spans.size, target);
+      if (scope_spans_entry.first)
+      {
+        target = WriteBytesField(ScopeSpansProto::kScopeFieldNumber, scope_spans.scope.data(),
+                                 scope_spans.scope.size(), target);
+      }
+      for (auto &span : scope_spans.spans)
+      {
+        target = WriteLengthDelimitedHeader(ScopeSpansProto::kSpansFieldNumber, span.second, target);
+        target = span.first->Encode(target);
+      }
+      if (!scope_spans.schema_url.empty())
+      {
+        target = WriteBytesField(ScopeSpansProto::kSchemaUrlFieldNumber,
+                                 scope_spans.schema_url.data(), scope_spans.schema_url.size(),
+                                 target);
+      }
+    }
+
+    if (!resource_spans.schema_url.empty())
+    {
+      target = WriteBytesField(ResourceSpansProto::kSchemaUrlFieldNumber,
+                               resource_spans.schema_url.data(), resource_spans.schema_url.size(),
+                               target);
+    }
+  }
+}
+
+void OtlpWireRecordable::SetIdentity(const opentelemetry::trace::SpanContext &span_context,
+                                     opentelemetry::trace::SpanId parent_span_id) noexcept
+{
+  has_identity_ = true;
+  std::memcpy(trace_id_.data(), span_context.trace_id().Id().data(), trace_id_.size());
+  std::memcpy(span_id_.data(), span_context.span_id().Id().data(), span_id_.size());
+  has_parent_span_id_ = parent_span_id.IsValid();
+  if (has_parent_span_id_)
+  {
+    std::memcpy(parent_span_id_.data(), parent_span_id.Id().data(), parent_span_id_.size());
+  }
+  trace_state_ = span_context.trace_state()->ToHeader();
+}
+
+void OtlpWireRecordable::SetAttribute(nostd::string_view key,
+                                      const opentelemetry::common::AttributeValue &value) noexcept
+{
+  AppendAttribute(SpanProto::kAttributesFieldNumber, key, value, fields_);
+}
+
+void OtlpWireRecordable::AddEvent(nostd::string_view name,
+                                  opentelemetry::common::SystemTimestamp timestamp,
+                                  const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  using EventProto = SpanProto::Event;
+
+  std::size_t start = BeginMessageField(SpanProto::kEventsFieldNumber, fields_);
+  uint64_t time     = static_cast<uint64_t>(timestamp.time_since_epoch().count());
+  if (time != 0)
+  {
+    AppendFixed64Field(EventProto::kTimeUnixNanoFieldNumber, time, fields_);
+  }
+  if (!name.empty())
+  {
+    AppendBytesField(EventProto::kNameFieldNumber, name, fields_);
+  }
+  AppendAttributes(EventProto::kAttributesFieldNumber, attributes, fields_);
+  EndMessageField(start, fields_);
+}
+
+void OtlpWireRecordable::AddLink(const opentelemetry::trace::SpanContext &span_context,
+                                 const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  using LinkProto = SpanProto::Link;
+
+  std::size_t start = BeginMessageField(SpanProto::kLinksFieldNumber, fields_);
+  AppendBytesField(LinkProto::kTraceIdFieldNumber, span_context.trace_id().Id().data(),
+                   opentelemetry::trace::TraceId::kSize, fields_);
+  AppendBytesField(LinkProto::kSpanIdFieldNumber, span_context.span_id().Id().data(),
+                   opentelemetry::trace::SpanId::kSize, fields_);
+  std::string trace_state = span_context.trace_state()->ToHeader();
+  if (!trace_state.empty())
+  {
+    AppendBytesField(LinkProto::kTraceStateFieldNumber, trace_state, fields_);
+  }
+  AppendAttributes(LinkProto::kAttributesFieldNumber, attributes, fields_);
+  EndMessageField(start, fields_);
+}
+
+void OtlpWireRecordable::SetStatus(opentelemetry::trace::StatusCode code,
+                                   nostd::string_view description) noexcept
+{
+  has_status_  = true;
+  status_code_ = static_cast<int>(code);
+  if (code == opentelemetry::trace::StatusCode::kError)
+  {
+    status_message_.assign(description.data(), description.size());
+  }
+}
+
+void OtlpWireRecordable::SetName(nostd::string_view name) noexcept
+{
+  name_.assign(name.data(), name.size());
+}
+
+void OtlpWireRecordable::SetSpanKind(opentelemetry::trace::SpanKind span_kind) noexcept
+{
+  switch (span_kind)
+  {
+    case opentelemetry::trace::SpanKind::kInternal:
+      kind_ = SpanProto::SPAN_KIND_INTERNAL;
+      break;
+    case opentelemetry::trace::SpanKind::kServer:
+      kind_ = SpanProto::SPAN_KIND_SERVER;
+      break;
+    case opentelemetry::trace::SpanKind::kClient:
+      kind_ = SpanProto::SPAN_KIND_CLIENT;
+      break;
+    case opentelemetry::trace::SpanKind::kProducer:
+      kind_ = SpanProto::SPAN_KIND_PRODUCER;
+      break;
+    case opentelemetry::trace::SpanKind::kConsumer:
+      kind_ = SpanProto::SPAN_KIND_CONSUMER;
+      break;
+    default:
+      kind_ = SpanProto::SPAN_KIND_UNSPECIFIED;
+  }
+}
+
+void OtlpWireRecordable::SetResource(const opentelemetry::sdk::resource::Resource &resource) noexcept
+{
+  resource_ = &resource;
+}
+
+void OtlpWireRecordable::SetStartTime(opentelemetry::common::SystemTimestamp start_time) noexcept
+{
+  start_time_ = static_cast<uint64_t>(start_time.time_since_epoch().count());
+}
+
+void OtlpWireRecordable::SetDuration(std::chrono::nanoseconds duration) noexcept
+{
+  end_time_ = start_time_ + duration.count();
+}
+
+void OtlpWireRecordable::SetInstrumentationScope(
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope
+        &instrumentation_scope) noexcept
+{
+  instrumentation_scope_ = &instrumentation_scope;
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,138 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_arena_pool.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <gtest/gtest.h>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+using ExportTraceServiceRequest = proto::collector::trace::v1::ExportTraceServiceRequest;
+
+TEST(OtlpArenaPool, ReuseReleasedArena)
+{
+  auto pool = std::make_shared<OtlpArenaPool>();
+
+  auto request = pool->CreateMessage<ExportTraceServiceRequest>();
+  request->add_resource_spans()->set_schema_url("schema");
+  auto arena = request->GetArena();
+  ASSERT_NE(arena, nullptr);
+
+  // The arena is in use, so another one is created
+  auto other_request = pool->CreateMessage<ExportTraceServiceRequest>();
+  EXPECT_NE(other_request->GetArena(), arena);
+
+  // The released arena is reset and reused
+  request.reset();
+  auto reused_request = pool->CreateMessage<ExportTraceServiceRequest>();
+  EXPECT_EQ(reused_request->GetArena(), arena);
+  EXPECT_EQ(reused_request->resource_spans_size(), 0);
+}
+
+TEST(OtlpArenaPool, ArenaOutlivesPool)
+{
+  auto pool    = std::make_shared<OtlpArenaPool>();
+  auto request = pool->CreateMessage<ExportTraceServiceRequest>();
+  pool.reset();
+
+  request->add_resource_spans()->set_schema_url("schema");
+  EXPECT_EQ(request->resource_spans(0).schema_url(), "schema");
+}
+
+TEST(OtlpArenaPool, PopulateRequestOnArena)
+{
+  auto pool    = std::make_shared<OtlpArenaPool>();
+  auto request = pool->CreateMessage<ExportTraceServiceRequest>();
+
+  std::vector<std::unique_ptr<trace_sdk::Recordable>> spans;
+  for (int i = 0; i < 3; i++)
+  {
+    std::unique_ptr<trace_sdk::Recordable> recordable{new OtlpRecordable};
+    recordable->SetName("span_" + std::to_string(i));
+    recordable->SetAttribute("index", i);
+    spans.push_back(std::move(recordable));
+  }
+  OtlpRecordableUtils::PopulateRequest(
+      nostd::span<std::unique_ptr<trace_sdk::Recordable>>(spans.data(), spans.size()),
+      request.get());
+
+  ASSERT_EQ(request->resource_spans_size(), 1);
+  ASSERT_EQ(request->resource_spans(0).scope_spans_size(), 1);
+  auto &output_spans = request->resource_spans(0).scope_spans(0).spans();
+  ASSERT_EQ(output_spans.size(), 3);
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_EQ(output_spans.Get(i).name(), "span_" + std::to_string(i));
+    ASSERT_EQ(output_spans.Get(i).attributes_size(), 1);
+    EXPECT_EQ(output_spans.Get(i).attributes(0).value().int_value(), i);
+  }
+}
+
+TEST(OtlpArenaPool, RecordablesOnArena)
+{
+  auto pool = std::make_shared<OtlpArenaPool>();
+
+  std::vector<std::unique_ptr<trace_sdk::Recordable>> spans;
+  std::vector<const proto::trace::v1::Span *> span_messages;
+  for (int i = 0; i < 3; i++)
+  {
+    std::unique_ptr<OtlpRecordable> recordable{new OtlpRecordable(pool->AcquireRecordableArena())};
+    recordable->SetName("span_" + std::to_string(i));
+    span_messages.push_back(&recordable->span());
+    spans.push_back(std::move(recordable));
+  }
+  nostd::span<std::unique_ptr<trace_sdk::Recordable>> batch(spans.data(), spans.size());
+  std::shared_ptr<google::protobuf::Arena> arena = OtlpRecordableUtils::GetArena(batch);
+  ASSERT_NE(arena, nullptr);
+  EXPECT_EQ(span_messages[0]->GetArena(), arena.get());
+  EXPECT_EQ(span_messages[2]->GetArena(), arena.get());
+
+  // The spans are added to the request built on their arena without being copied.
+  auto request = pool->CreateMessage<ExportTraceServiceRequest>(std::move(arena));
+  OtlpRecordableUtils::PopulateRequest(batch, request.get());
+  auto &output_spans = request->resource_spans(0).scope_spans(0).spans();
+  ASSERT_EQ(output_spans.size(), 3);
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_EQ(&output_spans.Get(i), span_messages[i]);
+    EXPECT_EQ(output_spans.Get(i).name(), "span_" + std::to_string(i));
+  }
+
+  // The arena is reused once the recordables and the request are released.
+  google::protobuf::Arena *released_arena = request->GetArena();
+  spans.clear();
+  request.reset();
+  EXPECT_EQ(pool->AcquireRecordableArena().get(), released_arena);
+}
+
+TEST(OtlpArenaPool, RecordablesShareArenaUpToLimit)
+{
+  auto pool = std::make_shared<OtlpArenaPool>();
+
+  std::vector<std::unique_ptr<OtlpRecordable>> recordables;
+  for (std::size_t i = 0; i <= OtlpArenaPool::kRecordablesPerArena; i++)
+  {
+    recordables.emplace_back(new OtlpRecordable(pool->AcquireRecordableArena()));
+  }
+  EXPECT_EQ(recordables.front()->GetArena(), recordables[1]->GetArena());
+  EXPECT_EQ(recordables.front()->GetArena(),
+            recordables[OtlpArenaPool::kRecordablesPerArena - 1]->GetArena());
+  EXPECT_NE(recordables.front()->GetArena(), recordables.back()->GetArena());
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
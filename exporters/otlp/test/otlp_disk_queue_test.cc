@@ -0,0 +1,389 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_disk_queue.h"
+#include "opentelemetry/exporters/otlp/otlp_http_client.h"
+#include "opentelemetry/ext/http/server/http_server.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#  include <direct.h>
+#  include <io.h>
+#else
+#  include <stdlib.h>
+#  include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#define HTTP_PORT 19020
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+
+std::vector<uint8_t> MakePayload(uint8_t value, std::size_t size)
+{
+  return std::vector<uint8_t>(size, value);
+}
+
+}  // namespace
+
+class OtlpDiskQueueTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+#ifdef _WIN32
+    char directory[] = "otlp_disk_queue_XXXXXX";
+    ASSERT_EQ(_mktemp_s(directory, sizeof(directory)), 0);
+    ASSERT_EQ(_mkdir(directory), 0);
+#else
+    char directory[] = "/tmp/otlp_disk_queue_XXXXXX";
+    ASSERT_NE(mkdtemp(directory), nullptr);
+#endif
+    options_.directory = directory;
+  }
+
+  void TearDown() override
+  {
+    for (int sequence = 0; sequence < 64; ++sequence)
+    {
+      std::remove(GetSegmentPath(sequence).c_str());
+    }
+    std::remove((options_.directory + "/queue.state").c_str());
+    std::remove((options_.directory + "/queue.state.tmp").c_str());
+#ifdef _WIN32
+    _rmdir(options_.directory.c_str());
+#else
+    rmdir(options_.directory.c_str());
+#endif
+  }
+
+  std::string GetSegmentPath(int sequence)
+  {
+    char file_name[32];
+    std::snprintf(file_name, sizeof(file_name), "%016x.seg", sequence);
+    return options_.directory + "/" + file_name;
+  }
+
+  std::string ReadState()
+  {
+    std::string state;
+    std::FILE *file = std::fopen((options_.directory + "/queue.state").c_str(), "r");
+    if (file != nullptr)
+    {
+      char buffer[64];
+      state.assign(buffer, std::fread(buffer, 1, sizeof(buffer), file));
+      std::fclose(file);
+    }
+    return state;
+  }
+
+  OtlpDiskQueueOptions options_;
+};
+
+TEST_F(OtlpDiskQueueTest, PushPop)
+{
+  OtlpDiskQueue queue(options_);
+  OtlpDiskQueue::Record record;
+  EXPECT_FALSE(queue.Front(record));
+
+  for (uint8_t i = 0; i < 3; ++i)
+  {
+    auto payload = MakePayload(i, 10 + i);
+    ASSERT_TRUE(queue.Push(i, payload.data(), payload.size()));
+  }
+  for (uint8_t i = 0; i < 3; ++i)
+  {
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_EQ(record.flags, i);
+    EXPECT_EQ(record.payload, MakePayload(i, 10 + i));
+    // Front does not remove the record
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_EQ(record.flags, i);
+    EXPECT_TRUE(queue.Pop(record.position));
+  }
+  EXPECT_FALSE(queue.Front(record));
+  EXPECT_EQ(queue.Size(), 0u);
+}
+
+TEST_F(OtlpDiskQueueTest, ReplayAfterReopen)
+{
+  {
+    OtlpDiskQueue queue(options_);
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+      auto payload = MakePayload(i, 100);
+      ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+    }
+    OtlpDiskQueue::Record record;
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_TRUE(queue.Pop(record.position));
+  }
+
+  OtlpDiskQueue queue(options_);
+  OtlpDiskQueue::Record record;
+  for (uint8_t i = 1; i < 3; ++i)
+  {
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_EQ(record.payload, MakePayload(i, 100));
+    EXPECT_TRUE(queue.Pop(record.position));
+  }
+  EXPECT_FALSE(queue.Front(record));
+}
+
+TEST_F(OtlpDiskQueueTest, SaveStateInBatches)
+{
+  options_.state_save_batch_size = 2;
+  OtlpDiskQueue queue(options_);
+  for (uint8_t i = 0; i < 4; ++i)
+  {
+    auto payload = MakePayload(i, 100);
+    ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+  }
+
+  // Only the position after the second removed record is saved
+  OtlpDiskQueue::Record record;
+  for (const char *state : {"0 0 0\n", "0 232 0\n", "0 232 0\n"})
+  {
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_TRUE(queue.Pop(record.position));
+    EXPECT_EQ(ReadState(), state);
+  }
+}
+
+TEST_F(OtlpDiskQueueTest, IgnorePartialRecord)
+{
+  {
+    OtlpDiskQueue queue(options_);
+    for (uint8_t i = 0; i < 2; ++i)
+    {
+      auto payload = MakePayload(i, 100);
+      ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+    }
+  }
+
+  // Simulate a crash while a record was written
+  std::FILE *segment = std::fopen(GetSegmentPath(0).c_str(), "ab");
+  ASSERT_NE(segment, nullptr);
+  const uint8_t partial_record[] = {0x4f, 0x4f, 0x44, 0x51, 0, 0, 0, 0, 100};
+  std::fwrite(partial_record, 1, sizeof(partial_record), segment);
+  std::fclose(segment);
+
+  OtlpDiskQueue queue(options_);
+  auto payload = MakePayload(2, 100);
+  ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+
+  OtlpDiskQueue::Record record;
+  for (uint8_t i = 0; i < 3; ++i)
+  {
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_EQ(record.payload, MakePayload(i, 100));
+    EXPECT_TRUE(queue.Pop(record.position));
+  }
+  EXPECT_FALSE(queue.Front(record));
+}
+
+TEST_F(OtlpDiskQueueTest, DropOldestRecords)
+{
+  // One record per segment, and at most three segments
+  options_.max_segment_size = 116;
+  options_.max_size         = 3 * 116;
+  OtlpDiskQueue queue(options_);
+
+  for (uint8_t i = 0; i < 5; ++i)
+  {
+    auto payload = MakePayload(i, 100);
+    ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+    EXPECT_LE(queue.Size(), options_.max_size);
+  }
+
+  auto payload = MakePayload(5, options_.max_size);
+  EXPECT_FALSE(queue.Push(0, payload.data(), payload.size()));
+
+  OtlpDiskQueue::Record record;
+  for (uint8_t i = 2; i < 5; ++i)
+  {
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_EQ(record.payload, MakePayload(i, 100));
+    EXPECT_TRUE(queue.Pop(record.position));
+  }
+  EXPECT_FALSE(queue.Front(record));
+}
+
+TEST_F(OtlpDiskQueueTest, PopOnlyTheSentRecord)
+{
+  // One record per segment, and at most two segments
+  options_.max_segment_size = 116;
+  options_.max_size         = 2 * 116;
+  OtlpDiskQueue queue(options_);
+
+  auto payload = MakePayload(0, 100);
+  ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+  OtlpDiskQueue::Record record;
+  ASSERT_TRUE(queue.Front(record));
+
+  // While the first record is sent, pushes to the full queue drop it
+  for (uint8_t i = 1; i < 3; ++i)
+  {
+    payload = MakePayload(i, 100);
+    ASSERT_TRUE(queue.Push(0, payload.data(), payload.size()));
+  }
+  // Removing the sent record does not remove the next one, which was not sent
+  EXPECT_FALSE(queue.Pop(record.position));
+  for (uint8_t i = 1; i < 3; ++i)
+  {
+    ASSERT_TRUE(queue.Front(record));
+    EXPECT_EQ(record.payload, MakePayload(i, 100));
+    EXPECT_TRUE(queue.Pop(record.position));
+    // A record is only removed once
+    EXPECT_FALSE(queue.Pop(record.position));
+  }
+  EXPECT_FALSE(queue.Front(record));
+}
+
+class OtlpHttpClientDiskQueueTest : public OtlpDiskQueueTest,
+                                    public HTTP_SERVER_NS::HttpRequestCallback
+{
+protected:
+  int onHttpRequest(HTTP_SERVER_NS::HttpRequest const &request,
+                    HTTP_SERVER_NS::HttpResponse &response) override
+  {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      received_bodies_.push_back(request.content);
+    }
+    received_.notify_all();
+    response.headers["Content-Type"] = "application/x-protobuf";
+    return 200;
+  }
+
+  bool WaitForRequests(std::size_t count)
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    return received_.wait_for(lock, std::chrono::seconds(10),
+                              [this, count] { return received_bodies_.size() >= count; });
+  }
+
+  std::mutex lock_;
+  std::condition_variable received_;
+  std::vector<std::string> received_bodies_;
+};
+
+TEST_F(OtlpHttpClientDiskQueueTest, RetryWhenCollectorIsReachable)
+{
+  std::string url = "http://localhost:" + std::to_string(HTTP_PORT) + "/v1/traces";
+  OtlpHttpClientOptions options(
+      url, false,                         /* ssl_insecure_skip_verify */
+      "", /* ssl_ca_cert_path */ "",      /* ssl_ca_cert_string */
+      "",                                 /* ssl_client_key_path */
+      "", /* ssl_client_key_string */ "", /* ssl_client_cert_path */
+      "",                                 /* ssl_client_cert_string */
+      "",                                 /* ssl_min_tls */
+      "",                                 /* ssl_max_tls */
+      "",                                 /* ssl_cipher */
+      "",                                 /* ssl_cipher_suite */
+      HttpRequestContentType::kBinary, JsonBytesMappingKind::kHexId, false, false,
+      std::chrono::seconds(2), {});
+  options.disk_queue                 = options_;
+  options.disk_queue.initial_backoff = std::chrono::milliseconds(10);
+  options.disk_queue.max_backoff     = std::chrono::milliseconds(100);
+  // The requests go to the disk queue once their retries are exhausted
+  options.retry_policy.max_attempts    = 2;
+  options.retry_policy.initial_backoff = std::chrono::milliseconds(10);
+  OtlpHttpClient client(std::move(options));
+
+  // The collector is unreachable, so the requests are kept in the disk queue
+  const std::string bodies[] = {"first request", "second request"};
+  for (auto &body : bodies)
+  {
+    EXPECT_EQ(client.Export(ext::http::client::Body(body.begin(), body.end())),
+              sdk::common::ExportResult::kSuccess);
+  }
+
+  HTTP_SERVER_NS::HttpServer server;
+  server.addListeningPort(HTTP_PORT);
+  server.addHandler("/v1/traces", *this);
+  server.start();
+
+  ASSERT_TRUE(WaitForRequests(2));
+  client.Shutdown();
+  server.stop();
+
+  std::lock_guard<std::mutex> guard(lock_);
+  ASSERT_EQ(received_bodies_.size(), 2u);
+  EXPECT_EQ(received_bodies_[0], bodies[0]);
+  EXPECT_EQ(received_bodies_[1], bodies[1]);
+}
+
+TEST_F(OtlpHttpClientDiskQueueTest, KeepPendingRetriesOnShutdown)
+{
+  std::string url = "http://localhost:" + std::to_string(HTTP_PORT) + "/v1/traces";
+  OtlpHttpClientOptions options(
+      url, false,                         /* ssl_insecure_skip_verify */
+      "", /* ssl_ca_cert_path */ "",      /* ssl_ca_cert_string */
+      "",                                 /* ssl_client_key_path */
+      "", /* ssl_client_key_string */ "", /* ssl_client_cert_path */
+      "",                                 /* ssl_client_cert_string */
+      "",                                 /* ssl_min_tls */
+      "",                                 /* ssl_max_tls */
+      "",                                 /* ssl_cipher */
+      "",                                 /* ssl_cipher_suite */
+      HttpRequestContentType::kBinary, JsonBytesMappingKind::kHexId, false, false,
+      std::chrono::seconds(2), {});
+  options.disk_queue = options_;
+  // The retry is still waiting when the client is shut down
+  options.retry_policy.max_attempts     = 2;
+  options.retry_policy.initial_backoff  = std::chrono::milliseconds(60000);
+  options.retry_policy.max_backoff      = std::chrono::milliseconds(60000);
+  options.retry_policy.max_elapsed_time = std::chrono::milliseconds(120000);
+
+  const std::string body = "pending request";
+  std::mutex result_lock;
+  std::condition_variable result_received;
+  bool has_result                  = false;
+  sdk::common::ExportResult result = sdk::common::ExportResult::kFailure;
+  {
+    OtlpHttpClient client(std::move(options));
+    client.Export(ext::http::client::Body(body.begin(), body.end()),
+                  [&](sdk::common::ExportResult export_result) {
+                    std::lock_guard<std::mutex> guard(result_lock);
+                    result     = export_result;
+                    has_result = true;
+                    result_received.notify_all();
+                    return true;
+                  });
+    // Let the first attempt fail, as the collector is unreachable
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    client.Shutdown();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(result_lock);
+    ASSERT_TRUE(
+        result_received.wait_for(lock, std::chrono::seconds(10), [&] { return has_result; }));
+    EXPECT_EQ(result, sdk::common::ExportResult::kSuccess);
+  }
+
+  OtlpDiskQueue queue(options_);
+  OtlpDiskQueue::Record record;
+  ASSERT_TRUE(queue.Front(record));
+  EXPECT_EQ(std::string(record.payload.begin(), record.payload.end()), body);
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
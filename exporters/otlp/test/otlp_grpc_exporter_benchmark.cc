@@ -5,6 +5,9 @@
 #include "opentelemetry/exporters/otlp/otlp_recordable.h"
 
 #include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
 #include "opentelemetry/sdk/trace/simple_processor.h"
 #include "opentelemetry/sdk/trace/tracer_provider.h"
 #include "opentelemetry/trace/provider.h"
@@ -22,6 +25,30 @@ namespace otlp      = opentelemetry::exporter::otlp;
 
 #include <benchmark/benchmark.h>
 
+// Count the allocations, to report how many an export makes
+static std::atomic<std::size_t> allocation_count{0};
+
+void *operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace exporter
 {
@@ -88,21 +115,23 @@ class OtlpGrpcExporterTestPeer
 };
 
 // Helper function to create empty spans
-void CreateEmptySpans(std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &recordables)
+void CreateEmptySpans(sdk::trace::SpanExporter &exporter,
+                 std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &recordables)
 {
   for (int i = 0; i < kBatchSize; i++)
   {
-    auto recordable = std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+    auto recordable = exporter.MakeRecordable();
     recordables[i]  = std::move(recordable);
   }
 }
 
 // Helper function to create sparse spans
-void CreateSparseSpans(std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &recordables)
+void CreateSparseSpans(sdk::trace::SpanExporter &exporter,
+                 std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &recordables)
 {
   for (int i = 0; i < kBatchSize; i++)
   {
-    auto recordable = std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+    auto recordable = exporter.MakeRecordable();
 
     recordable->SetIdentity(kSpanContext, kParentSpanId);
     recordable->SetName("TestSpan");
@@ -114,11 +143,12 @@ void CreateSparseSpans(std::array<std::unique_ptr<sdk::trace::Recordable>, kBatc
 }
 
 // Helper function to create dense spans
-void CreateDenseSpans(std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &recordables)
+void CreateDenseSpans(sdk::trace::SpanExporter &exporter,
+                 std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &recordables)
 {
   for (int i = 0; i < kBatchSize; i++)
   {
-    auto recordable = std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+    auto recordable = exporter.MakeRecordable();
 
     recordable->SetIdentity(kSpanContext, kParentSpanId);
     recordable->SetName("TestSpan");
@@ -138,18 +168,35 @@ void CreateDenseSpans(std::array<std::unique_ptr<sdk::trace::Recordable>, kBatch
 
 // ------------------------------ Benchmark tests ------------------------------
 
+// Create and export the spans, and return the number of allocations made by both
+std::size_t ExportBatch(
+    sdk::trace::SpanExporter &exporter,
+    void (*create_spans)(sdk::trace::SpanExporter &,
+                         std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> &))
+{
+  std::size_t allocations = allocation_count.load(std::memory_order_relaxed);
+  {
+    std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> recordables;
+    create_spans(exporter, recordables);
+    exporter.Export(nostd::span<std::unique_ptr<sdk::trace::Recordable>>(recordables));
+  }
+  return allocation_count.load(std::memory_order_relaxed) - allocations;
+}
+
 // Benchmark Export() with empty spans
 void BM_OtlpExporterEmptySpans(benchmark::State &state)
 {
   std::unique_ptr<OtlpGrpcExporterTestPeer> testpeer(new OtlpGrpcExporterTestPeer());
-  auto exporter = testpeer->GetExporter();
+  auto exporter           = testpeer->GetExporter();
+  std::size_t allocations = 0;
+  std::size_t batches     = 0;
 
   while (state.KeepRunningBatch(kNumIterations))
   {
-    std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> recordables;
-    CreateEmptySpans(recordables);
-    exporter->Export(nostd::span<std::unique_ptr<sdk::trace::Recordable>>(recordables));
+    allocations += ExportBatch(*exporter, CreateEmptySpans);
+    batches++;
   }
+  state.counters["allocations_per_batch"] = static_cast<double>(allocations) / batches;
 }
 BENCHMARK(BM_OtlpExporterEmptySpans);
 
@@ -157,14 +204,16 @@ BENCHMARK(BM_OtlpExporterEmptySpans);
 void BM_OtlpExporterSparseSpans(benchmark::State &state)
 {
   std::unique_ptr<OtlpGrpcExporterTestPeer> testpeer(new OtlpGrpcExporterTestPeer());
-  auto exporter = testpeer->GetExporter();
+  auto exporter           = testpeer->GetExporter();
+  std::size_t allocations = 0;
+  std::size_t batches     = 0;
 
   while (state.KeepRunningBatch(kNumIterations))
   {
-    std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> recordables;
-    CreateSparseSpans(recordables);
-    exporter->Export(nostd::span<std::unique_ptr<sdk::trace::Recordable>>(recordables));
+    allocations += ExportBatch(*exporter, CreateSparseSpans);
+    batches++;
   }
+  state.counters["allocations_per_batch"] = static_cast<double>(allocations) / batches;
 }
 BENCHMARK(BM_OtlpExporterSparseSpans);
 
@@ -172,14 +221,16 @@ BENCHMARK(BM_OtlpExporterSparseSpans);
 void BM_OtlpExporterDenseSpans(benchmark::State &state)
 {
   std::unique_ptr<OtlpGrpcExporterTestPeer> testpeer(new OtlpGrpcExporterTestPeer());
-  auto exporter = testpeer->GetExporter();
+  auto exporter           = testpeer->GetExporter();
+  std::size_t allocations = 0;
+  std::size_t batches     = 0;
 
   while (state.KeepRunningBatch(kNumIterations))
   {
-    std::array<std::unique_ptr<sdk::trace::Recordable>, kBatchSize> recordables;
-    CreateDenseSpans(recordables);
-    exporter->Export(nostd::span<std::unique_ptr<sdk::trace::Recordable>>(recordables));
+    allocations += ExportBatch(*exporter, CreateDenseSpans);
+    batches++;
   }
+  state.counters["allocations_per_batch"] = static_cast<double>(allocations) / batches;
 }
 BENCHMARK(BM_OtlpExporterDenseSpans);
 
@@ -17,6 +17,7 @@
 // That is because `std::result_of` has been removed in C++20.
 
 #  include "opentelemetry/exporters/otlp/otlp_grpc_exporter.h"
+#  include "opentelemetry/exporters/otlp/otlp_grpc_client.h"
 
 #  include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
 
@@ -31,6 +32,10 @@
 
 #  include <gtest/gtest.h>
 
+#  include <condition_variable>
+#  include <mutex>
+#  include <vector>
+
 #  if defined(_MSC_VER)
 #    include "opentelemetry/sdk/common/env_variables.h"
 using opentelemetry::sdk::common::setenv;
@@ -161,6 +166,159 @@ TEST_F(OtlpGrpcExporterTestPeer, ConfigSslCredentialsTest)
   EXPECT_EQ(GetOptions(exporter).use_ssl_credentials, true);
 }
 
+#  ifdef ENABLE_ASYNC_EXPORT
+// A collector answering every request with the same status, which can hold the requests.
+class TestTraceService : public proto::collector::trace::v1::TraceService::Service
+{
+public:
+  explicit TestTraceService(grpc::Status status) : status_(status) {}
+
+  grpc::Status Export(grpc::ServerContext *,
+                      const proto::collector::trace::v1::ExportTraceServiceRequest *,
+                      proto::collector::trace::v1::ExportTraceServiceResponse *) override
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    ++received_;
+    cv_.notify_all();
+    cv_.wait(lock, [this] { return !hold_; });
+    return status_;
+  }
+
+  void Hold()
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    hold_ = true;
+  }
+
+  void Release()
+  {
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      hold_ = false;
+    }
+    cv_.notify_all();
+  }
+
+  bool WaitForRequests(std::size_t count)
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    return cv_.wait_for(lock, std::chrono::seconds(10),
+                        [this, count] { return received_ >= count; });
+  }
+
+private:
+  grpc::Status status_;
+  std::mutex lock_;
+  std::condition_variable cv_;
+  std::size_t received_ = 0;
+  bool hold_            = false;
+};
+
+// Runs the asynchronous exports of a client against an in-process server
+class OtlpGrpcClientAsyncTest : public ::testing::Test
+{
+public:
+  void StartServer(TestTraceService *service)
+  {
+    grpc::ServerBuilder builder;
+    builder.RegisterService(service);
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+    stub_ = proto::collector::trace::v1::TraceService::NewStub(
+        server_->InProcessChannel(grpc::ChannelArguments()));
+  }
+
+  void TearDown() override
+  {
+    stub_.reset();
+    if (server_)
+    {
+      server_->Shutdown();
+    }
+  }
+
+  sdk::common::ExportResult Export(OtlpGrpcClient &client)
+  {
+    OtlpGrpcClientOptions options;
+    return client.DelegateAsyncExport(
+        stub_, OtlpGrpcClient::MakeClientContext(options),
+        std::make_shared<proto::collector::trace::v1::ExportTraceServiceRequest>(),
+        [this](sdk::common::ExportResult result) {
+          std::lock_guard<std::mutex> lock(results_lock_);
+          results_.push_back(result);
+          return true;
+        });
+  }
+
+  std::vector<sdk::common::ExportResult> GetResults()
+  {
+    std::lock_guard<std::mutex> lock(results_lock_);
+    return results_;
+  }
+
+protected:
+  std::unique_ptr<grpc::Server> server_;
+  std::shared_ptr<proto::collector::trace::v1::TraceService::StubInterface> stub_;
+  std::mutex results_lock_;
+  std::vector<sdk::common::ExportResult> results_;
+};
+
+TEST_F(OtlpGrpcClientAsyncTest, ExportSuccess)
+{
+  TestTraceService service(grpc::Status::OK);
+  StartServer(&service);
+  OtlpGrpcClient client{OtlpGrpcClientOptions()};
+
+  EXPECT_EQ(sdk::common::ExportResult::kSuccess, Export(client));
+  EXPECT_EQ(sdk::common::ExportResult::kSuccess, Export(client));
+  EXPECT_TRUE(client.ForceFlush(std::chrono::seconds(10)));
+
+  std::vector<sdk::common::ExportResult> expected(2, sdk::common::ExportResult::kSuccess);
+  EXPECT_EQ(GetResults(), expected);
+}
+
+TEST_F(OtlpGrpcClientAsyncTest, ExportFailure)
+{
+  TestTraceService service(grpc::Status(grpc::StatusCode::UNAVAILABLE, "unavailable"));
+  StartServer(&service);
+  OtlpGrpcClient client{OtlpGrpcClientOptions()};
+
+  // The request is sent, its callback gets the failure
+  EXPECT_EQ(sdk::common::ExportResult::kSuccess, Export(client));
+  EXPECT_TRUE(client.ForceFlush(std::chrono::seconds(10)));
+
+  std::vector<sdk::common::ExportResult> expected(1, sdk::common::ExportResult::kFailure);
+  EXPECT_EQ(GetResults(), expected);
+}
+
+TEST_F(OtlpGrpcClientAsyncTest, ShutdownWithPendingRequests)
+{
+  TestTraceService service(grpc::Status::OK);
+  StartServer(&service);
+  service.Hold();
+
+  std::unique_ptr<OtlpGrpcClient> client(new OtlpGrpcClient(OtlpGrpcClientOptions()));
+  EXPECT_EQ(sdk::common::ExportResult::kSuccess, Export(*client));
+  EXPECT_EQ(sdk::common::ExportResult::kSuccess, Export(*client));
+  ASSERT_TRUE(service.WaitForRequests(2));
+
+  // The shutdown times out with the requests in flight, and new requests are rejected
+  EXPECT_FALSE(client->Shutdown(std::chrono::milliseconds(10)));
+  EXPECT_EQ(sdk::common::ExportResult::kFailure, Export(*client));
+
+  // The client keeps the stub and its channel alive for the requests
+  stub_.reset();
+  service.Release();
+  EXPECT_TRUE(client->ForceFlush(std::chrono::seconds(10)));
+  client.reset();
+
+  std::vector<sdk::common::ExportResult> expected{sdk::common::ExportResult::kFailure,
+                                                  sdk::common::ExportResult::kSuccess,
+                                                  sdk::common::ExportResult::kSuccess};
+  EXPECT_EQ(GetResults(), expected);
+}
+#  endif  // ENABLE_ASYNC_EXPORT
+
 #  ifndef NO_GETENV
 // Test exporter configuration options with use_ssl_credentials
 TEST_F(OtlpGrpcExporterTestPeer, ConfigFromEnv)
@@ -12,12 +12,18 @@
 
 #  include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
 
+#  ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+#    include "google/protobuf/io/gzip_stream.h"
+#    include "google/protobuf/io/zero_copy_stream_impl_lite.h"
+#  endif
+
 #  include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
 
 #  include "opentelemetry/ext/http/client/http_client_factory.h"
 #  include "opentelemetry/ext/http/server/http_server.h"
 #  include "opentelemetry/sdk/trace/batch_span_processor.h"
 #  include "opentelemetry/sdk/trace/batch_span_processor_options.h"
+#  include "opentelemetry/sdk/trace/simple_processor.h"
 #  include "opentelemetry/sdk/trace/tracer_provider.h"
 #  include "opentelemetry/test_common/ext/http/client/http_client_test_factory.h"
 #  include "opentelemetry/test_common/ext/http/client/nosend/http_client_nosend.h"
@@ -369,6 +375,50 @@ class OtlpHttpExporterTestPeer : public ::testing::Test
     static_cast<sdk::trace::TracerProvider *>(provider.get())->ForceFlush();
   }
 
+#  ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+  void ExportBinaryGzipIntegrationTest()
+  {
+    auto options        = MakeOtlpHttpClientOptions(HttpRequestContentType::kBinary, false);
+    options.compression = "gzip";
+    auto client         = http_client::HttpClientTestFactory::Create();
+    auto exporter       = GetExporter(
+        std::unique_ptr<OtlpHttpClient>{new OtlpHttpClient(std::move(options), client)});
+
+    auto processor = std::unique_ptr<sdk::trace::SpanProcessor>(
+        new sdk::trace::SimpleSpanProcessor(std::move(exporter)));
+    auto provider = nostd::shared_ptr<trace::TracerProvider>(new sdk::trace::TracerProvider(
+        std::move(processor), resource::Resource::Create({{"service.name", "unit_test_service"}})));
+
+    auto no_send_client = std::static_pointer_cast<http_client::nosend::HttpClient>(client);
+    auto mock_session =
+        std::static_pointer_cast<http_client::nosend::Session>(no_send_client->session_);
+    EXPECT_CALL(*mock_session, SendRequest)
+        .WillOnce([&mock_session](
+                      std::shared_ptr<opentelemetry::ext::http::client::EventHandler> callback) {
+          auto &headers         = mock_session->GetRequest()->headers_;
+          auto content_encoding = headers.find("Content-Encoding");
+          ASSERT_TRUE(content_encoding != headers.end());
+          EXPECT_EQ("gzip", content_encoding->second);
+
+          auto &body = mock_session->GetRequest()->body_;
+          google::protobuf::io::ArrayInputStream body_stream(body.data(),
+                                                             static_cast<int>(body.size()));
+          google::protobuf::io::GzipInputStream gzip_stream(
+              &body_stream, google::protobuf::io::GzipInputStream::GZIP);
+          opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request_body;
+          ASSERT_TRUE(request_body.ParseFromZeroCopyStream(&gzip_stream));
+          ASSERT_EQ(request_body.resource_spans_size(), 1);
+          EXPECT_EQ(request_body.resource_spans(0).scope_spans(0).spans(0).name(),
+                    "Test gzip span");
+
+          http_client::nosend::Response response;
+          response.Finish(*callback.get());
+        });
+
+    provider->GetTracer("test")->StartSpan("Test gzip span")->End();
+  }
+#  endif
+
 #  ifdef ENABLE_ASYNC_EXPORT
   void ExportBinaryIntegrationTestAsync()
   {
@@ -496,6 +546,13 @@ TEST_F(OtlpHttpExporterTestPeer, ExportBinaryIntegrationTestAsync)
 #  endif
 
 // Test exporter configuration options
+#  ifdef ENABLE_OTLP_COMPRESSION_PREVIEW
+TEST_F(OtlpHttpExporterTestPeer, ExportBinaryGzipIntegrationTest)
+{
+  ExportBinaryGzipIntegrationTest();
+}
+#  endif
+
 TEST_F(OtlpHttpExporterTestPeer, ConfigTest)
 {
   OtlpHttpExporterOptions opts;
@@ -531,6 +588,7 @@ TEST_F(OtlpHttpExporterTestPeer, ConfigFromEnv)
   setenv("OTEL_EXPORTER_OTLP_TIMEOUT", "20s", 1);
   setenv("OTEL_EXPORTER_OTLP_HEADERS", "k1=v1,k2=v2", 1);
   setenv("OTEL_EXPORTER_OTLP_TRACES_HEADERS", "k1=v3,k1=v4", 1);
+  setenv("OTEL_EXPORTER_OTLP_COMPRESSION", "gzip", 1);
 
   std::unique_ptr<OtlpHttpExporter> exporter(new OtlpHttpExporter());
   EXPECT_EQ(GetOptions(exporter).url, url);
@@ -538,6 +596,7 @@ TEST_F(OtlpHttpExporterTestPeer, ConfigFromEnv)
       GetOptions(exporter).timeout.count(),
       std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds{20})
           .count());
+  EXPECT_EQ(GetOptions(exporter).compression, "gzip");
   EXPECT_EQ(GetOptions(exporter).http_headers.size(), 3);
   {
     // Test k2
@@ -562,6 +621,7 @@ TEST_F(OtlpHttpExporterTestPeer, ConfigFromEnv)
   unsetenv("OTEL_EXPORTER_OTLP_TIMEOUT");
   unsetenv("OTEL_EXPORTER_OTLP_HEADERS");
   unsetenv("OTEL_EXPORTER_OTLP_TRACES_HEADERS");
+  unsetenv("OTEL_EXPORTER_OTLP_COMPRESSION");
 }
 
 TEST_F(OtlpHttpExporterTestPeer, ConfigFromTracesEnv)
@@ -578,6 +638,7 @@ TEST_F(OtlpHttpExporterTestPeer, ConfigFromTracesEnv)
       GetOptions(exporter).timeout.count(),
       std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds{10})
           .count());
+  EXPECT_EQ(GetOptions(exporter).compression, "none");
   EXPECT_EQ(GetOptions(exporter).http_headers.size(), 3);
   {
     // Test k2
@@ -0,0 +1,199 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_http_client.h"
+#include "opentelemetry/ext/http/server/http_server.h"
+
+#include <chrono>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define HTTP_PORT 19021
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+
+struct StubResponse
+{
+  int status_code;
+  std::string retry_after;
+};
+
+}  // namespace
+
+class OtlpHttpRetryTest : public ::testing::Test, public HTTP_SERVER_NS::HttpRequestCallback
+{
+protected:
+  void SetUp() override
+  {
+    server_.addListeningPort(HTTP_PORT);
+    server_.addHandler("/v1/traces", *this);
+    server_.start();
+  }
+
+  void TearDown() override { server_.stop(); }
+
+  int onHttpRequest(HTTP_SERVER_NS::HttpRequest const &request,
+                    HTTP_SERVER_NS::HttpResponse &response) override
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    received_bodies_.push_back(request.content);
+    if (responses_.empty())
+    {
+      return 200;
+    }
+    StubResponse stub_response = responses_.front();
+    if (responses_.size() > 1)
+    {
+      responses_.erase(responses_.begin());
+    }
+    if (!stub_response.retry_after.empty())
+    {
+      response.headers["Retry-After"] = stub_response.retry_after;
+    }
+    return stub_response.status_code;
+  }
+
+  sdk::common::ExportResult Export(const OtlpRetryPolicy &retry_policy)
+  {
+    std::string url = "http://localhost:" + std::to_string(HTTP_PORT) + "/v1/traces";
+    OtlpHttpClientOptions options(
+        url, false,                         /* ssl_insecure_skip_verify */
+        "", /* ssl_ca_cert_path */ "",      /* ssl_ca_cert_string */
+        "",                                 /* ssl_client_key_path */
+        "", /* ssl_client_key_string */ "", /* ssl_client_cert_path */
+        "",                                 /* ssl_client_cert_string */
+        "",                                 /* ssl_min_tls */
+        "",                                 /* ssl_max_tls */
+        "",                                 /* ssl_cipher */
+        "",                                 /* ssl_cipher_suite */
+        HttpRequestContentType::kBinary, JsonBytesMappingKind::kHexId, false, false,
+        std::chrono::seconds(2), {});
+    options.retry_policy = retry_policy;
+    OtlpHttpClient client(std::move(options));
+    return client.Export(ext::http::client::Body(body_.begin(), body_.end()));
+  }
+
+  std::vector<std::string> GetReceivedBodies()
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    return received_bodies_;
+  }
+
+  static OtlpRetryPolicy MakeRetryPolicy(std::size_t max_attempts)
+  {
+    OtlpRetryPolicy retry_policy;
+    retry_policy.max_attempts     = max_attempts;
+    retry_policy.initial_backoff  = std::chrono::milliseconds(10);
+    retry_policy.max_backoff      = std::chrono::milliseconds(50);
+    retry_policy.max_elapsed_time = std::chrono::seconds(5);
+    return retry_policy;
+  }
+
+  HTTP_SERVER_NS::HttpServer server_;
+  std::string body_ = "request";
+
+  std::mutex lock_;
+  // The responses of the next requests, the last one is repeated
+  std::vector<StubResponse> responses_;
+  std::vector<std::string> received_bodies_;
+};
+
+TEST_F(OtlpHttpRetryTest, RetryUnavailable)
+{
+  responses_ = {{503, ""}, {502, ""}, {200, ""}};
+  EXPECT_EQ(Export(MakeRetryPolicy(5)), sdk::common::ExportResult::kSuccess);
+
+  auto received_bodies = GetReceivedBodies();
+  ASSERT_EQ(received_bodies.size(), 3u);
+  for (auto &received_body : received_bodies)
+  {
+    EXPECT_EQ(received_body, body_);
+  }
+}
+
+TEST_F(OtlpHttpRetryTest, GiveUpAfterMaxAttempts)
+{
+  responses_ = {{503, ""}};
+  EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kFailure);
+  EXPECT_EQ(GetReceivedBodies().size(), 3u);
+}
+
+TEST_F(OtlpHttpRetryTest, DoNotRetryRejectedRequest)
+{
+  responses_ = {{400, ""}};
+  EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kFailure);
+  EXPECT_EQ(GetReceivedBodies().size(), 1u);
+}
+
+TEST_F(OtlpHttpRetryTest, DisabledRetries)
+{
+  responses_ = {{503, ""}};
+  EXPECT_EQ(Export(MakeRetryPolicy(1)), sdk::common::ExportResult::kFailure);
+  EXPECT_EQ(GetReceivedBodies().size(), 1u);
+}
+
+TEST_F(OtlpHttpRetryTest, RetryAfterSeconds)
+{
+  responses_ = {{429, "1"}, {200, ""}};
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kSuccess);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(900));
+  EXPECT_EQ(GetReceivedBodies().size(), 2u);
+}
+
+TEST_F(OtlpHttpRetryTest, RetryAfterDate)
+{
+  std::time_t retry_time = std::time(nullptr) + 1;
+  char retry_after[64];
+  std::strftime(retry_after, sizeof(retry_after), "%a, %d %b %Y %H:%M:%S GMT",
+                std::gmtime(&retry_time));
+  responses_ = {{503, retry_after}, {200, ""}};
+  EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kSuccess);
+  EXPECT_EQ(GetReceivedBodies().size(), 2u);
+}
+
+TEST_F(OtlpHttpRetryTest, GiveUpWhenRetryAfterIsTooLate)
+{
+  responses_ = {{503, "3600"}};
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kFailure);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  EXPECT_EQ(GetReceivedBodies().size(), 1u);
+}
+
+TEST_F(OtlpHttpRetryTest, GiveUpWhenRetryAfterOverflows)
+{
+  for (const char *retry_after :
+       {"99999999999999999999", "9223372036854775807", "Fri, 31 Dec 9999 23:59:59 GMT"})
+  {
+    responses_ = {{503, retry_after}};
+    received_bodies_.clear();
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kFailure) << retry_after;
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5)) << retry_after;
+    EXPECT_EQ(GetReceivedBodies().size(), 1u) << retry_after;
+  }
+}
+
+TEST_F(OtlpHttpRetryTest, RetryAfterDateInThePast)
+{
+  responses_ = {{503, "Sat, 01 Jan 0000 00:00:00 GMT"}, {200, ""}};
+  EXPECT_EQ(Export(MakeRetryPolicy(3)), sdk::common::ExportResult::kSuccess);
+  EXPECT_EQ(GetReceivedBodies().size(), 2u);
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
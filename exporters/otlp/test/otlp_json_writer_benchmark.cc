@@ -0,0 +1,79 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_json_writer.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+namespace otlp  = opentelemetry::exporter::otlp;
+namespace proto = opentelemetry::proto;
+
+const int kBatchSize     = 200;
+const int kNumAttributes = 5;
+
+proto::collector::trace::v1::ExportTraceServiceRequest CreateRequest()
+{
+  proto::collector::trace::v1::ExportTraceServiceRequest request;
+  auto scope_spans = request.add_resource_spans()->add_scope_spans();
+  scope_spans->mutable_scope()->set_name("benchmark");
+  for (int i = 0; i < kBatchSize; i++)
+  {
+    auto span = scope_spans->add_spans();
+    span->set_trace_id(std::string(16, '\x01'));
+    span->set_span_id(std::string(8, '\x02'));
+    span->set_parent_span_id(std::string(8, '\x03'));
+    span->set_name("span");
+    span->set_kind(proto::trace::v1::Span::SPAN_KIND_INTERNAL);
+    span->set_start_time_unix_nano(1700000000000000000ULL);
+    span->set_end_time_unix_nano(1700000000000001000ULL);
+    for (int j = 0; j < kNumAttributes; j++)
+    {
+      auto attribute = span->add_attributes();
+      attribute->set_key("attribute_" + std::to_string(j));
+      attribute->mutable_value()->set_string_value("value");
+    }
+    auto attribute = span->add_attributes();
+    attribute->set_key("count");
+    attribute->mutable_value()->set_int_value(i);
+  }
+  return request;
+}
+
+void BM_OtlpJsonWriterWrite(benchmark::State &state)
+{
+  auto request = CreateRequest();
+  std::vector<uint8_t> output;
+  for (auto _ : state)
+  {
+    output.clear();
+    otlp::OtlpJsonWriter::Write(request, otlp::OtlpJsonOptions(), output);
+    benchmark::DoNotOptimize(output.data());
+  }
+}
+BENCHMARK(BM_OtlpJsonWriterWrite);
+
+void BM_OtlpJsonWriterWriteWithReflection(benchmark::State &state)
+{
+  auto request = CreateRequest();
+  std::vector<uint8_t> output;
+  for (auto _ : state)
+  {
+    output.clear();
+    otlp::OtlpJsonWriter::WriteWithReflection(request, otlp::OtlpJsonOptions(), output);
+    benchmark::DoNotOptimize(output.data());
+  }
+}
+BENCHMARK(BM_OtlpJsonWriterWriteWithReflection);
+
+}  // namespace
+
+BENCHMARK_MAIN();
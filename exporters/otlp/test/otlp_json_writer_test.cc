@@ -0,0 +1,261 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_json_writer.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <gtest/gtest.h>
+#include "nlohmann/json.hpp"
+
+#include <clocale>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+namespace
+{
+
+using KeyValues = google::protobuf::RepeatedPtrField<proto::common::v1::KeyValue>;
+
+const JsonBytesMappingKind kBytesMappings[] = {
+    JsonBytesMappingKind::kHexId, JsonBytesMappingKind::kHex, JsonBytesMappingKind::kBase64};
+
+void AddAttributes(KeyValues *attributes)
+{
+  auto attribute = attributes->Add();
+  attribute->set_key("str\"ing\n\x01\xc3\xa9");
+  // A truncated UTF-8 sequence is replaced by U+FFFD
+  attribute->mutable_value()->set_string_value("va\\lue\xe2\x82\xac\xe2\x82");
+
+  attribute = attributes->Add();
+  attribute->set_key("bool");
+  attribute->mutable_value()->set_bool_value(false);
+
+  attribute = attributes->Add();
+  attribute->set_key("int");
+  attribute->mutable_value()->set_int_value(-1234567890123LL);
+
+  attribute = attributes->Add();
+  attribute->set_key("double");
+  attribute->mutable_value()->set_double_value(0.1);
+
+  attribute = attributes->Add();
+  attribute->set_key("bytes");
+  attribute->mutable_value()->set_bytes_value(std::string("\x00\x01\xfe", 3));
+
+  attribute = attributes->Add();
+  attribute->set_key("array");
+  auto array_value = attribute->mutable_value()->mutable_array_value();
+  array_value->add_values()->set_int_value(5);
+  array_value->add_values()->set_string_value("x");
+
+  attribute = attributes->Add();
+  attribute->set_key("kvlist");
+  auto kvlist_value = attribute->mutable_value()->mutable_kvlist_value()->add_values();
+  kvlist_value->set_key("k");
+  kvlist_value->mutable_value()->set_double_value(3.25);
+
+  attribute = attributes->Add();
+  attribute->set_key("empty");
+  attribute->mutable_value();
+}
+
+// The reflection path writes empty messages as null, and the direct path as {}
+void NormalizeEmptyMessages(nlohmann::json &value)
+{
+  if (value.is_null())
+  {
+    value = nlohmann::json::object();
+  }
+  else if (value.is_object() || value.is_array())
+  {
+    for (auto &child : value)
+    {
+      NormalizeEmptyMessages(child);
+    }
+  }
+}
+
+void ExpectSameAsReflection(const google::protobuf::Message &message)
+{
+  for (auto bytes_mapping : kBytesMappings)
+  {
+    OtlpJsonOptions options;
+    options.json_bytes_mapping = bytes_mapping;
+
+    std::vector<uint8_t> direct;
+    std::vector<uint8_t> reflection;
+    OtlpJsonWriter::Write(message, options, direct);
+    OtlpJsonWriter::WriteWithReflection(message, options, reflection);
+
+    auto direct_json     = nlohmann::json::parse(direct.begin(), direct.end());
+    auto reflection_json = nlohmann::json::parse(reflection.begin(), reflection.end());
+    NormalizeEmptyMessages(reflection_json);
+    EXPECT_EQ(direct_json, reflection_json);
+  }
+}
+
+}  // namespace
+
+TEST(OtlpJsonWriter, WriteTraces)
+{
+  proto::collector::trace::v1::ExportTraceServiceRequest request;
+  auto resource_spans = request.add_resource_spans();
+  AddAttributes(resource_spans->mutable_resource()->mutable_attributes());
+  resource_spans->set_schema_url("https://opentelemetry.io/schemas/1.2.0");
+
+  auto scope_spans = resource_spans->add_scope_spans();
+  scope_spans->mutable_scope()->set_name("scope");
+  scope_spans->mutable_scope()->set_version("1.0");
+
+  auto span = scope_spans->add_spans();
+  span->set_trace_id(std::string(16, '\x12'));
+  span->set_span_id(std::string(8, '\xab'));
+  span->set_parent_span_id(std::string(8, '\x01'));
+  span->set_name("span");
+  span->set_kind(proto::trace::v1::Span::SPAN_KIND_SERVER);
+  span->set_start_time_unix_nano(18446744073709551615ULL);
+  span->set_end_time_unix_nano(2);
+  AddAttributes(span->mutable_attributes());
+  span->set_dropped_attributes_count(3);
+
+  auto event = span->add_events();
+  event->set_name("event");
+  event->set_time_unix_nano(5);
+  AddAttributes(event->mutable_attributes());
+
+  auto link = span->add_links();
+  link->set_trace_id(std::string(16, '\x02'));
+  link->set_span_id(std::string(8, '\x03'));
+  link->set_trace_state("k=v");
+
+  span->mutable_status()->set_code(proto::trace::v1::Status::STATUS_CODE_ERROR);
+  span->mutable_status()->set_message("error");
+
+  scope_spans->add_spans();
+  request.add_resource_spans();
+
+  ExpectSameAsReflection(request);
+}
+
+TEST(OtlpJsonWriter, WriteLogs)
+{
+  proto::collector::logs::v1::ExportLogsServiceRequest request;
+  auto scope_logs = request.add_resource_logs()->add_scope_logs();
+  scope_logs->mutable_scope()->set_name("scope");
+
+  auto log_record = scope_logs->add_log_records();
+  log_record->set_time_unix_nano(1);
+  log_record->set_observed_time_unix_nano(2);
+  log_record->set_severity_number(proto::logs::v1::SEVERITY_NUMBER_WARN);
+  log_record->set_severity_text("WARN");
+  log_record->mutable_body()->set_string_value("body");
+  AddAttributes(log_record->mutable_attributes());
+  log_record->set_flags(1);
+  log_record->set_trace_id(std::string(16, '\x07'));
+  log_record->set_span_id(std::string(8, '\x08'));
+
+  ExpectSameAsReflection(request);
+}
+
+TEST(OtlpJsonWriter, WriteMetrics)
+{
+  proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+  auto scope_metrics = request.add_resource_metrics()->add_scope_metrics();
+  scope_metrics->mutable_scope()->set_name("scope");
+
+  auto gauge = scope_metrics->add_metrics();
+  gauge->set_name("gauge");
+  gauge->set_unit("1");
+  auto gauge_point = gauge->mutable_gauge()->add_data_points();
+  gauge_point->set_as_double(0);
+  gauge_point->set_time_unix_nano(9);
+  AddAttributes(gauge_point->mutable_attributes());
+  auto exemplar = gauge_point->add_exemplars();
+  exemplar->set_as_int(0);
+  exemplar->set_span_id(std::string(8, '\x09'));
+
+  auto sum = scope_metrics->add_metrics();
+  sum->set_name("sum");
+  sum->set_description("description");
+  sum->mutable_sum()->set_is_monotonic(true);
+  sum->mutable_sum()->set_aggregation_temporality(
+      proto::metrics::v1::AGGREGATION_TEMPORALITY_DELTA);
+  sum->mutable_sum()->add_data_points()->set_as_int(-7);
+
+  auto histogram       = scope_metrics->add_metrics();
+  auto histogram_point = histogram->mutable_histogram()->add_data_points();
+  histogram->set_name("histogram");
+  histogram_point->set_count(10);
+  histogram_point->set_sum(0);
+  histogram_point->add_bucket_counts(0);
+  histogram_point->add_bucket_counts(10);
+  histogram_point->add_explicit_bounds(1.5);
+  histogram_point->set_min(-1);
+  histogram_point->set_max(2.5);
+
+  auto exponential_histogram = scope_metrics->add_metrics();
+  auto exponential_point =
+      exponential_histogram->mutable_exponential_histogram()->add_data_points();
+  exponential_histogram->set_name("exponential_histogram");
+  exponential_point->set_scale(-3);
+  exponential_point->set_zero_count(2);
+  exponential_point->mutable_positive()->set_offset(-2);
+  exponential_point->mutable_positive()->add_bucket_counts(4);
+
+  auto summary       = scope_metrics->add_metrics();
+  auto summary_point = summary->mutable_summary()->add_data_points();
+  summary->set_name("summary");
+  summary_point->set_sum(3);
+  summary_point->add_quantile_values()->set_quantile(0.5);
+
+  ExpectSameAsReflection(request);
+}
+
+TEST(OtlpJsonWriter, WriteEmptyRequest)
+{
+  proto::collector::trace::v1::ExportTraceServiceRequest request;
+  std::vector<uint8_t> output;
+  OtlpJsonWriter::Write(request, OtlpJsonOptions(), output);
+  EXPECT_EQ(std::string(output.begin(), output.end()), "{}");
+}
+
+TEST(OtlpJsonWriter, WriteDoublesIndependentlyOfLocale)
+{
+  proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+  auto gauge = request.add_resource_metrics()->add_scope_metrics()->add_metrics()->mutable_gauge();
+  gauge->add_data_points()->set_as_double(0.5);
+  gauge->add_data_points()->set_as_double(1e300);
+
+  // Use a locale with a decimal comma if one is installed, the output must not change.
+  std::string previous_locale = std::setlocale(LC_NUMERIC, nullptr);
+  for (const char *locale : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"})
+  {
+    if (std::setlocale(LC_NUMERIC, locale) != nullptr)
+    {
+      break;
+    }
+  }
+
+  std::vector<uint8_t> output;
+  OtlpJsonWriter::Write(request, OtlpJsonOptions(), output);
+  std::setlocale(LC_NUMERIC, previous_locale.c_str());
+
+  std::string json(output.begin(), output.end());
+  EXPECT_NE(json.find(":0.5}"), std::string::npos) << json;
+  EXPECT_NE(json.find(":1e+300}"), std::string::npos) << json;
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "opentelemetry/exporters/otlp/otlp_metric_utils.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
 #include "opentelemetry/proto/metrics/v1/metrics.pb.h"
 
 #include <gtest/gtest.h>
@@ -103,6 +105,47 @@ static metrics_sdk::MetricData CreateHistogramAggregationData()
   return data;
 }
 
+static metrics_sdk::MetricData CreateExponentialHistogramAggregationData()
+{
+  metrics_sdk::MetricData data;
+  data.start_ts = opentelemetry::common::SystemTimestamp(std::chrono::system_clock::now());
+  metrics_sdk::InstrumentDescriptor inst_desc = {"ExponentialHistogram", "desc", "unit",
+                                                 metrics_sdk::InstrumentType::kHistogram,
+                                                 metrics_sdk::InstrumentValueType::kDouble};
+  metrics_sdk::ExponentialHistogramPointData s_data_1, s_data_2;
+  s_data_1.sum_                      = 11.0;
+  s_data_1.count_                    = 5;
+  s_data_1.min_                      = -3.0;
+  s_data_1.max_                      = 8.0;
+  s_data_1.zero_count_               = 1;
+  s_data_1.scale_                    = 0;
+  s_data_1.positive_buckets_.offset_ = 0;
+  s_data_1.positive_buckets_.counts_ = {1, 1, 1};
+  s_data_1.negative_buckets_.offset_ = 1;
+  s_data_1.negative_buckets_.counts_ = {1};
+  s_data_2.sum_                      = 6.0;
+  s_data_2.count_                    = 2;
+  s_data_2.scale_                    = -1;
+  s_data_2.record_min_max_           = false;
+  s_data_2.positive_buckets_.offset_ = -2;
+  s_data_2.positive_buckets_.counts_ = {2};
+
+  data.aggregation_temporality = metrics_sdk::AggregationTemporality::kDelta;
+  data.end_ts = opentelemetry::common::SystemTimestamp(std::chrono::system_clock::now());
+  data.instrument_descriptor = inst_desc;
+  metrics_sdk::PointDataAttributes point_data_attr_1, point_data_attr_2;
+  point_data_attr_1.attributes = {{"k1", "v1"}};
+  point_data_attr_1.point_data = s_data_1;
+
+  point_data_attr_2.attributes = {{"k2", "v2"}};
+  point_data_attr_2.point_data = s_data_2;
+  std::vector<metrics_sdk::PointDataAttributes> point_data_attr;
+  point_data_attr.push_back(point_data_attr_1);
+  point_data_attr.push_back(point_data_attr_2);
+  data.point_data_attr_ = std::move(point_data_attr);
+  return data;
+}
+
 static metrics_sdk::MetricData CreateObservableGaugeAggregationData()
 {
   metrics_sdk::MetricData data;
@@ -177,6 +220,49 @@ TEST(OtlpMetricSerializationTest, Histogram)
   EXPECT_EQ(1, 1);
 }
 
+TEST(OtlpMetricSerializationTest, ExponentialHistogram)
+{
+  metrics_sdk::MetricData data = CreateExponentialHistogramAggregationData();
+  EXPECT_EQ(otlp_exporter::OtlpMetricUtils::GetAggregationType(data),
+            metrics_sdk::AggregationType::kBase2ExponentialHistogram);
+
+  opentelemetry::proto::metrics::v1::Metric metric;
+  otlp_exporter::OtlpMetricUtils::PopulateInstrumentInfoMetrics(data, &metric);
+  ASSERT_TRUE(metric.has_exponential_histogram());
+  auto &histogram = metric.exponential_histogram();
+  EXPECT_EQ(histogram.aggregation_temporality(),
+            proto::metrics::v1::AggregationTemporality::AGGREGATION_TEMPORALITY_DELTA);
+  ASSERT_EQ(histogram.data_points_size(), 2);
+
+  auto &point_1 = histogram.data_points(0);
+  EXPECT_EQ(point_1.sum(), 11.0);
+  EXPECT_EQ(point_1.count(), 5);
+  EXPECT_TRUE(point_1.has_min());
+  EXPECT_EQ(point_1.min(), -3.0);
+  EXPECT_EQ(point_1.max(), 8.0);
+  EXPECT_EQ(point_1.zero_count(), 1);
+  EXPECT_EQ(point_1.scale(), 0);
+  EXPECT_EQ(point_1.positive().offset(), 0);
+  ASSERT_EQ(point_1.positive().bucket_counts_size(), 3);
+  EXPECT_EQ(point_1.positive().bucket_counts(2), 1);
+  EXPECT_EQ(point_1.negative().offset(), 1);
+  ASSERT_EQ(point_1.negative().bucket_counts_size(), 1);
+  EXPECT_EQ(point_1.negative().bucket_counts(0), 1);
+  ASSERT_EQ(point_1.attributes_size(), 1);
+  EXPECT_EQ(point_1.attributes(0).key(), "k1");
+
+  auto &point_2 = histogram.data_points(1);
+  EXPECT_EQ(point_2.sum(), 6.0);
+  EXPECT_EQ(point_2.count(), 2);
+  EXPECT_FALSE(point_2.has_min());
+  EXPECT_FALSE(point_2.has_max());
+  EXPECT_EQ(point_2.scale(), -1);
+  EXPECT_EQ(point_2.positive().offset(), -2);
+  ASSERT_EQ(point_2.positive().bucket_counts_size(), 1);
+  EXPECT_EQ(point_2.positive().bucket_counts(0), 2);
+  EXPECT_EQ(point_2.negative().bucket_counts_size(), 0);
+}
+
 TEST(OtlpMetricSerializationTest, ObservableGauge)
 {
   metrics_sdk::MetricData data = CreateObservableGaugeAggregationData();
@@ -191,6 +277,34 @@ TEST(OtlpMetricSerializationTest, ObservableGauge)
   EXPECT_EQ(1, 1);
 }
 
+// The instrumentation scope attributes are exported, with or without a resource cache
+TEST(OtlpMetricSerializationTest, PopulateRequestScopeAttributes)
+{
+  auto resource = resource::Resource::Create({{"service.name", "one"}});
+  auto scope    = opentelemetry::sdk::instrumentationscope::InstrumentationScope::Create(
+      "scope", "1", "", {{"scope_key", "scope_value"}});
+  std::vector<metrics_sdk::ScopeMetrics> scope_metrics{
+      metrics_sdk::ScopeMetrics(scope.get(), std::vector<metrics_sdk::MetricData>{
+                                                 CreateSumAggregationData()})};
+  metrics_sdk::ResourceMetrics data(&resource, scope_metrics);
+
+  OtlpResourceCache cache;
+  for (OtlpResourceCache *populate_cache : {static_cast<OtlpResourceCache *>(nullptr), &cache})
+  {
+    proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+    otlp_exporter::OtlpMetricUtils::PopulateRequest(data, &request, populate_cache);
+
+    ASSERT_EQ(request.resource_metrics_size(), 1);
+    ASSERT_EQ(request.resource_metrics(0).scope_metrics_size(), 1);
+    auto &proto_scope = request.resource_metrics(0).scope_metrics(0).scope();
+    EXPECT_EQ(proto_scope.name(), "scope");
+    EXPECT_EQ(proto_scope.version(), "1");
+    ASSERT_EQ(proto_scope.attributes_size(), 1);
+    EXPECT_EQ(proto_scope.attributes(0).key(), "scope_key");
+    EXPECT_EQ(proto_scope.attributes(0).value().string_value(), "scope_value");
+  }
+}
+
 }  // namespace otlp
 }  // namespace exporter
 OPENTELEMETRY_END_NAMESPACE
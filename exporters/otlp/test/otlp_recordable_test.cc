@@ -373,6 +373,151 @@ TEST(OtlpRecordable, PopulateRequestMissing)
   }
 }
 
+// Test otlp resource populate request util with interleaved resources and scopes
+TEST(OtlpRecordable, PopulateRequestInterleaved)
+{
+  auto resource1 = resource::Resource::Create({{"service.name", "one"}});
+  auto resource2 = resource::Resource::Create({{"service.name", "two"}});
+  auto inst_lib1 = trace_sdk::InstrumentationScope::Create("one", "1", "", {{"key", "value"}});
+  auto inst_lib2 = trace_sdk::InstrumentationScope::Create("two", "2");
+
+  std::vector<std::unique_ptr<sdk::trace::Recordable>> spans;
+  const std::pair<const resource::Resource *, const trace_sdk::InstrumentationScope *> sources[] = {
+      {&resource1, inst_lib1.get()}, {&resource2, inst_lib1.get()}, {&resource1, inst_lib2.get()},
+      {&resource1, inst_lib1.get()}, {&resource2, inst_lib1.get()}, {&resource1, inst_lib1.get()}};
+  for (auto &source : sources)
+  {
+    auto rec = std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+    rec->SetResource(*source.first);
+    rec->SetInstrumentationScope(*source.second);
+    spans.push_back(std::move(rec));
+  }
+
+  proto::collector::trace::v1::ExportTraceServiceRequest req;
+  const nostd::span<std::unique_ptr<sdk::trace::Recordable>> spans_span(spans.data(),
+                                                                        spans.size());
+  OtlpRecordableUtils::PopulateRequest(spans_span, &req);
+
+  auto service_name = [](const proto::resource::v1::Resource &proto_resource) {
+    for (auto &attribute : proto_resource.attributes())
+    {
+      if (attribute.key() == "service.name")
+      {
+        return attribute.value().string_value();
+      }
+    }
+    return std::string();
+  };
+
+  // The resources and scopes are added in the order of their first span
+  ASSERT_EQ(req.resource_spans().size(), 2);
+  auto &resource_spans1 = req.resource_spans(0);
+  EXPECT_EQ(service_name(resource_spans1.resource()), "one");
+  ASSERT_EQ(resource_spans1.scope_spans().size(), 2);
+  EXPECT_EQ(resource_spans1.scope_spans(0).scope().name(), "one");
+  EXPECT_EQ(resource_spans1.scope_spans(0).spans().size(), 3);
+  EXPECT_EQ(resource_spans1.scope_spans(1).scope().name(), "two");
+  EXPECT_EQ(resource_spans1.scope_spans(1).spans().size(), 1);
+
+  auto &resource_spans2 = req.resource_spans(1);
+  EXPECT_EQ(service_name(resource_spans2.resource()), "two");
+  ASSERT_EQ(resource_spans2.scope_spans().size(), 1);
+  EXPECT_EQ(resource_spans2.scope_spans(0).spans().size(), 2);
+
+  // The instrumentation scope attributes are exported without a resource cache too
+  auto &scope = resource_spans2.scope_spans(0).scope();
+  EXPECT_EQ(scope.name(), "one");
+  ASSERT_EQ(scope.attributes().size(), 1);
+  EXPECT_EQ(scope.attributes(0).key(), "key");
+  EXPECT_EQ(scope.attributes(0).value().string_value(), "value");
+}
+
+// Test otlp resource populate request util with a resource cache
+TEST(OtlpRecordable, PopulateRequestWithCache)
+{
+  auto resource = resource::Resource::Create({{"service.name", "one"}});
+  auto inst_lib = trace_sdk::InstrumentationScope::Create("one", "1", "", {{"key", "value"}});
+  OtlpResourceCache cache;
+
+  for (int i = 0; i < 2; i++)
+  {
+    auto rec = std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+    rec->SetResource(resource);
+    rec->SetInstrumentationScope(*inst_lib);
+
+    proto::collector::trace::v1::ExportTraceServiceRequest req;
+    std::vector<std::unique_ptr<sdk::trace::Recordable>> spans;
+    spans.push_back(std::move(rec));
+    const nostd::span<std::unique_ptr<sdk::trace::Recordable>, 1> spans_span(spans.data(), 1);
+    OtlpRecordableUtils::PopulateRequest(spans_span, &req, &cache);
+
+    ASSERT_EQ(req.resource_spans().size(), 1);
+    auto resource_spans = req.resource_spans(0);
+    bool has_service_name = false;
+    for (auto &attribute : resource_spans.resource().attributes())
+    {
+      if (attribute.key() == "service.name")
+      {
+        has_service_name = true;
+        EXPECT_EQ(attribute.value().string_value(), "one");
+      }
+    }
+    EXPECT_TRUE(has_service_name);
+    ASSERT_EQ(resource_spans.scope_spans().size(), 1);
+    auto scope = resource_spans.scope_spans(0).scope();
+    EXPECT_EQ(scope.name(), "one");
+    EXPECT_EQ(scope.version(), "1");
+    ASSERT_EQ(scope.attributes().size(), 1);
+    EXPECT_EQ(scope.attributes(0).key(), "key");
+  }
+}
+
+// Test that the cache converts again the objects changed at the same address
+TEST(OtlpRecordable, PopulateRequestWithCacheAfterChange)
+{
+  auto resource = resource::Resource::Create({{"service.name", "one"}});
+  auto inst_lib = trace_sdk::InstrumentationScope::Create("one", "1", "", {{"key", "one"}});
+  OtlpResourceCache cache;
+
+  for (int i = 0; i < 2; i++)
+  {
+    if (i == 1)
+    {
+      // Same number of attributes, same schema url and same hash code of the scope
+      resource = resource::Resource::Create({{"service.name", "two"}});
+      inst_lib->SetAttribute("key", "two");
+    }
+
+    auto rec = std::unique_ptr<sdk::trace::Recordable>(new OtlpRecordable);
+    rec->SetResource(resource);
+    rec->SetInstrumentationScope(*inst_lib);
+
+    proto::collector::trace::v1::ExportTraceServiceRequest req;
+    std::vector<std::unique_ptr<sdk::trace::Recordable>> spans;
+    spans.push_back(std::move(rec));
+    const nostd::span<std::unique_ptr<sdk::trace::Recordable>, 1> spans_span(spans.data(), 1);
+    OtlpRecordableUtils::PopulateRequest(spans_span, &req, &cache);
+
+    const char *expected = i == 0 ? "one" : "two";
+    ASSERT_EQ(req.resource_spans().size(), 1);
+    auto resource_spans = req.resource_spans(0);
+    bool has_service_name = false;
+    for (auto &attribute : resource_spans.resource().attributes())
+    {
+      if (attribute.key() == "service.name")
+      {
+        has_service_name = true;
+        EXPECT_EQ(attribute.value().string_value(), expected);
+      }
+    }
+    EXPECT_TRUE(has_service_name);
+    ASSERT_EQ(resource_spans.scope_spans().size(), 1);
+    auto scope = resource_spans.scope_spans(0).scope();
+    ASSERT_EQ(scope.attributes().size(), 1);
+    EXPECT_EQ(scope.attributes(0).value().string_value(), expected);
+  }
+}
+
 template <typename T>
 struct EmptyArrayAttributeTest : public testing::Test
 {
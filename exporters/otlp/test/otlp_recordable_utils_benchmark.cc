@@ -0,0 +1,80 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/resource/resource.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+namespace otlp     = opentelemetry::exporter::otlp;
+namespace proto    = opentelemetry::proto;
+namespace resource = opentelemetry::sdk::resource;
+namespace sdk      = opentelemetry::sdk;
+
+const int kBatchSize = 32;
+
+resource::Resource CreateResource(int num_attributes)
+{
+  resource::ResourceAttributes attributes;
+  for (int i = 0; i < num_attributes; i++)
+  {
+    attributes.SetAttribute("resource.attribute_" + std::to_string(i), "value");
+  }
+  return resource::Resource::Create(attributes);
+}
+
+// Populate a request with a batch of spans of the same resource and scope. The first argument is
+// the number of resource attributes, the second whether the resource cache is used.
+void BM_OtlpRecordableUtilsPopulateRequest(benchmark::State &state)
+{
+  auto span_resource = CreateResource(static_cast<int>(state.range(0)));
+  auto scope         = sdk::instrumentationscope::InstrumentationScope::Create(
+      "benchmark", "1.0", "", {{"scope.attribute", "value"}});
+  otlp::OtlpResourceCache cache;
+  otlp::OtlpResourceCache *populate_cache = state.range(1) != 0 ? &cache : nullptr;
+
+  std::vector<std::unique_ptr<sdk::trace::Recordable>> spans(kBatchSize);
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    for (auto &span : spans)
+    {
+      span.reset(new otlp::OtlpRecordable);
+      span->SetResource(span_resource);
+      span->SetInstrumentationScope(*scope);
+      span->SetName("span");
+    }
+    proto::collector::trace::v1::ExportTraceServiceRequest request;
+    state.ResumeTiming();
+
+    otlp::OtlpRecordableUtils::PopulateRequest(
+        opentelemetry::nostd::span<std::unique_ptr<sdk::trace::Recordable>>(spans.data(),
+                                                                            spans.size()),
+        &request, populate_cache);
+    benchmark::DoNotOptimize(request.resource_spans_size());
+  }
+}
+BENCHMARK(BM_OtlpRecordableUtilsPopulateRequest)
+    ->ArgsProduct({{1, 16, 64}, {0, 1}})
+    ->ArgNames({"attributes", "cache"});
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,223 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/exporters/otlp/otlp_wire_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+#include "opentelemetry/exporters/otlp/otlp_resource_cache.h"
+#include "opentelemetry/sdk/resource/resource.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <gtest/gtest.h>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+namespace trace_api = opentelemetry::trace;
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace resource  = opentelemetry::sdk::resource;
+
+namespace
+{
+
+// Records the same span in an OtlpRecordable and an OtlpWireRecordable, and checks that the
+// requests of both are the same.
+class WireRecordableChecker
+{
+public:
+  template <typename Function>
+  void Record(Function function)
+  {
+    function(*recordable_);
+    function(*wire_recordable_);
+  }
+
+  void ExpectSameRequests()
+  {
+    std::vector<std::unique_ptr<trace_sdk::Recordable>> spans;
+    spans.push_back(std::move(recordable_));
+    proto::collector::trace::v1::ExportTraceServiceRequest expected;
+    OtlpRecordableUtils::PopulateRequest(
+        nostd::span<std::unique_ptr<trace_sdk::Recordable>>(spans.data(), spans.size()),
+        &expected);
+
+    std::vector<std::unique_ptr<trace_sdk::Recordable>> wire_spans;
+    wire_spans.push_back(std::move(wire_recordable_));
+    std::vector<uint8_t> body;
+    OtlpWireRecordable::SerializeRequest(
+        nostd::span<std::unique_ptr<trace_sdk::Recordable>>(wire_spans.data(), wire_spans.size()),
+        &body);
+
+    proto::collector::trace::v1::ExportTraceServiceRequest actual;
+    ASSERT_TRUE(actual.ParseFromArray(body.data(), static_cast<int>(body.size())));
+    EXPECT_EQ(actual.SerializeAsString(), expected.SerializeAsString());
+    EXPECT_EQ(actual.DebugString(), expected.DebugString());
+  }
+
+private:
+  std::unique_ptr<trace_sdk::Recordable> recordable_{new OtlpRecordable};
+  std::unique_ptr<trace_sdk::Recordable> wire_recordable_{new OtlpWireRecordable};
+};
+
+trace_api::SpanContext MakeSpanContext(uint8_t seed, nostd::string_view trace_state)
+{
+  uint8_t trace_id_buf[trace_api::TraceId::kSize] = {seed, 1};
+  uint8_t span_id_buf[trace_api::SpanId::kSize]   = {seed, 2};
+  auto state                                      = trace_api::TraceState::GetDefault();
+  if (!trace_state.empty())
+  {
+    state = state->Set("key", trace_state);
+  }
+  return trace_api::SpanContext{trace_api::TraceId{trace_id_buf}, trace_api::SpanId{span_id_buf},
+                                trace_api::TraceFlags{trace_api::TraceFlags::kIsSampled}, true,
+                                state};
+}
+
+}  // namespace
+
+TEST(OtlpWireRecordable, EncodeSpan)
+{
+  auto resource = resource::Resource::Create({{"service.name", "wire"}}, "resource_schema");
+  auto scope = trace_sdk::InstrumentationScope::Create("scope", "1.0", "scope_schema", {{"k", 1}});
+  const uint8_t parent_span_id_buf[trace_api::SpanId::kSize] = {8, 7, 6, 5, 4, 3, 2, 1};
+
+  WireRecordableChecker checker;
+  checker.Record([&](trace_sdk::Recordable &recordable) {
+    recordable.SetResource(resource);
+    recordable.SetInstrumentationScope(*scope);
+    recordable.SetIdentity(MakeSpanContext(1, "value"), trace_api::SpanId{parent_span_id_buf});
+    recordable.SetName("span");
+    recordable.SetSpanKind(trace_api::SpanKind::kServer);
+    recordable.SetStartTime(common::SystemTimestamp(std::chrono::seconds(1700000000)));
+    recordable.SetDuration(std::chrono::milliseconds(3));
+    recordable.SetStatus(trace_api::StatusCode::kError, "failure");
+  });
+  checker.ExpectSameRequests();
+}
+
+TEST(OtlpWireRecordable, EncodeAttributes)
+{
+  const bool bools[]                      = {true, false};
+  const uint8_t bytes[]                   = {0, 255};
+  const int ints[]                        = {-1, 1};
+  const int64_t int64s[]                  = {INT64_MIN, INT64_MAX};
+  const unsigned int uints[]              = {0, UINT32_MAX};
+  const uint64_t uint64s[]                = {0, UINT64_MAX};
+  const double doubles[]                  = {-1.5, 1e300};
+  const nostd::string_view string_views[] = {"", "value"};
+
+  // Longer than the single byte reserved for the size of a message
+  const std::string long_value(20000, 'x');
+
+  WireRecordableChecker checker;
+  checker.Record([&](trace_sdk::Recordable &recordable) {
+    recordable.SetAttribute("bool", false);
+    recordable.SetAttribute("int", -42);
+    recordable.SetAttribute("int64", int64_t{-1234567890123});
+    recordable.SetAttribute("uint", 42u);
+    recordable.SetAttribute("uint64", UINT64_MAX);
+    recordable.SetAttribute("double", 0.25);
+    recordable.SetAttribute("c_string", "value");
+    recordable.SetAttribute("empty_string", nostd::string_view());
+    recordable.SetAttribute("long_string", nostd::string_view(long_value));
+    recordable.SetAttribute("bools", nostd::span<const bool>(bools));
+    recordable.SetAttribute("bytes", nostd::span<const uint8_t>(bytes));
+    recordable.SetAttribute("ints", nostd::span<const int>(ints));
+    recordable.SetAttribute("int64s", nostd::span<const int64_t>(int64s));
+    recordable.SetAttribute("uints", nostd::span<const unsigned int>(uints));
+    recordable.SetAttribute("uint64s", nostd::span<const uint64_t>(uint64s));
+    recordable.SetAttribute("doubles", nostd::span<const double>(doubles));
+    recordable.SetAttribute("strings", nostd::span<const nostd::string_view>(string_views));
+    recordable.SetAttribute("empty_array", nostd::span<const int>());
+  });
+  checker.ExpectSameRequests();
+}
+
+TEST(OtlpWireRecordable, EncodeEventsAndLinks)
+{
+  const std::string long_value(200, 'x');
+  std::map<std::string, std::string> attributes = {{"key1", "value1"}, {"key2", long_value}};
+
+  WireRecordableChecker checker;
+  checker.Record([&](trace_sdk::Recordable &recordable) {
+    recordable.AddEvent("event", common::SystemTimestamp(std::chrono::seconds(1)),
+                        common::KeyValueIterableView<std::map<std::string, std::string>>(
+                            attributes));
+    recordable.AddEvent("", common::SystemTimestamp(), common::NoopKeyValueIterable());
+    recordable.AddLink(MakeSpanContext(2, "value"),
+                       common::KeyValueIterableView<std::map<std::string, std::string>>(
+                           attributes));
+    recordable.AddLink(MakeSpanContext(3, ""), common::NoopKeyValueIterable());
+  });
+  checker.ExpectSameRequests();
+}
+
+TEST(OtlpWireRecordable, LastValueWins)
+{
+  WireRecordableChecker checker;
+  checker.Record([&](trace_sdk::Recordable &recordable) {
+    recordable.SetName("first");
+    recordable.SetName("second");
+    recordable.SetStatus(trace_api::StatusCode::kError, "failure");
+    recordable.SetStatus(trace_api::StatusCode::kOk, "");
+  });
+  checker.ExpectSameRequests();
+}
+
+TEST(OtlpWireRecordable, SerializeRequestWithCache)
+{
+  auto resource = resource::Resource::Create({{"service.name", "wire"}});
+  auto scope_1  = trace_sdk::InstrumentationScope::Create("scope_1");
+  auto scope_2  = trace_sdk::InstrumentationScope::Create("scope_2", "2.0");
+  OtlpResourceCache cache;
+
+  std::vector<std::unique_ptr<trace_sdk::Recordable>> spans;
+  for (int i = 0; i < 4; i++)
+  {
+    std::unique_ptr<trace_sdk::Recordable> recordable{new OtlpWireRecordable};
+    recordable->SetResource(resource);
+    recordable->SetInstrumentationScope(i % 2 ? *scope_1 : *scope_2);
+    recordable->SetName("span");
+    spans.push_back(std::move(recordable));
+  }
+  nostd::span<std::unique_ptr<trace_sdk::Recordable>> spans_span(spans.data(), spans.size());
+
+  std::vector<uint8_t> body;
+  OtlpWireRecordable::SerializeRequest(spans_span, &body, &cache);
+  std::vector<uint8_t> body_with_cached_resource;
+  OtlpWireRecordable::SerializeRequest(spans_span, &body_with_cached_resource, &cache);
+  std::vector<uint8_t> body_without_cache;
+  OtlpWireRecordable::SerializeRequest(spans_span, &body_without_cache);
+  EXPECT_EQ(body, body_with_cached_resource);
+  EXPECT_EQ(body, body_without_cache);
+
+  proto::collector::trace::v1::ExportTraceServiceRequest request;
+  ASSERT_TRUE(request.ParseFromArray(body.data(), static_cast<int>(body.size())));
+  ASSERT_EQ(request.resource_spans_size(), 1);
+  bool has_service_name = false;
+  for (auto &attribute : request.resource_spans(0).resource().attributes())
+  {
+    if (attribute.key() == "service.name")
+    {
+      has_service_name = true;
+      EXPECT_EQ(attribute.value().string_value(), "wire");
+    }
+  }
+  EXPECT_TRUE(has_service_name);
+  ASSERT_EQ(request.resource_spans(0).scope_spans_size(), 2);
+  for (auto &scope_spans : request.resource_spans(0).scope_spans())
+  {
+    EXPECT_EQ(scope_spans.spans_size(), 2);
+  }
+}
+
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
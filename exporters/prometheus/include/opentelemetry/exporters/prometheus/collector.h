@@ -5,11 +5,13 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include <prometheus/collectable.h>
 #include <prometheus/metric_family.h>
 #include "opentelemetry/exporters/prometheus/exporter_utils.h"
+#include "opentelemetry/exporters/prometheus/text_writer.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
 
 namespace prometheus_client = ::prometheus;
@@ -42,11 +44,25 @@ class PrometheusCollector : public prometheus_client::Collectable
    */
   std::vector<prometheus_client::MetricFamily> Collect() const override;
 
+  /**
+   * Collects all metrics data and writes them in the Prometheus text exposition format, without
+   * building the intermediate MetricFamily collection. Meant for an HTTP handler writing directly
+   * to its response.
+   *
+   * @param output the string to append the metrics to
+   */
+  void CollectText(std::string &output);
+
 private:
   sdk::metrics::MetricReader *reader_;
   bool populate_target_info_;
   bool populate_otel_scope_;
 
+  /*
+   * Writer of CollectText, keeping the sanitized names from one collection to the next
+   */
+  PrometheusTextWriter text_writer_;
+
   /*
    * Lock when operating the metricsToCollect collection
    */
@@ -28,6 +28,7 @@ namespace exporter
 {
 namespace metrics
 {
+class PrometheusTextServer;
 
 class PrometheusExporter : public sdk::metrics::MetricReader
 {
@@ -39,6 +40,8 @@ class PrometheusExporter : public sdk::metrics::MetricReader
    */
   PrometheusExporter(const PrometheusExporterOptions &options);
 
+  ~PrometheusExporter() override;
+
   sdk::metrics::AggregationTemporality GetAggregationTemporality(
       sdk::metrics::InstrumentType instrument_type) const noexcept override;
 
@@ -58,6 +61,12 @@ class PrometheusExporter : public sdk::metrics::MetricReader
    */
   std::unique_ptr<::prometheus::Exposer> exposer_;
 
+  /**
+   * Pointer to the HTTP server writing the collector text,
+   * used instead of the exposer when use_text_writer is set
+   */
+  std::unique_ptr<PrometheusTextServer> text_server_;
+
   bool OnForceFlush(std::chrono::microseconds timeout) noexcept override;
 
   bool OnShutDown(std::chrono::microseconds timeout) noexcept override;
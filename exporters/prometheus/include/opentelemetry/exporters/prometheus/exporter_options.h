@@ -28,6 +28,12 @@ struct PrometheusExporterOptions
 
   // Populating otel_scope_name/otel_scope_labels attributes
   bool populate_otel_scope = true;
+
+  // Serve scrapes with the streaming text writer of PrometheusCollector::CollectText instead of
+  // the prometheus-cpp Exposer. The url is then "host:port" or "[host]:port", where the host is a
+  // numeric IPv4 or IPv6 address, "localhost" for both loopback addresses, or empty for all the
+  // interfaces. Scrapes are served in turn by one thread, without authentication nor TLS.
+  bool use_text_writer = false;
 };
 
 }  // namespace metrics
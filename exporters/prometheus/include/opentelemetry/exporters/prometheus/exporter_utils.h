@@ -48,6 +48,14 @@ class PrometheusExporterUtils
    */
   static std::string SanitizeNames(std::string name);
 
+  /**
+   * Sanitize the given metric label key according to Prometheus rule. The sanitized keys are
+   * cached.
+   *
+   * @param label_key label key
+   */
+  static std::string SanitizeLabel(std::string label_key);
+
   /**
    * Sanitize the given metric name or label according to Prometheus rule.
    *
@@ -59,6 +67,10 @@ class PrometheusExporterUtils
                                  std::string value,
                                  std::vector<::prometheus::ClientMetric::Label> *labels);
 
+  /**
+   * Translate the name of an instrument to a Prometheus metric name. The translated names are
+   * cached by name, unit and type.
+   */
   static std::string MapToPrometheusName(const std::string &name,
                                          const std::string &unit,
                                          ::prometheus::MetricType prometheus_type);
@@ -135,6 +147,14 @@ class PrometheusExporterUtils
   static opentelemetry::sdk::metrics::AggregationType getAggregationType(
       const opentelemetry::sdk::metrics::PointType &point_type);
 
+  /**
+   * Convert the buckets of an exponential histogram into explicit boundaries and counts
+   */
+  static void ConvertExponentialBuckets(
+      const opentelemetry::sdk::metrics::ExponentialHistogramPointData &point_data,
+      std::vector<double> &boundaries,
+      std::vector<uint64_t> &counts);
+
   /**
    * Translate the OTel metric type to Prometheus metric type
    */
@@ -214,6 +234,8 @@ class PrometheusExporterUtils
                        const std::vector<uint64_t> &counts,
                        ::prometheus::ClientMetric *metric);
 
+  friend class PrometheusTextWriter;
+
   // For testing
   friend class SanitizeNameTester;
 };
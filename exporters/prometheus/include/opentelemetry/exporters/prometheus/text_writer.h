@@ -0,0 +1,102 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <prometheus/metric_type.h>
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace metrics
+{
+/**
+ * Writes OpenTelemetry metrics data in the Prometheus text exposition format.
+ *
+ * Unlike PrometheusExporterUtils::TranslateToPrometheus, the metrics are written directly to the
+ * output, without building prometheus-cpp MetricFamily objects first. The sanitized metric and
+ * label names, and the formatted bucket bounds, are computed once per instrument and reused by the
+ * following scrapes.
+ *
+ * The writer is not thread safe.
+ */
+class PrometheusTextWriter
+{
+public:
+  /**
+   * @param populate_target_info whether to write the target_info metric
+   * @param populate_otel_scope whether to add the otel_scope_name and otel_scope_version labels
+   */
+  explicit PrometheusTextWriter(bool populate_target_info = true, bool populate_otel_scope = true);
+
+  /**
+   * Append the metrics to the output.
+   *
+   * @param data the metrics to write
+   * @param output the string to append the metrics to, for example the body of an HTTP response
+   */
+  void Write(const sdk::metrics::ResourceMetrics &data, std::string &output);
+
+private:
+  struct MetricNames
+  {
+    // The instrument the names were computed for
+    std::string unit;
+    std::string description;
+    ::prometheus::MetricType type;
+
+    // The Prometheus metric name, and the "# HELP" and "# TYPE" lines of the metric
+    std::string name;
+    std::string header;
+
+    // The last histogram boundaries, and their formatted value for the "le" label
+    std::vector<double> boundaries;
+    std::vector<std::string> bucket_bounds;
+  };
+
+  MetricNames &GetMetricNames(const sdk::metrics::InstrumentDescriptor &descriptor,
+                              ::prometheus::MetricType type);
+
+  const std::string &GetLabelName(const std::string &key);
+
+  static void AppendLabelValue(const sdk::common::OwnedAttributeValue &value, std::string &labels);
+
+  void WriteTargetInfo(const sdk::metrics::ResourceMetrics &data, std::string &output);
+
+  void WriteMetric(const sdk::metrics::MetricData &metric_data,
+                   const sdk::instrumentationscope::InstrumentationScope *scope,
+                   std::string &output);
+
+  void WriteLabels(const sdk::metrics::PointAttributes &attributes,
+                   const sdk::instrumentationscope::InstrumentationScope *scope);
+
+  void WriteHistogram(MetricNames &names,
+                      const std::vector<double> &boundaries,
+                      const std::vector<uint64_t> &counts,
+                      double sum,
+                      uint64_t count,
+                      int64_t timestamp_ms,
+                      std::string &output);
+
+  bool populate_target_info_;
+  bool populate_otel_scope_;
+
+  // Keyed by instrument name
+  std::unordered_map<std::string, MetricNames> metric_names_;
+
+  // Keyed by attribute key
+  std::unordered_map<std::string, std::string> label_names_;
+
+  // The labels of the data point being written, without the enclosing braces
+  std::string labels_;
+};
+}  // namespace metrics
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -22,7 +22,8 @@ PrometheusCollector::PrometheusCollector(sdk::metrics::MetricReader *reader,
                                          bool populate_otel_scope)
     : reader_(reader),
       populate_target_info_(populate_target_info),
-      populate_otel_scope_(populate_otel_scope)
+      populate_otel_scope_(populate_otel_scope),
+      text_writer_(populate_target_info, populate_otel_scope)
 {}
 
 /**
@@ -54,6 +55,28 @@ std::vector<prometheus_client::MetricFamily> PrometheusCollector::Collect() cons
   return result;
 }
 
+/**
+ * Collects all metrics data and writes them in the Prometheus text exposition format.
+ *
+ * @param output the string to append the metrics to
+ */
+void PrometheusCollector::CollectText(std::string &output)
+{
+  if (reader_->IsShutdown())
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[Prometheus Exporter] CollectText: "
+        "Exporter is shutdown, can not invoke collect operation.");
+    return;
+  }
+  std::lock_guard<std::mutex> guard(collection_lock_);
+
+  reader_->Collect([&output, this](sdk::metrics::ResourceMetrics &metric_data) {
+    text_writer_.Write(metric_data, output);
+    return true;
+  });
+}
+
 }  // namespace metrics
 }  // namespace exporter
 OPENTELEMETRY_END_NAMESPACE
@@ -1,15 +1,172 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <string>
+
 #include "opentelemetry/exporters/prometheus/exporter.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 
+// The server is header-only and defaults to the "testing" namespace; give this copy its own
+// namespace, so that its symbols can't clash with another copy linked into the same program.
+#define HTTP_SERVER_NS opentelemetry_prometheus_text_server
+#include "opentelemetry/ext/http/server/http_server.h"
+
 OPENTELEMETRY_BEGIN_NAMESPACE
 
 namespace exporter
 {
 namespace metrics
 {
+namespace
+{
+/**
+ * Splits an url as "host:port" or "[host]:port" into its host and its port. The host is empty for
+ * ":port".
+ */
+bool ParseHostPort(const std::string &url, std::string &host, std::string &port)
+{
+  size_t colon;
+  if (!url.empty() && url[0] == '[')
+  {
+    size_t bracket = url.find(']');
+    if (bracket == std::string::npos || bracket + 1 >= url.size() || url[bracket + 1] != ':')
+    {
+      return false;
+    }
+    host  = url.substr(1, bracket - 1);
+    colon = bracket + 1;
+  }
+  else
+  {
+    colon = url.find(':');
+    if (colon == std::string::npos || url.find(':', colon + 1) != std::string::npos)
+    {
+      return false;
+    }
+    host = url.substr(0, colon);
+  }
+  port = url.substr(colon + 1);
+  if (port.empty() || port.size() > 5 ||
+      port.find_first_not_of("0123456789") != std::string::npos || std::stoi(port) > 65535)
+  {
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+/**
+ * HTTP server answering scrapes with the text written by PrometheusCollector::CollectText,
+ * without going through the MetricFamily collection of prometheus-cpp.
+ */
+class PrometheusTextServer : public HTTP_SERVER_NS::HttpServer,
+                             public HTTP_SERVER_NS::HttpRequestCallback
+{
+public:
+  explicit PrometheusTextServer(std::shared_ptr<PrometheusCollector> collector)
+      : collector_(std::move(collector))
+  {
+    addHandler("/metrics", *this);
+  }
+
+  ~PrometheusTextServer() override
+  {
+    stop();
+    for (auto &connection : m_connections)
+    {
+      SocketTools::Socket socket = connection.first;
+      socket.close();
+    }
+  }
+
+  /**
+   * Listens on the address and port of `url`, as "host:port" or "[host]:port". The host is a
+   * numeric IPv4 or IPv6 address, "localhost" for the loopback addresses of both families, or
+   * empty for all the interfaces.
+   *
+   * @return false if the url can not be parsed, or no address of the host can be bound
+   */
+  bool Listen(const std::string &url)
+  {
+    std::string host;
+    std::string port;
+    if (!ParseHostPort(url, host, port))
+    {
+      return false;
+    }
+
+    addrinfo hints    = {};
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+    hints.ai_flags    = AI_NUMERICSERV;
+    if (host.empty())
+    {
+      hints.ai_flags |= AI_PASSIVE;
+    }
+    else if (host != "localhost")
+    {
+      hints.ai_flags |= AI_NUMERICHOST;
+    }
+    // Without a node nor AI_PASSIVE, the loopback addresses are returned.
+    const char *node    = (host.empty() || host == "localhost") ? nullptr : host.c_str();
+    addrinfo *addresses = nullptr;
+    if (::getaddrinfo(node, port.c_str(), &hints, &addresses) != 0)
+    {
+      return false;
+    }
+
+    for (addrinfo *address = addresses; address != nullptr; address = address->ai_next)
+    {
+      SocketTools::Socket socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+      if (socket.invalid())
+      {
+        continue;
+      }
+      socket.setNonBlocking();
+      socket.setReuseAddr();
+      // Bind the IPv6 wildcard apart from the IPv4 one, instead of mapping IPv4 into it.
+      if (address->ai_family == AF_INET6)
+      {
+        socket.setV6Only();
+      }
+      SocketTools::SocketAddr addr(address->ai_addr, address->ai_addrlen);
+      if (!socket.bind(addr) || !socket.listen(10))
+      {
+        OTEL_INTERNAL_LOG_WARN("[Prometheus Exporter] "
+                               << "Can't listen on address: " << addr.toString());
+        socket.close();
+        continue;
+      }
+      m_listeningSockets.push_back(socket);
+      m_reactor.addSocket(socket, SocketTools::Reactor::Acceptable);
+    }
+    ::freeaddrinfo(addresses);
+
+    if (m_listeningSockets.empty())
+    {
+      return false;
+    }
+    setServerName(url);
+    return true;
+  }
+
+  int onHttpRequest(HTTP_SERVER_NS::HttpRequest const &request,
+                    HTTP_SERVER_NS::HttpResponse &response) override
+  {
+    if (request.method != "GET")
+    {
+      return 405;
+    }
+    response.headers[HTTP_SERVER_NS::CONTENT_TYPE] = "text/plain; version=0.0.4; charset=utf-8";
+    collector_->CollectText(response.body);
+    return 200;
+  }
+
+private:
+  std::shared_ptr<PrometheusCollector> collector_;
+};
+
 /**
  * Constructor - binds an exposer and collector to the exporter
  * @param address: an address for an exposer that exposes
@@ -17,6 +174,23 @@ namespace metrics
  */
 PrometheusExporter::PrometheusExporter(const PrometheusExporterOptions &options) : options_(options)
 {
+  if (options_.use_text_writer)
+  {
+    collector_ = std::shared_ptr<PrometheusCollector>(
+        new PrometheusCollector(this, options_.populate_target_info, options_.populate_otel_scope));
+    text_server_ = std::unique_ptr<PrometheusTextServer>(new PrometheusTextServer(collector_));
+    if (!text_server_->Listen(options_.url))
+    {
+      text_server_.reset(nullptr);
+      OTEL_INTERNAL_LOG_ERROR("[Prometheus Exporter] "
+                              << "Can't listen on endpoint: " << options_.url);
+      Shutdown();  // set MetricReader in shutdown state.
+      return;
+    }
+    text_server_->start();
+    return;
+  }
+
   try
   {
     exposer_ = std::unique_ptr<::prometheus::Exposer>(new ::prometheus::Exposer{options_.url});
@@ -36,6 +210,9 @@ PrometheusExporter::PrometheusExporter(const PrometheusExporterOptions &options)
   exposer_->RegisterCollectable(collector_);
 }
 
+// The server is the last member, so it is stopped before the collector it calls is released.
+PrometheusExporter::~PrometheusExporter() = default;
+
 sdk::metrics::AggregationTemporality PrometheusExporter::GetAggregationTemporality(
     sdk::metrics::InstrumentType /* instrument_type */) const noexcept
 {
@@ -52,6 +229,7 @@ bool PrometheusExporter::OnShutDown(std::chrono::microseconds /* timeout */) noe
 {
   if (exposer_ != nullptr)
     exposer_->RemoveCollectable(collector_);
+  text_server_.reset(nullptr);
   return true;
 }
 
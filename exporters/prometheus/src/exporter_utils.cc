@@ -2,8 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
-#include <regex>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -14,7 +15,6 @@
 #include "prometheus/metric_family.h"
 #include "prometheus/metric_type.h"
 
-#include "opentelemetry/common/macros.h"
 #include "opentelemetry/exporters/prometheus/exporter_utils.h"
 #include "opentelemetry/sdk/metrics/export/metric_producer.h"
 #include "opentelemetry/sdk/resource/resource.h"
@@ -37,6 +37,38 @@ namespace
 static constexpr const char *kScopeNameKey    = "otel_scope_name";
 static constexpr const char *kScopeVersionKey = "otel_scope_version";
 
+// Above this size, a name cache is cleared instead of growing with unbounded metric names or
+// attribute keys
+static constexpr std::size_t kMaxCachedNames = 4096;
+
+struct TranslatedName
+{
+  std::string unit;
+  prometheus_client::MetricType type;
+  std::string name;
+};
+
+/**
+ * The metric names and label keys already translated, so that the following scrapes of the same
+ * instruments and attributes do not sanitize them again.
+ */
+struct NameCache
+{
+  std::mutex lock;
+
+  // Keyed by instrument name, the Prometheus names for each unit and type
+  std::unordered_map<std::string, std::vector<TranslatedName>> metric_names;
+
+  // Keyed by attribute key
+  std::unordered_map<std::string, std::string> label_names;
+};
+
+NameCache &GetNameCache()
+{
+  static NameCache cache;
+  return cache;
+}
+
 /**
  * Sanitize the given metric name by replacing invalid characters with _,
  * ensuring that multiple consecutive _ characters are collapsed to a single _.
@@ -80,22 +112,6 @@ inline std::string Sanitize(std::string name, const T &valid)
   return name;
 }
 
-/**
- * Sanitize the given metric label key according to Prometheus rule.
- * Prometheus metric label keys are required to match the following regex:
- *   [a-zA-Z_]([a-zA-Z0-9_])*
- * and multiple consecutive _ characters must be collapsed to a single _.
- */
-std::string SanitizeLabel(std::string label_key)
-{
-  return Sanitize(label_key, [](int i, char c) {
-    return (c >= 'a' && c <= 'z') ||  //
-           (c >= 'A' && c <= 'Z') ||  //
-           c == '_' ||                //
-           (c >= '0' && c <= '9' && i > 0);
-  });
-}
-
 }  // namespace
 
 /**
@@ -157,7 +173,21 @@ std::vector<prometheus_client::MetricFamily> PrometheusExporterUtils::TranslateT
 
       for (const auto &point_data_attr : metric_data.point_data_attr_)
       {
-        if (type == prometheus_client::MetricType::Histogram)  // Histogram
+        if (type == prometheus_client::MetricType::Histogram &&
+            nostd::holds_alternative<sdk::metrics::ExponentialHistogramPointData>(
+                point_data_attr.point_data))
+        {
+          const auto &histogram_point_data =
+              nostd::get<sdk::metrics::ExponentialHistogramPointData>(point_data_attr.point_data);
+          std::vector<double> boundaries;
+          std::vector<uint64_t> counts;
+          ConvertExponentialBuckets(histogram_point_data, boundaries, counts);
+          SetData(std::vector<double>{histogram_point_data.sum_,
+                                      (double)histogram_point_data.count_},
+                  boundaries, counts, point_data_attr.attributes, scope, time, &metric_family,
+                  data.resource_);
+        }
+        else if (type == prometheus_client::MetricType::Histogram)  // Histogram
         {
           auto histogram_point_data =
               nostd::get<sdk::metrics::HistogramPointData>(point_data_attr.point_data);
@@ -282,13 +312,35 @@ std::string PrometheusExporterUtils::SanitizeNames(std::string name)
   return name;
 }
 
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-std::regex INVALID_CHARACTERS_PATTERN("[^a-zA-Z0-9]");
-std::regex CHARACTERS_BETWEEN_BRACES_PATTERN("\\{(.*?)\\}");
-std::regex SANITIZE_LEADING_UNDERSCORES("^_+");
-std::regex SANITIZE_TRAILING_UNDERSCORES("_+$");
-std::regex SANITIZE_CONSECUTIVE_UNDERSCORES("[_]{2,}");
-#endif
+/**
+ * Sanitize the given metric label key according to Prometheus rule.
+ * Prometheus metric label keys are required to match the following regex:
+ *   [a-zA-Z_]([a-zA-Z0-9_])*
+ * and multiple consecutive _ characters must be collapsed to a single _.
+ */
+std::string PrometheusExporterUtils::SanitizeLabel(std::string label_key)
+{
+  NameCache &cache = GetNameCache();
+  std::lock_guard<std::mutex> guard(cache.lock);
+  auto it = cache.label_names.find(label_key);
+  if (it != cache.label_names.end())
+  {
+    return it->second;
+  }
+  if (cache.label_names.size() >= kMaxCachedNames)
+  {
+    cache.label_names.clear();
+  }
+
+  auto sanitized = Sanitize(label_key, [](int i, char c) {
+    return (c >= 'a' && c <= 'z') ||  //
+           (c >= 'A' && c <= 'Z') ||  //
+           c == '_' ||                //
+           (c >= '0' && c <= '9' && i > 0);
+  });
+  cache.label_names.emplace(std::move(label_key), sanitized);
+  return sanitized;
+}
 
 std::string PrometheusExporterUtils::GetEquivalentPrometheusUnit(
     const std::string &raw_metric_unit_name)
@@ -364,32 +416,24 @@ std::string PrometheusExporterUtils::GetPrometheusPerUnit(const std::string &per
 
 std::string PrometheusExporterUtils::RemoveUnitPortionInBraces(const std::string &unit)
 {
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-  return std::regex_replace(unit, CHARACTERS_BETWEEN_BRACES_PATTERN, "");
-#else
-  bool in_braces = false;
+  // Same as removing the matches of "\{(.*?)\}", an opening brace without a closing one is kept
   std::string cleaned_unit;
   cleaned_unit.reserve(unit.size());
-  for (auto c : unit)
+  std::string::size_type pos = 0;
+  while (pos < unit.size())
   {
-    if (in_braces)
+    std::string::size_type open = unit.find('{', pos);
+    std::string::size_type close =
+        open == std::string::npos ? std::string::npos : unit.find('}', open + 1);
+    if (close == std::string::npos)
     {
-      if (c == '}')
-      {
-        in_braces = false;
-      }
-    }
-    else if (c == '{')
-    {
-      in_braces = true;
-    }
-    else
-    {
-      cleaned_unit += c;
+      cleaned_unit.append(unit, pos, std::string::npos);
+      break;
     }
+    cleaned_unit.append(unit, pos, open - pos);
+    pos = close + 1;
   }
   return cleaned_unit;
-#endif
 }
 
 std::string PrometheusExporterUtils::ConvertRateExpressedToPrometheusUnit(
@@ -418,74 +462,28 @@ std::string PrometheusExporterUtils::ConvertRateExpressedToPrometheusUnit(
 
 std::string PrometheusExporterUtils::CleanUpString(const std::string &str)
 {
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-  std::string cleaned_string = std::regex_replace(str, INVALID_CHARACTERS_PATTERN, "_");
-  cleaned_string = std::regex_replace(cleaned_string, SANITIZE_CONSECUTIVE_UNDERSCORES, "_");
-  cleaned_string = std::regex_replace(cleaned_string, SANITIZE_TRAILING_UNDERSCORES, "");
-  cleaned_string = std::regex_replace(cleaned_string, SANITIZE_LEADING_UNDERSCORES, "");
-  return cleaned_string;
-#else
-  std::string cleaned_string = str;
-  if (cleaned_string.empty())
-  {
-    return cleaned_string;
-  }
-  std::transform(cleaned_string.begin(), cleaned_string.end(), cleaned_string.begin(),
-                 [](const char c) {
-                   if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
-                   {
-                     return c;
-                   }
-                   return '_';
-                 });
-
-  std::string::size_type trim_start = 0;
-  std::string::size_type trim_end   = 0;
-  bool previous_underscore          = false;
-  for (std::string::size_type i = 0; i < cleaned_string.size(); ++i)
-  {
-    if (cleaned_string[i] == '_')
+  // Replace the characters other than letters and digits with '_', collapse the consecutive '_'
+  // and remove the leading and trailing ones, in a single pass
+  std::string cleaned_string;
+  cleaned_string.reserve(str.size());
+  bool pending_underscore = false;
+  for (char c : str)
+  {
+    if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
     {
-      if (previous_underscore)
+      if (pending_underscore && !cleaned_string.empty())
       {
-        continue;
+        cleaned_string += '_';
       }
-
-      previous_underscore = true;
+      pending_underscore = false;
+      cleaned_string += c;
     }
     else
     {
-      previous_underscore = false;
-    }
-
-    if (trim_end != i)
-    {
-      cleaned_string[trim_end] = cleaned_string[i];
+      pending_underscore = true;
     }
-    ++trim_end;
-  }
-
-  while (trim_end > 0 && cleaned_string[trim_end - 1] == '_')
-  {
-    --trim_end;
-  }
-  while (trim_start < trim_end && cleaned_string[trim_start] == '_')
-  {
-    ++trim_start;
-  }
-
-  // All characters are underscore
-  if (trim_start >= trim_end)
-  {
-    return "_";
-  }
-  if (0 != trim_start || cleaned_string.size() != trim_end)
-  {
-    return cleaned_string.substr(trim_start, trim_end - trim_start);
   }
-
   return cleaned_string;
-#endif
 }
 
 std::string PrometheusExporterUtils::MapToPrometheusName(
@@ -493,6 +491,28 @@ std::string PrometheusExporterUtils::MapToPrometheusName(
     const std::string &unit,
     prometheus_client::MetricType prometheus_type)
 {
+  NameCache &cache = GetNameCache();
+  std::lock_guard<std::mutex> guard(cache.lock);
+  auto it = cache.metric_names.find(name);
+  if (it != cache.metric_names.end())
+  {
+    for (const auto &translated_name : it->second)
+    {
+      if (translated_name.type == prometheus_type && translated_name.unit == unit)
+      {
+        return translated_name.name;
+      }
+    }
+  }
+  else
+  {
+    if (cache.metric_names.size() >= kMaxCachedNames)
+    {
+      cache.metric_names.clear();
+    }
+    it = cache.metric_names.emplace(name, std::vector<TranslatedName>{}).first;
+  }
+
   auto sanitized_name                    = SanitizeNames(name);
   std::string prometheus_equivalent_unit = GetEquivalentPrometheusUnit(unit);
 
@@ -521,7 +541,45 @@ std::string PrometheusExporterUtils::MapToPrometheusName(
     sanitized_name += "_ratio";
   }
 
-  return CleanUpString(SanitizeNames(sanitized_name));
+  std::string prometheus_name = CleanUpString(SanitizeNames(sanitized_name));
+  it->second.push_back({unit, prometheus_type, prometheus_name});
+  return prometheus_name;
+}
+
+/**
+ * Convert the buckets of an exponential histogram into explicit boundaries and counts, as
+ * Prometheus has no native representation of exponential histograms. Each boundary is the
+ * inclusive upper bound of its bucket; the trailing +Inf bucket is always empty.
+ */
+void PrometheusExporterUtils::ConvertExponentialBuckets(
+    const sdk::metrics::ExponentialHistogramPointData &point_data,
+    std::vector<double> &boundaries,
+    std::vector<uint64_t> &counts)
+{
+  const auto &positive = point_data.positive_buckets_.counts_;
+  const auto &negative = point_data.negative_buckets_.counts_;
+  boundaries.reserve(positive.size() + negative.size() + 1);
+  counts.reserve(positive.size() + negative.size() + 2);
+
+  // The lower bound of bucket `index` is base^index, where base = 2^(2^-scale).
+  const double factor = std::ldexp(1.0, -point_data.scale_);
+  auto lower_bound    = [factor](int32_t index) { return std::exp2(index * factor); };
+
+  for (size_t i = negative.size(); i > 0; i--)
+  {
+    boundaries.push_back(
+        -lower_bound(point_data.negative_buckets_.offset_ + static_cast<int32_t>(i) - 1));
+    counts.push_back(negative[i - 1]);
+  }
+  boundaries.push_back(0.0);
+  counts.push_back(point_data.zero_count_);
+  for (size_t i = 0; i < positive.size(); i++)
+  {
+    boundaries.push_back(
+        lower_bound(point_data.positive_buckets_.offset_ + static_cast<int32_t>(i) + 1));
+    counts.push_back(positive[i]);
+  }
+  counts.push_back(0);
 }
 
 metric_sdk::AggregationType PrometheusExporterUtils::getAggregationType(
@@ -540,6 +598,10 @@ metric_sdk::AggregationType PrometheusExporterUtils::getAggregationType(
   {
     return metric_sdk::AggregationType::kHistogram;
   }
+  else if (nostd::holds_alternative<sdk::metrics::ExponentialHistogramPointData>(point_type))
+  {
+    return metric_sdk::AggregationType::kBase2ExponentialHistogram;
+  }
   else if (nostd::holds_alternative<sdk::metrics::LastValuePointData>(point_type))
   {
     return metric_sdk::AggregationType::kLastValue;
@@ -567,6 +629,7 @@ prometheus_client::MetricType PrometheusExporterUtils::TranslateType(
       }
       break;
     case metric_sdk::AggregationType::kHistogram:
+    case metric_sdk::AggregationType::kBase2ExponentialHistogram:
       return prometheus_client::MetricType::Histogram;
       break;
     case metric_sdk::AggregationType::kLastValue:
@@ -0,0 +1,505 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cinttypes>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "opentelemetry/exporters/prometheus/exporter_utils.h"
+#include "opentelemetry/exporters/prometheus/text_writer.h"
+#include "opentelemetry/sdk/common/global_log_handler.h"
+
+namespace prometheus_client = ::prometheus;
+namespace metric_sdk        = opentelemetry::sdk::metrics;
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace metrics
+{
+namespace
+{
+
+static constexpr const char *kScopeNameKey    = "otel_scope_name";
+static constexpr const char *kScopeVersionKey = "otel_scope_version";
+
+// Above these sizes, the caches are cleared instead of growing with unbounded metric names or
+// attribute keys
+static constexpr std::size_t kMaxCachedMetricNames = 4096;
+static constexpr std::size_t kMaxCachedLabelNames  = 4096;
+
+void AppendInt64(int64_t value, std::string &output)
+{
+  char buffer[24];
+  int size = std::snprintf(buffer, sizeof(buffer), "%" PRId64, value);
+  output.append(buffer, static_cast<std::size_t>(size));
+}
+
+void AppendUint64(uint64_t value, std::string &output)
+{
+  char buffer[24];
+  int size = std::snprintf(buffer, sizeof(buffer), "%" PRIu64, value);
+  output.append(buffer, static_cast<std::size_t>(size));
+}
+
+void AppendDouble(double value, std::string &output)
+{
+  if (std::isnan(value))
+  {
+    output += "NaN";
+    return;
+  }
+  if (std::isinf(value))
+  {
+    output += value < 0 ? "-Inf" : "+Inf";
+    return;
+  }
+  // The shortest of the two precisions which reads back as the same value
+  char buffer[32];
+  int size = std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+  if (std::strtod(buffer, nullptr) != value)
+  {
+    size = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  }
+  std::size_t begin = output.size();
+  output.append(buffer, static_cast<std::size_t>(size));
+
+  // snprintf uses the decimal point of the current C locale, the exposition format requires '.'
+  const char *decimal_point = std::localeconv()->decimal_point;
+  if (decimal_point[0] != '\0' && std::strcmp(decimal_point, ".") != 0)
+  {
+    std::size_t position = output.find(decimal_point, begin);
+    if (position != std::string::npos)
+    {
+      output.replace(position, std::strlen(decimal_point), 1, '.');
+    }
+  }
+}
+
+/**
+ * Append a string escaped as a label value, or as the text of a "# HELP" line if is_help is set.
+ */
+void AppendEscaped(nostd::string_view value, bool is_help, std::string &output)
+{
+  for (char c : value)
+  {
+    switch (c)
+    {
+      case '\\':
+        output += "\\\\";
+        break;
+      case '\n':
+        output += "\\n";
+        break;
+      case '"':
+        if (!is_help)
+        {
+          output += "\\\"";
+          break;
+        }
+        output += c;
+        break;
+      default:
+        output += c;
+        break;
+    }
+  }
+}
+
+/**
+ * Append the name of a label and the opening quote of its value.
+ */
+void AppendLabelName(nostd::string_view name, std::string &labels)
+{
+  if (!labels.empty())
+  {
+    labels += ',';
+  }
+  labels.append(name.data(), name.size());
+  labels += "=\"";
+}
+
+void AppendLabel(nostd::string_view name, nostd::string_view value, std::string &labels)
+{
+  AppendLabelName(name, labels);
+  AppendEscaped(value, false, labels);
+  labels += '"';
+}
+
+/**
+ * Append the series name and labels of a sample, followed by the separator before its value.
+ */
+void AppendSeries(const std::string &name,
+                  nostd::string_view suffix,
+                  const std::string &labels,
+                  nostd::string_view bucket_bound,
+                  std::string &output)
+{
+  output += name;
+  output.append(suffix.data(), suffix.size());
+  if (!labels.empty() || !bucket_bound.empty())
+  {
+    output += '{';
+    output += labels;
+    if (!bucket_bound.empty())
+    {
+      if (!labels.empty())
+      {
+        output += ',';
+      }
+      output += "le=\"";
+      output.append(bucket_bound.data(), bucket_bound.size());
+      output += '"';
+    }
+    output += '}';
+  }
+  output += ' ';
+}
+
+void AppendTimestamp(int64_t timestamp_ms, std::string &output)
+{
+  if (timestamp_ms != 0)
+  {
+    output += ' ';
+    AppendInt64(timestamp_ms, output);
+  }
+  output += '\n';
+}
+
+void AppendValue(const metric_sdk::ValueType &value, std::string &output)
+{
+  if (nostd::holds_alternative<int64_t>(value))
+  {
+    AppendInt64(nostd::get<int64_t>(value), output);
+  }
+  else
+  {
+    AppendDouble(nostd::get<double>(value), output);
+  }
+}
+
+const char *GetTypeName(prometheus_client::MetricType type)
+{
+  switch (type)
+  {
+    case prometheus_client::MetricType::Counter:
+      return "counter";
+    case prometheus_client::MetricType::Gauge:
+      return "gauge";
+    case prometheus_client::MetricType::Histogram:
+      return "histogram";
+    default:
+      return "untyped";
+  }
+}
+
+int64_t GetTimestampMs(const metric_sdk::MetricData &metric_data)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             metric_data.end_ts.time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+PrometheusTextWriter::PrometheusTextWriter(bool populate_target_info, bool populate_otel_scope)
+    : populate_target_info_(populate_target_info), populate_otel_scope_(populate_otel_scope)
+{}
+
+void PrometheusTextWriter::Write(const sdk::metrics::ResourceMetrics &data, std::string &output)
+{
+  if (metric_names_.size() > kMaxCachedMetricNames)
+  {
+    metric_names_.clear();
+  }
+  if (label_names_.size() > kMaxCachedLabelNames)
+  {
+    label_names_.clear();
+  }
+
+  if (populate_target_info_)
+  {
+    WriteTargetInfo(data, output);
+  }
+  for (const auto &scope_metrics : data.scope_metric_data_)
+  {
+    const sdk::instrumentationscope::InstrumentationScope *scope =
+        populate_otel_scope_ ? scope_metrics.scope_ : nullptr;
+    for (const auto &metric_data : scope_metrics.metric_data_)
+    {
+      WriteMetric(metric_data, scope, output);
+    }
+  }
+}
+
+PrometheusTextWriter::MetricNames &PrometheusTextWriter::GetMetricNames(
+    const sdk::metrics::InstrumentDescriptor &descriptor,
+    prometheus_client::MetricType type)
+{
+  MetricNames &names = metric_names_[descriptor.name_];
+  if (!names.name.empty() && names.type == type && names.unit == descriptor.unit_ &&
+      names.description == descriptor.description_)
+  {
+    return names;
+  }
+
+  names.unit        = descriptor.unit_;
+  names.description = descriptor.description_;
+  names.type        = type;
+  names.name =
+      PrometheusExporterUtils::MapToPrometheusName(descriptor.name_, descriptor.unit_, type);
+  names.header.clear();
+  if (!descriptor.description_.empty())
+  {
+    names.header += "# HELP ";
+    names.header += names.name;
+    names.header += ' ';
+    AppendEscaped(descriptor.description_, true, names.header);
+    names.header += '\n';
+  }
+  names.header += "# TYPE ";
+  names.header += names.name;
+  names.header += ' ';
+  names.header += GetTypeName(type);
+  names.header += '\n';
+  names.boundaries.clear();
+  names.bucket_bounds.clear();
+  return names;
+}
+
+const std::string &PrometheusTextWriter::GetLabelName(const std::string &key)
+{
+  auto it = label_names_.find(key);
+  if (it == label_names_.end())
+  {
+    it = label_names_.emplace(key, PrometheusExporterUtils::SanitizeLabel(key)).first;
+  }
+  return it->second;
+}
+
+void PrometheusTextWriter::AppendLabelValue(const sdk::common::OwnedAttributeValue &value,
+                                            std::string &labels)
+{
+  if (nostd::holds_alternative<std::string>(value))
+  {
+    AppendEscaped(nostd::get<std::string>(value), false, labels);
+  }
+  else
+  {
+    AppendEscaped(PrometheusExporterUtils::AttributeValueToString(value), false, labels);
+  }
+}
+
+void PrometheusTextWriter::WriteTargetInfo(const sdk::metrics::ResourceMetrics &data,
+                                           std::string &output)
+{
+  if (data.resource_ == nullptr || data.scope_metric_data_.empty() ||
+      data.scope_metric_data_.front().metric_data_.empty())
+  {
+    return;
+  }
+
+  labels_.clear();
+  const auto *scope = data.scope_metric_data_.front().scope_;
+  if (populate_otel_scope_ && scope != nullptr)
+  {
+    if (!scope->GetName().empty())
+    {
+      AppendLabel(kScopeNameKey, scope->GetName(), labels_);
+    }
+    if (!scope->GetVersion().empty())
+    {
+      AppendLabel(kScopeVersionKey, scope->GetVersion(), labels_);
+    }
+  }
+  for (const auto &attribute : data.resource_->GetAttributes())
+  {
+    AppendLabelName(PrometheusExporterUtils::SanitizeNames(attribute.first), labels_);
+    AppendLabelValue(attribute.second, labels_);
+    labels_ += '"';
+  }
+
+  output += "# HELP target_info Target metadata\n# TYPE target_info gauge\n";
+  AppendSeries("target_info", "", labels_, "", output);
+  output += '1';
+  AppendTimestamp(GetTimestampMs(data.scope_metric_data_.front().metric_data_.front()), output);
+}
+
+void PrometheusTextWriter::WriteMetric(const sdk::metrics::MetricData &metric_data,
+                                       const sdk::instrumentationscope::InstrumentationScope *scope,
+                                       std::string &output)
+{
+  if (metric_data.point_data_attr_.empty())
+  {
+    return;
+  }
+
+  const auto &front = metric_data.point_data_attr_.front().point_data;
+  auto kind         = PrometheusExporterUtils::getAggregationType(front);
+  bool is_monotonic = true;
+  if (kind == sdk::metrics::AggregationType::kSum)
+  {
+    is_monotonic = nostd::get<sdk::metrics::SumPointData>(front).is_monotonic_;
+  }
+  const prometheus_client::MetricType type =
+      PrometheusExporterUtils::TranslateType(kind, is_monotonic);
+  MetricNames &names   = GetMetricNames(metric_data.instrument_descriptor, type);
+  int64_t timestamp_ms = GetTimestampMs(metric_data);
+
+  output += names.header;
+  for (const auto &point_data_attr : metric_data.point_data_attr_)
+  {
+    const auto &point_data = point_data_attr.point_data;
+    WriteLabels(point_data_attr.attributes, scope);
+
+    if (nostd::holds_alternative<sdk::metrics::HistogramPointData>(point_data) &&
+        type == prometheus_client::MetricType::Histogram)
+    {
+      const auto &histogram_point_data = nostd::get<sdk::metrics::HistogramPointData>(point_data);
+      double sum                       = 0.0;
+      if (nostd::holds_alternative<double>(histogram_point_data.sum_))
+      {
+        sum = nostd::get<double>(histogram_point_data.sum_);
+      }
+      else
+      {
+        sum = static_cast<double>(nostd::get<int64_t>(histogram_point_data.sum_));
+      }
+      WriteHistogram(names, histogram_point_data.boundaries_, histogram_point_data.counts_, sum,
+                     histogram_point_data.count_, timestamp_ms, output);
+    }
+    else if (nostd::holds_alternative<sdk::metrics::ExponentialHistogramPointData>(point_data) &&
+             type == prometheus_client::MetricType::Histogram)
+    {
+      const auto &histogram_point_data =
+          nostd::get<sdk::metrics::ExponentialHistogramPointData>(point_data);
+      std::vector<double> boundaries;
+      std::vector<uint64_t> counts;
+      PrometheusExporterUtils::ConvertExponentialBuckets(histogram_point_data, boundaries, counts);
+      WriteHistogram(names, boundaries, counts, histogram_point_data.sum_,
+                     histogram_point_data.count_, timestamp_ms, output);
+    }
+    else if (nostd::holds_alternative<sdk::metrics::SumPointData>(point_data))
+    {
+      AppendSeries(names.name, "", labels_, "", output);
+      AppendValue(nostd::get<sdk::metrics::SumPointData>(point_data).value_, output);
+      AppendTimestamp(timestamp_ms, output);
+    }
+    else if (nostd::holds_alternative<sdk::metrics::LastValuePointData>(point_data) &&
+             type == prometheus_client::MetricType::Gauge)
+    {
+      AppendSeries(names.name, "", labels_, "", output);
+      AppendValue(nostd::get<sdk::metrics::LastValuePointData>(point_data).value_, output);
+      AppendTimestamp(timestamp_ms, output);
+    }
+    else
+    {
+      OTEL_INTERNAL_LOG_WARN(
+          "[Prometheus Exporter] PrometheusTextWriter - "
+          "invalid point data type for metric "
+          << names.name);
+    }
+  }
+}
+
+void PrometheusTextWriter::WriteLabels(
+    const sdk::metrics::PointAttributes &attributes,
+    const sdk::instrumentationscope::InstrumentationScope *scope)
+{
+  labels_.clear();
+
+  // Same as PrometheusExporterUtils::SetMetricBasic, the values of the keys which collide after
+  // sanitization are concatenated, and the keys which would break the sort order are ignored.
+  const std::string *previous_name = nullptr;
+  for (const auto &attribute : attributes)
+  {
+    const std::string &name = GetLabelName(attribute.first);
+    int comparison          = previous_name == nullptr ? -1 : previous_name->compare(name);
+    if (comparison < 0)  // new key
+    {
+      previous_name = &name;
+      AppendLabelName(name, labels_);
+    }
+    else if (comparison == 0)  // key collision after sanitation
+    {
+      // Reopen the value of the previous label
+      labels_.pop_back();
+      labels_ += ';';
+    }
+    else  // order inversion introduced by sanitation
+    {
+      OTEL_INTERNAL_LOG_WARN(
+          "[Prometheus Exporter] PrometheusTextWriter - "
+          "the sort order of labels has changed because of sanitization: '"
+          << attribute.first << "' became '" << name << "' which is less than '" << *previous_name
+          << "'. Ignoring this label.");
+      continue;
+    }
+    AppendLabelValue(attribute.second, labels_);
+    labels_ += '"';
+  }
+
+  if (scope == nullptr)
+  {
+    return;
+  }
+  if (!scope->GetName().empty())
+  {
+    AppendLabel(kScopeNameKey, scope->GetName(), labels_);
+  }
+  if (!scope->GetVersion().empty())
+  {
+    AppendLabel(kScopeVersionKey, scope->GetVersion(), labels_);
+  }
+}
+
+void PrometheusTextWriter::WriteHistogram(MetricNames &names,
+                                          const std::vector<double> &boundaries,
+                                          const std::vector<uint64_t> &counts,
+                                          double sum,
+                                          uint64_t count,
+                                          int64_t timestamp_ms,
+                                          std::string &output)
+{
+  if (names.boundaries != boundaries)
+  {
+    names.boundaries = boundaries;
+    names.bucket_bounds.clear();
+    for (double boundary : boundaries)
+    {
+      names.bucket_bounds.emplace_back();
+      AppendDouble(boundary, names.bucket_bounds.back());
+    }
+  }
+
+  uint64_t cumulative_count = 0;
+  for (std::size_t i = 0; i < names.bucket_bounds.size() && i < counts.size(); ++i)
+  {
+    cumulative_count += counts[i];
+    AppendSeries(names.name, "_bucket", labels_, names.bucket_bounds[i], output);
+    AppendUint64(cumulative_count, output);
+    AppendTimestamp(timestamp_ms, output);
+  }
+  if (counts.size() > names.bucket_bounds.size())
+  {
+    cumulative_count += counts[names.bucket_bounds.size()];
+  }
+  AppendSeries(names.name, "_bucket", labels_, "+Inf", output);
+  AppendUint64(cumulative_count, output);
+  AppendTimestamp(timestamp_ms, output);
+
+  AppendSeries(names.name, "_sum", labels_, "", output);
+  AppendDouble(sum, output);
+  AppendTimestamp(timestamp_ms, output);
+
+  AppendSeries(names.name, "_count", labels_, "", output);
+  AppendUint64(count, output);
+  AppendTimestamp(timestamp_ms, output);
+}
+
+}  // namespace metrics
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
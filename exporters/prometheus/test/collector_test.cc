@@ -82,3 +82,22 @@ TEST(PrometheusCollector, BasicTests)
   delete reader;
   delete producer;
 }
+
+TEST(PrometheusCollector, CollectText)
+{
+  MockMetricReader *reader     = new MockMetricReader();
+  MockMetricProducer *producer = new MockMetricProducer();
+  reader->SetMetricProducer(producer);
+  PrometheusCollector collector(reader, false, false);
+
+  std::string output;
+  collector.CollectText(output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit_total description\n"
+            "# TYPE library_name_unit_total counter\n"
+            "library_name_unit_total{a1=\"b1\"} 10\n"
+            "library_name_unit_total{a2=\"b2\"} 20\n");
+  ASSERT_EQ(producer->GetDataCount(), 1);
+  delete reader;
+  delete producer;
+}
@@ -5,10 +5,15 @@
 
 #include "opentelemetry/exporters/prometheus/collector.h"
 #include "opentelemetry/exporters/prometheus/exporter.h"
+#include "opentelemetry/ext/http/server/socket_tools.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/version.h"
 #include "prometheus_test_helper.h"
 
+#include <thread>
+#include <vector>
+
 /**
  * PrometheusExporterTest is a friend class of PrometheusExporter.
  * It has access to a private constructor that does not take in
@@ -77,3 +82,165 @@ TEST(PrometheusExporter, CheckAggregationTemporality)
   ASSERT_EQ(exporter.GetAggregationTemporality(InstrumentType::kUpDownCounter),
             AggregationTemporality::kCumulative);
 }
+
+namespace
+{
+// Sends a GET request to the address and returns the whole response
+std::string HttpGet(const SocketTools::SocketAddr &addr, const std::string &path)
+{
+  SocketTools::Socket socket(addr.m_data.sa_family, SOCK_STREAM, IPPROTO_TCP);
+  if (socket.invalid())
+  {
+    return "";
+  }
+  if (!socket.connect(addr))
+  {
+    socket.close();
+    return "";
+  }
+  std::string request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+  socket.send(request.data(), static_cast<unsigned>(request.size()));
+
+  std::string response;
+  char buffer[4096];
+  int received;
+  while ((received = socket.recv(buffer, sizeof(buffer))) > 0)
+  {
+    response.append(buffer, static_cast<std::size_t>(received));
+  }
+  socket.close();
+  return response;
+}
+
+std::string HttpGet(int port, const std::string &path)
+{
+  return HttpGet(SocketTools::SocketAddr(SocketTools::SocketAddr::Loopback, port), path);
+}
+
+SocketTools::SocketAddr IPv6Loopback(int port)
+{
+  sockaddr_in6 address = {};
+  address.sin6_family  = AF_INET6;
+  address.sin6_port    = htons(static_cast<unsigned short>(port));
+  address.sin6_addr    = in6addr_loopback;
+  return SocketTools::SocketAddr(reinterpret_cast<sockaddr const *>(&address), sizeof(address));
+}
+
+const char kRequestsTotal[] =
+    "# TYPE requests_total counter\n"
+    "requests_total{otel_scope_name=\"library_name\",otel_scope_version=\"1.2.0\"} 5";
+}  // namespace
+
+/**
+ * With use_text_writer, scrapes are answered by the text writer of the collector.
+ */
+TEST(PrometheusExporter, ServesScrapesWithTextWriter)
+{
+  PrometheusExporterOptions options;
+  options.url             = "localhost:19464";
+  options.use_text_writer = true;
+  std::shared_ptr<PrometheusExporter> exporter(new PrometheusExporter(options));
+  ASSERT_FALSE(exporter->IsShutdown());
+
+  metric_sdk::MeterProvider provider;
+  provider.AddMetricReader(exporter);
+  provider.GetMeter("library_name", "1.2.0")->CreateUInt64Counter("requests")->Add(5);
+
+  std::string response = HttpGet(19464, "/metrics");
+  EXPECT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0u) << response;
+  EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"),
+            std::string::npos)
+      << response;
+  EXPECT_NE(response.find(kRequestsTotal), std::string::npos) << response;
+
+  exporter->Shutdown();
+  EXPECT_EQ(HttpGet(19464, "/metrics"), "");
+}
+
+/**
+ * With use_text_writer, an IPv6 address between brackets is served.
+ */
+TEST(PrometheusExporter, TextWriterServesIPv6)
+{
+  PrometheusExporterOptions options;
+  options.url             = "[::1]:19465";
+  options.use_text_writer = true;
+  std::shared_ptr<PrometheusExporter> exporter(new PrometheusExporter(options));
+  if (exporter->IsShutdown())
+  {
+    // IPv6 is not available on this host.
+    return;
+  }
+
+  metric_sdk::MeterProvider provider;
+  provider.AddMetricReader(exporter);
+  provider.GetMeter("library_name", "1.2.0")->CreateUInt64Counter("requests")->Add(5);
+
+  std::string response = HttpGet(IPv6Loopback(19465), "/metrics");
+  EXPECT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0u) << response;
+  EXPECT_NE(response.find(kRequestsTotal), std::string::npos) << response;
+  EXPECT_EQ(HttpGet(19465, "/metrics"), "");
+
+  exporter->Shutdown();
+  EXPECT_EQ(HttpGet(IPv6Loopback(19465), "/metrics"), "");
+}
+
+/**
+ * With use_text_writer, concurrent scrapes are all answered, even while a client holds an idle
+ * connection, and shutting down doesn't wait for that connection.
+ */
+TEST(PrometheusExporter, TextWriterServesConcurrentScrapes)
+{
+  PrometheusExporterOptions options;
+  options.url             = "localhost:19466";
+  options.use_text_writer = true;
+  std::shared_ptr<PrometheusExporter> exporter(new PrometheusExporter(options));
+  ASSERT_FALSE(exporter->IsShutdown());
+
+  metric_sdk::MeterProvider provider;
+  provider.AddMetricReader(exporter);
+  provider.GetMeter("library_name", "1.2.0")->CreateUInt64Counter("requests")->Add(5);
+
+  SocketTools::Socket idle(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  ASSERT_TRUE(idle.connect(SocketTools::SocketAddr(SocketTools::SocketAddr::Loopback, 19466)));
+  std::string partial_request = "GET /metrics HTTP/1.1\r\n";
+  idle.send(partial_request.data(), static_cast<unsigned>(partial_request.size()));
+
+  const int kThreads = 8;
+  std::vector<std::string> responses(kThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&responses, i]() { responses[i] = HttpGet(19466, "/metrics"); });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  for (const auto &response : responses)
+  {
+    EXPECT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0u) << response;
+    EXPECT_NE(response.find(kRequestsTotal), std::string::npos) << response;
+  }
+
+  exporter->Shutdown();
+  EXPECT_EQ(HttpGet(19466, "/metrics"), "");
+  idle.close();
+}
+
+/**
+ * With use_text_writer, an url which is not a numeric address or "localhost", and a port, shuts
+ * the exporter down.
+ */
+TEST(PrometheusExporter, TextWriterRejectsInvalidUrl)
+{
+  PrometheusExporterOptions options;
+  options.use_text_writer = true;
+  for (const char *url : {"localhost", "example.com:9464", "256.0.0.1:9464", "localhost:65536",
+                          "::1:9464", "[::1:9464", "[::1]9464", "[::g]:9464"})
+  {
+    options.url = url;
+    PrometheusExporter exporter(options);
+    EXPECT_TRUE(exporter.IsShutdown()) << url;
+  }
+}
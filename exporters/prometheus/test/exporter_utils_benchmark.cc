@@ -0,0 +1,106 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/exporters/prometheus/exporter_utils.h"
+#include "opentelemetry/exporters/prometheus/text_writer.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/resource/resource.h"
+
+using opentelemetry::exporter::metrics::PrometheusExporterUtils;
+using opentelemetry::exporter::metrics::PrometheusTextWriter;
+using opentelemetry::sdk::instrumentationscope::InstrumentationScope;
+using opentelemetry::sdk::resource::Resource;
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace
+{
+
+/**
+ * Metrics of kInstruments counters and histograms, each with state.range(0) points of 4
+ * attributes.
+ */
+class ScrapeFixture : public benchmark::Fixture
+{
+public:
+  void SetUp(const benchmark::State &state) override
+  {
+    constexpr int kInstruments = 20;
+    int points                 = static_cast<int>(state.range(0));
+
+    std::vector<metric_sdk::MetricData> metric_data;
+    for (int i = 0; i < kInstruments; ++i)
+    {
+      bool is_histogram = i % 2 == 1;
+      metric_sdk::MetricData data;
+      data.instrument_descriptor = metric_sdk::InstrumentDescriptor{
+          "http.server.request." + std::to_string(i), "Requests served by the server",
+          is_histogram ? "ms" : "{request}",
+          is_histogram ? metric_sdk::InstrumentType::kHistogram
+                       : metric_sdk::InstrumentType::kCounter,
+          metric_sdk::InstrumentValueType::kDouble};
+      for (int j = 0; j < points; ++j)
+      {
+        metric_sdk::PointAttributes attributes{{"http.method", "GET"},
+                                               {"http.route", "/api/v1/item/" + std::to_string(j)},
+                                               {"http.status_code", 200},
+                                               {"net.host.name", "localhost"}};
+        if (is_histogram)
+        {
+          metric_sdk::HistogramPointData point_data;
+          point_data.boundaries_ = {0, 5, 10, 25, 50, 75, 100, 250, 500, 1000};
+          point_data.counts_     = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+          point_data.sum_        = 12345.5;
+          point_data.count_      = 66;
+          data.point_data_attr_.push_back({attributes, point_data});
+        }
+        else
+        {
+          metric_sdk::SumPointData point_data;
+          point_data.value_ = 42.0;
+          data.point_data_attr_.push_back({attributes, point_data});
+        }
+      }
+      metric_data.push_back(std::move(data));
+    }
+    metrics_.resource_ = &resource_;
+    metrics_.scope_metric_data_.emplace_back();
+    metrics_.scope_metric_data_.back().scope_       = scope_.get();
+    metrics_.scope_metric_data_.back().metric_data_ = std::move(metric_data);
+  }
+
+protected:
+  Resource resource_ = Resource::Create({{"service.name", "benchmark"}});
+  opentelemetry::nostd::unique_ptr<InstrumentationScope> scope_ =
+      InstrumentationScope::Create("benchmark", "1.0.0");
+  metric_sdk::ResourceMetrics metrics_;
+};
+
+BENCHMARK_DEFINE_F(ScrapeFixture, TranslateToPrometheus)(benchmark::State &state)
+{
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(PrometheusExporterUtils::TranslateToPrometheus(metrics_));
+  }
+}
+BENCHMARK_REGISTER_F(ScrapeFixture, TranslateToPrometheus)->Arg(1)->Arg(100);
+
+BENCHMARK_DEFINE_F(ScrapeFixture, TextWriter)(benchmark::State &state)
+{
+  PrometheusTextWriter writer;
+  std::string output;
+  for (auto _ : state)
+  {
+    output.clear();
+    writer.Write(metrics_, output);
+    benchmark::DoNotOptimize(output.data());
+  }
+}
+BENCHMARK_REGISTER_F(ScrapeFixture, TextWriter)->Arg(1)->Arg(100);
+
+}  // namespace
+
+BENCHMARK_MAIN();
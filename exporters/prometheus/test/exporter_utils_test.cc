@@ -56,6 +56,12 @@ class SanitizeNameTester
   {
     return PrometheusExporterUtils::MapToPrometheusName(name, unit, prometheus_type);
   }
+  static void convertExponentialBuckets(const metric_sdk::ExponentialHistogramPointData &point_data,
+                                        std::vector<double> &boundaries,
+                                        std::vector<uint64_t> &counts)
+  {
+    PrometheusExporterUtils::ConvertExponentialBuckets(point_data, boundaries, counts);
+  }
 };
 }  // namespace metrics
 }  // namespace exporter
@@ -266,6 +272,36 @@ TEST(PrometheusExporterUtils, TranslateToPrometheusHistogramNormal)
   ASSERT_EQ(checked_label_num, 3);
 }
 
+TEST(PrometheusExporterUtils, TranslateToPrometheusExponentialHistogram)
+{
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics metrics_data = dp.CreateExponentialHistogramPointData();
+
+  auto translated = PrometheusExporterUtils::TranslateToPrometheus(metrics_data);
+  ASSERT_EQ(translated.size(), 2);
+
+  // One explicit bucket per exponential bucket, one for the zero count, and the +Inf bucket
+  auto metric              = translated[1];
+  std::vector<double> vals = {7, 0.5, 5};
+  assert_basic(metric, "library_name_unit", "description", prometheus_client::MetricType::Histogram,
+               3, vals);
+  assert_histogram(metric, std::list<double>{-2, 0, 2, 4}, {3, 1, 1, 2, 0});
+}
+
+TEST(PrometheusExporterUtils, ConvertExponentialBuckets)
+{
+  metric_sdk::ExponentialHistogramPointData point_data;
+  point_data.scale_                    = -1;
+  point_data.positive_buckets_.offset_ = -1;
+  point_data.positive_buckets_.counts_ = {4, 0, 5};
+  std::vector<double> boundaries;
+  std::vector<uint64_t> counts;
+  exportermetrics::SanitizeNameTester::convertExponentialBuckets(point_data, boundaries, counts);
+  // At scale -1, bucket i is (4^i, 4^(i+1)]
+  EXPECT_EQ(boundaries, (std::vector<double>{0, 1, 4, 16}));
+  EXPECT_EQ(counts, (std::vector<uint64_t>{0, 4, 0, 5, 0}));
+}
+
 class SanitizeTest : public ::testing::Test
 {
   Resource resource_ = Resource::Create({});
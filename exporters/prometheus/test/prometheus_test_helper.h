@@ -75,6 +75,33 @@ struct TestDataPoints
     return data;
   }
 
+  inline metric_sdk::ResourceMetrics CreateExponentialHistogramPointData()
+  {
+    // At scale 0: 3 values in [-4, -2), 1 zero, 1 value in (1, 2] and 2 values in (2, 4]
+    metric_sdk::ExponentialHistogramPointData histogram_point_data{};
+    histogram_point_data.count_                    = 7;
+    histogram_point_data.sum_                      = 0.5;
+    histogram_point_data.zero_count_               = 1;
+    histogram_point_data.scale_                    = 0;
+    histogram_point_data.negative_buckets_.offset_ = 1;
+    histogram_point_data.negative_buckets_.counts_ = {3};
+    histogram_point_data.positive_buckets_.offset_ = 0;
+    histogram_point_data.positive_buckets_.counts_ = {1, 2};
+    metric_sdk::ResourceMetrics data;
+    data.resource_ = &resource;
+    metric_sdk::MetricData metric_data{
+        metric_sdk::InstrumentDescriptor{"library_name", "description", "unit",
+                                         metric_sdk::InstrumentType::kHistogram,
+                                         metric_sdk::InstrumentValueType::kDouble},
+        metric_sdk::AggregationTemporality::kDelta, opentelemetry::common::SystemTimestamp{},
+        opentelemetry::common::SystemTimestamp{},
+        std::vector<metric_sdk::PointDataAttributes>{
+            {metric_sdk::PointAttributes{{"a1", "b1"}}, histogram_point_data}}};
+    data.scope_metric_data_ = std::vector<metric_sdk::ScopeMetrics>{
+        {instrumentation_scope.get(), std::vector<metric_sdk::MetricData>{metric_data}}};
+    return data;
+  }
+
   inline metric_sdk::ResourceMetrics CreateLastValuePointData()
   {
     metric_sdk::ResourceMetrics data;
@@ -0,0 +1,220 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <clocale>
+
+#include "opentelemetry/exporters/prometheus/text_writer.h"
+#include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/resource/resource.h"
+#include "prometheus_test_helper.h"
+
+using opentelemetry::exporter::metrics::PrometheusTextWriter;
+
+TEST(PrometheusTextWriter, EmptyInputWritesNothing)
+{
+  PrometheusTextWriter writer;
+  std::string output;
+  writer.Write({}, output);
+  EXPECT_EQ(output, "");
+}
+
+TEST(PrometheusTextWriter, Counter)
+{
+  TestDataPoints dp;
+  PrometheusTextWriter writer(false, true);
+  std::string output;
+  writer.Write(dp.CreateSumPointData(), output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit_total description\n"
+            "# TYPE library_name_unit_total counter\n"
+            "library_name_unit_total{a1=\"b1\",otel_scope_name=\"library_name\","
+            "otel_scope_version=\"1.2.0\"} 10\n"
+            "library_name_unit_total{a2=\"b2\",otel_scope_name=\"library_name\","
+            "otel_scope_version=\"1.2.0\"} 20\n");
+}
+
+TEST(PrometheusTextWriter, Gauge)
+{
+  TestDataPoints dp;
+  PrometheusTextWriter writer(false, false);
+  std::string output;
+  writer.Write(dp.CreateLastValuePointData(), output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit description\n"
+            "# TYPE library_name_unit gauge\n"
+            "library_name_unit{a1=\"b1\"} 10\n"
+            "library_name_unit{a2=\"b2\"} 20\n");
+}
+
+TEST(PrometheusTextWriter, Histogram)
+{
+  TestDataPoints dp;
+  PrometheusTextWriter writer(false, false);
+  std::string output;
+  writer.Write(dp.CreateHistogramPointData(), output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit description\n"
+            "# TYPE library_name_unit histogram\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"10.1\"} 200\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"20.2\"} 500\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"30.2\"} 900\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"+Inf\"} 1400\n"
+            "library_name_unit_sum{a1=\"b1\"} 900.5\n"
+            "library_name_unit_count{a1=\"b1\"} 3\n"
+            "library_name_unit_bucket{a2=\"b2\",le=\"10\"} 200\n"
+            "library_name_unit_bucket{a2=\"b2\",le=\"20\"} 500\n"
+            "library_name_unit_bucket{a2=\"b2\",le=\"30\"} 900\n"
+            "library_name_unit_bucket{a2=\"b2\",le=\"+Inf\"} 1400\n"
+            "library_name_unit_sum{a2=\"b2\"} 900\n"
+            "library_name_unit_count{a2=\"b2\"} 3\n");
+}
+
+TEST(PrometheusTextWriter, ExponentialHistogram)
+{
+  TestDataPoints dp;
+  PrometheusTextWriter writer(false, false);
+  std::string output;
+  writer.Write(dp.CreateExponentialHistogramPointData(), output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit description\n"
+            "# TYPE library_name_unit histogram\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"-2\"} 3\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"0\"} 4\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"2\"} 5\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"4\"} 7\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"+Inf\"} 7\n"
+            "library_name_unit_sum{a1=\"b1\"} 0.5\n"
+            "library_name_unit_count{a1=\"b1\"} 7\n");
+}
+
+TEST(PrometheusTextWriter, TargetInfo)
+{
+  Resource resource = Resource::Create({{"service.name", "test_service"}});
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics data = dp.CreateSumPointData();
+  data.resource_                   = &resource;
+
+  PrometheusTextWriter writer(true, true);
+  std::string output;
+  writer.Write(data, output);
+  EXPECT_EQ(output.find("# HELP target_info Target metadata\n"
+                        "# TYPE target_info gauge\n"
+                        "target_info{otel_scope_name=\"library_name\","
+                        "otel_scope_version=\"1.2.0\","),
+            0u);
+  EXPECT_NE(output.find("service_name=\"test_service\""), std::string::npos);
+  EXPECT_NE(output.find("} 1\n# HELP library_name_unit_total description\n"), std::string::npos);
+}
+
+TEST(PrometheusTextWriter, ScopeLabelsWithoutAttributesOrResource)
+{
+  nostd::unique_ptr<InstrumentationScope> instrumentation_scope =
+      InstrumentationScope::Create("library_name");
+  metric_sdk::InstrumentDescriptor instrument_descriptor{"name", "description", "",
+                                                         metric_sdk::InstrumentType::kCounter,
+                                                         metric_sdk::InstrumentValueType::kDouble};
+  metric_sdk::SumPointData point_data;
+  point_data.value_ = 1.5;
+
+  PrometheusTextWriter writer(false, true);
+  std::string output;
+  writer.Write({nullptr, std::vector<metric_sdk::ScopeMetrics>{
+                             {instrumentation_scope.get(),
+                              std::vector<metric_sdk::MetricData>{
+                                  {instrument_descriptor, {}, {}, {}, {{{}, point_data}}}}}}},
+               output);
+  EXPECT_EQ(output,
+            "# HELP name_total description\n"
+            "# TYPE name_total counter\n"
+            "name_total{otel_scope_name=\"library_name\"} 1.5\n");
+}
+
+class PrometheusTextWriterLabelTest : public ::testing::Test
+{
+  Resource resource_ = Resource::Create(ResourceAttributes{});
+  nostd::unique_ptr<InstrumentationScope> instrumentation_scope_ =
+      InstrumentationScope::Create("library_name");
+
+protected:
+  std::string Write(const metric_sdk::PointAttributes &attributes,
+                    const std::string &description = "description")
+  {
+    metric_sdk::InstrumentDescriptor instrument_descriptor{
+        "name", description, "", metric_sdk::InstrumentType::kCounter,
+        metric_sdk::InstrumentValueType::kDouble};
+    metric_sdk::SumPointData point_data;
+    point_data.value_ = 1.5;
+    std::string output;
+    writer_.Write({&resource_,
+                   std::vector<metric_sdk::ScopeMetrics>{
+                       {instrumentation_scope_.get(),
+                        std::vector<metric_sdk::MetricData>{
+                            {instrument_descriptor, {}, {}, {}, {{attributes, point_data}}}}}}},
+                  output);
+    return output;
+  }
+
+  PrometheusTextWriter writer_{false, true};
+};
+
+TEST_F(PrometheusTextWriterLabelTest, SanitizesKeys)
+{
+  EXPECT_EQ(Write({{"foo.a", "value1"}, {"foo.b", 2}}),
+            "# HELP name_total description\n"
+            "# TYPE name_total counter\n"
+            "name_total{foo_a=\"value1\",foo_b=\"2\",otel_scope_name=\"library_name\"} 1.5\n");
+}
+
+TEST_F(PrometheusTextWriterLabelTest, JoinsCollidingKeys)
+{
+  EXPECT_EQ(Write({{"foo.a", "value1"}, {"foo_a", "value2"}}),
+            "# HELP name_total description\n"
+            "# TYPE name_total counter\n"
+            "name_total{foo_a=\"value1;value2\",otel_scope_name=\"library_name\"} 1.5\n");
+}
+
+TEST_F(PrometheusTextWriterLabelTest, DropsInvertedKeys)
+{
+  EXPECT_EQ(Write({{"foo.a", "value1"}, {"foo.b", "value2"}, {"foo__a", "value3"}}),
+            "# HELP name_total description\n"
+            "# TYPE name_total counter\n"
+            "name_total{foo_a=\"value1\",foo_b=\"value2\",otel_scope_name=\"library_name\"} 1.5\n");
+}
+
+TEST_F(PrometheusTextWriterLabelTest, EscapesValues)
+{
+  EXPECT_EQ(Write({{"key", "a\"b\\c\nd"}}, "multi\nline \"help\" \\"),
+            "# HELP name_total multi\\nline \"help\" \\\\\n"
+            "# TYPE name_total counter\n"
+            "name_total{key=\"a\\\"b\\\\c\\nd\",otel_scope_name=\"library_name\"} 1.5\n");
+}
+
+TEST_F(PrometheusTextWriterLabelTest, UpdatesCachedNames)
+{
+  std::string first = Write({{"key", "value"}});
+  EXPECT_EQ(Write({{"key", "value"}}), first);
+  EXPECT_EQ(Write({{"key", "value"}}, "other description"),
+            "# HELP name_total other description\n"
+            "# TYPE name_total counter\n"
+            "name_total{key=\"value\",otel_scope_name=\"library_name\"} 1.5\n");
+}
+
+TEST_F(PrometheusTextWriterLabelTest, WritesDoublesIndependentlyOfLocale)
+{
+  // Use a locale with a decimal comma if one is installed, the output must not change.
+  std::string previous_locale = std::setlocale(LC_NUMERIC, nullptr);
+  for (const char *locale : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"})
+  {
+    if (std::setlocale(LC_NUMERIC, locale) != nullptr)
+    {
+      break;
+    }
+  }
+  std::string output = Write({{"key", "value"}});
+  std::setlocale(LC_NUMERIC, previous_locale.c_str());
+
+  EXPECT_NE(output.find("} 1.5\n"), std::string::npos) << output;
+}
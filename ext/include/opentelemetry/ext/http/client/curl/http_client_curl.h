@@ -66,6 +66,13 @@ class Request : public opentelemetry::ext::http::client::Request
   void SetBody(opentelemetry::ext::http::client::Body &body) noexcept override
   {
     body_ = std::move(body);
+    body_slices_.clear();
+  }
+
+  void SetBodySlices(opentelemetry::ext::http::client::BodySlices slices) noexcept override
+  {
+    body_.clear();
+    body_slices_ = std::move(slices);
   }
 
   void AddHeader(nostd::string_view name, nostd::string_view value) noexcept override
@@ -93,6 +100,7 @@ class Request : public opentelemetry::ext::http::client::Request
   opentelemetry::ext::http::client::Method method_;
   opentelemetry::ext::http::client::HttpSslOptions ssl_options_;
   opentelemetry::ext::http::client::Body body_;
+  opentelemetry::ext::http::client::BodySlices body_slices_;
   opentelemetry::ext::http::client::Headers headers_;
   std::string uri_;
   std::chrono::milliseconds timeout_ms_{5000};  // ms
@@ -300,6 +308,15 @@ class HttpClient : public opentelemetry::ext::http::client::HttpClient
     return max_sessions_per_connection_;
   }
 
+  void SetConnectionOptions(
+      const opentelemetry::ext::http::client::HttpConnectionOptions &options) noexcept override;
+
+  inline const opentelemetry::ext::http::client::HttpConnectionOptions &GetConnectionOptions()
+      const noexcept
+  {
+    return connection_options_;
+  }
+
   void CleanupSession(uint64_t session_id);
 
   inline CURLM *GetMultiHandle() noexcept { return multi_handle_; }
@@ -330,11 +347,13 @@ class HttpClient : public opentelemetry::ext::http::client::HttpClient
   bool doAbortSessions();
   bool doRemoveSessions();
   void resetMultiHandle();
+  void setMultiHandleOptions();
 
   std::mutex multi_handle_m_;
   CURLM *multi_handle_;
   std::atomic<uint64_t> next_session_id_{0};
   uint64_t max_sessions_per_connection_;
+  opentelemetry::ext::http::client::HttpConnectionOptions connection_options_;
 
   std::mutex sessions_m_;
   std::recursive_mutex session_ids_m_;
@@ -136,6 +136,9 @@ class HttpOperation
    * @param body  Reques Body
    * @param raw_response whether to parse the response
    * @param httpConnTimeout   HTTP connection timeout in seconds
+   * @param reuse_connection whether to reuse a cached connection
+   * @param connection_options HTTP version and keep-alive options of the connection
+   * @param request_body_slices Request body sent without being copied, instead of request_body
    */
   HttpOperation(opentelemetry::ext::http::client::Method method,
                 std::string url,
@@ -149,7 +152,11 @@ class HttpOperation
                 // Default connectivity and response size options
                 bool is_raw_response                        = false,
                 std::chrono::milliseconds http_conn_timeout = default_http_conn_timeout,
-                bool reuse_connection                       = false);
+                bool reuse_connection                       = false,
+                const opentelemetry::ext::http::client::HttpConnectionOptions &connection_options =
+                    opentelemetry::ext::http::client::HttpConnectionOptions(),
+                const opentelemetry::ext::http::client::BodySlices &request_body_slices =
+                    opentelemetry::ext::http::client::BodySlices());
 
   /**
    * Destroy CURL instance
@@ -269,6 +276,8 @@ class HttpOperation
 
   CURLcode SetCurlOffOption(CURLoption option, curl_off_t value);
 
+  CURLcode SetupConnection();
+
   const char *GetCurlErrorMessage(CURLcode code);
 
   std::atomic<bool> is_aborted_{false};   // Set to 'true' when async callback is aborted
@@ -277,6 +286,7 @@ class HttpOperation
   const bool is_raw_response_;            // Do not split response headers from response body
   const bool reuse_connection_;           // Reuse connection
   const std::chrono::milliseconds http_conn_timeout_;  // Timeout for connect.  Default: 5000ms
+  const opentelemetry::ext::http::client::HttpConnectionOptions connection_options_;
 
   char curl_error_message_[CURL_ERROR_SIZE];
   HttpCurlEasyResource curl_resource_;
@@ -292,7 +302,10 @@ class HttpOperation
 
   const Headers &request_headers_;
   const opentelemetry::ext::http::client::Body &request_body_;
-  size_t request_nwrite_;
+  // The request body, or request_body_ as a single slice
+  opentelemetry::ext::http::client::BodySlices request_body_slices_;
+  size_t request_slice_;   // Index of the slice being sent
+  size_t request_nwrite_;  // Bytes of the slice already sent
   opentelemetry::ext::http::client::SessionState session_state_;
 
   // Processed response headers and body
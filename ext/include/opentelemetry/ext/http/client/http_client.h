@@ -4,8 +4,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "opentelemetry/nostd/function_ref.h"
@@ -99,6 +101,38 @@ using Byte       = uint8_t;
 using StatusCode = uint16_t;
 using Body       = std::vector<Byte>;
 
+/**
+ * A buffer sent as a part of a request body without being copied.
+ * The buffer is kept alive by its owner, and must not be modified until the request is finished.
+ */
+struct BodySlice
+{
+  BodySlice() = default;
+
+  BodySlice(std::shared_ptr<const Body> body) noexcept
+      : data(body ? body->data() : nullptr), size(body ? body->size() : 0), owner(std::move(body))
+  {}
+
+  /**
+   * @param input_owner the object which keeps the buffer alive, or nullptr if the caller
+   * guarantees that the buffer outlives the request
+   */
+  BodySlice(std::shared_ptr<const void> input_owner,
+            const Byte *input_data,
+            std::size_t input_size) noexcept
+      : data(input_data), size(input_size), owner(std::move(input_owner))
+  {}
+
+  const Byte *data{nullptr};
+  std::size_t size{0};
+  std::shared_ptr<const void> owner;
+};
+
+/**
+ * A request body made of slices, which are sent in order.
+ */
+using BodySlices = std::vector<BodySlice>;
+
 struct cmp_ic
 {
   bool operator()(const std::string &s1, const std::string &s2) const
@@ -222,6 +256,52 @@ struct HttpSslOptions
   std::string ssl_cipher_suite{};
 };
 
+enum class HttpVersion
+{
+  /** The default of the implementation. */
+  kDefault,
+  /** HTTP/1.1 */
+  kHttp1_1,
+  /** HTTP/2 negotiated with ALPN for HTTPS, HTTP/1.1 for plain HTTP. */
+  kHttp2,
+  /** HTTP/2 for both HTTPS and plain HTTP, without negotiation or upgrade. */
+  kHttp2PriorKnowledge
+};
+
+struct HttpConnectionOptions
+{
+  /**
+    HTTP version of the requests.
+    With HTTP/2, concurrent requests to the same host are multiplexed as streams over the existing
+    connections instead of opening new ones, and connections are kept regardless of the max
+    sessions per connection.
+  */
+  HttpVersion http_version{HttpVersion::kDefault};
+
+  /**
+    Max number of connections to the same host, 0 for no limit.
+    The requests over the limit wait for a connection to be available.
+  */
+  std::size_t max_connections_per_host{0};
+
+  /**
+    Idle time of a connection before TCP keep-alive probes are sent.
+    TCP keep-alive is disabled if 0.
+  */
+  std::chrono::seconds keep_alive_idle{0};
+
+  /**
+    Interval between the TCP keep-alive probes.
+    Used only if @p keep_alive_idle is not 0.
+  */
+  std::chrono::seconds keep_alive_interval{60};
+
+  /**
+    Max idle time of a connection for it to be reused, 0 for the default of the implementation.
+  */
+  std::chrono::seconds max_idle_time{0};
+};
+
 class Request
 {
 public:
@@ -233,6 +313,27 @@ class Request
 
   virtual void SetBody(Body &body) noexcept = 0;
 
+  /**
+   * Set the request body to the concatenation of the slices. Unlike SetBody, the slices are
+   * shared with the caller and sent without being copied into a contiguous buffer.
+   * By default, the slices are copied into a single body passed to SetBody.
+   */
+  virtual void SetBodySlices(BodySlices slices) noexcept
+  {
+    std::size_t size = 0;
+    for (const auto &slice : slices)
+    {
+      size += slice.size;
+    }
+    Body body;
+    body.reserve(size);
+    for (const auto &slice : slices)
+    {
+      body.insert(body.end(), slice.data, slice.data + slice.size);
+    }
+    SetBody(body);
+  }
+
   virtual void AddHeader(nostd::string_view name, nostd::string_view value) noexcept = 0;
 
   virtual void ReplaceHeader(nostd::string_view name, nostd::string_view value) noexcept = 0;
@@ -346,6 +447,12 @@ class HttpClient
 
   virtual void SetMaxSessionsPerConnection(std::size_t max_requests_per_connection) noexcept = 0;
 
+  /**
+   * Set the options of the connections used by the following sessions.
+   * Ignored by the clients which do not support these options.
+   */
+  virtual void SetConnectionOptions(const HttpConnectionOptions & /* options */) noexcept {}
+
   virtual ~HttpClient() = default;
 };
 
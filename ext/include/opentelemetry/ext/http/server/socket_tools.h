@@ -19,6 +19,7 @@
 //#  include <Windows.h>
 
 #  include <winsock2.h>
+#  include <ws2tcpip.h>
 
 // TODO: consider NOMINMAX
 #  undef min
@@ -156,22 +157,33 @@ static WsaInitializer g_wsaInitializer;
 #endif
 
 /// <summary>
-/// Encapsulation of sockaddr(_in)
+/// Encapsulation of sockaddr(_in, _in6)
 /// </summary>
 struct SocketAddr
 {
   static u_long const Loopback = 0x7F000001;
 
-  sockaddr m_data;
+  union
+  {
+    sockaddr m_data;
+    sockaddr_in6 m_data6;
+  };
 
   /// <summary>
   /// SocketAddr constructor
   /// </summary>
   /// <returns>SocketAddr</returns>
-  SocketAddr() { memset(&m_data, 0, sizeof(m_data)); }
+  SocketAddr() { memset(&m_data6, 0, sizeof(m_data6)); }
+
+  SocketAddr(sockaddr const *addr, size_t addrlen)
+  {
+    memset(&m_data6, 0, sizeof(m_data6));
+    memcpy(&m_data6, addr, (std::min)(addrlen, sizeof(m_data6)));
+  }
 
   SocketAddr(u_long addr, int port)
   {
+    memset(&m_data6, 0, sizeof(m_data6));
     sockaddr_in &inet4    = reinterpret_cast<sockaddr_in &>(m_data);
     inet4.sin_family      = AF_INET;
     inet4.sin_port        = htons(static_cast<unsigned short>(port));
@@ -180,6 +192,7 @@ struct SocketAddr
 
   SocketAddr(char const *addr)
   {
+    memset(&m_data6, 0, sizeof(m_data6));
 #ifdef _WIN32
     INT addrlen = sizeof(m_data);
     WCHAR buf[200];
@@ -217,6 +230,15 @@ struct SocketAddr
 
   operator const sockaddr *() const { return &m_data; }
 
+  /// <summary>
+  /// Length of the address of the family
+  /// </summary>
+  int length() const
+  {
+    return m_data.sa_family == AF_INET6 ? static_cast<int>(sizeof(sockaddr_in6))
+                                        : static_cast<int>(sizeof(sockaddr_in));
+  }
+
   int port() const
   {
     switch (m_data.sa_family)
@@ -226,6 +248,9 @@ struct SocketAddr
         return ntohs(inet4.sin_port);
       }
 
+      case AF_INET6:
+        return ntohs(m_data6.sin6_port);
+
       default:
         return -1;
     }
@@ -246,6 +271,13 @@ struct SocketAddr
         break;
       }
 
+      case AF_INET6: {
+        char buf[INET6_ADDRSTRLEN] = "";
+        ::inet_ntop(AF_INET6, const_cast<in6_addr *>(&m_data6.sin6_addr), buf, sizeof(buf));
+        os << '[' << buf << "]:" << ntohs(m_data6.sin6_port);
+        break;
+      }
+
       default:
         os << "[?AF?" << m_data.sa_family << ']';
     }
@@ -308,6 +340,18 @@ struct Socket
                          sizeof(value)) == 0);
   }
 
+  bool setV6Only()
+  {
+    assert(m_sock != Invalid);
+#ifdef _WIN32
+    DWORD value = 1;
+#else
+    int value = 1;
+#endif
+    return (::setsockopt(m_sock, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char *>(&value),
+                         sizeof(value)) == 0);
+  }
+
   bool setNoDelay()
   {
     assert(m_sock != Invalid);
@@ -323,7 +367,7 @@ struct Socket
   bool connect(SocketAddr const &addr)
   {
     assert(m_sock != Invalid);
-    return (::connect(m_sock, addr, sizeof(addr)) == 0);
+    return (::connect(m_sock, addr, addr.length()) == 0);
   }
 
   void close()
@@ -353,7 +397,7 @@ struct Socket
   bool bind(SocketAddr const &addr)
   {
     assert(m_sock != Invalid);
-    return (::bind(m_sock, addr, sizeof(addr)) == 0);
+    return (::bind(m_sock, addr, addr.length()) == 0);
   }
 
   bool getsockname(SocketAddr &addr) const
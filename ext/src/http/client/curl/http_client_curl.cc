@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "opentelemetry/ext/http/client/curl/http_client_curl.h"
+#include "opentelemetry/sdk/common/global_log_handler.h"
 
 #include <list>
 
@@ -40,18 +41,26 @@ void Session::SendRequest(
   auto callback_ptr     = callback.get();
   bool reuse_connection = false;
 
-  // Set CURLOPT_FRESH_CONNECT and CURLOPT_FORBID_REUSE to 1L every max_sessions_per_connection_
-  // requests. So libcurl will create a new connection instead of queue the request to the existing
-  // connection.
-  if (http_client_.GetMaxSessionsPerConnection() > 0)
+  const auto &connection_options = http_client_.GetConnectionOptions();
+  if (connection_options.http_version == HttpVersion::kHttp2 ||
+      connection_options.http_version == HttpVersion::kHttp2PriorKnowledge)
   {
+    // Concurrent requests are multiplexed over the existing connections, keep them open.
+    reuse_connection = true;
+  }
+  else if (http_client_.GetMaxSessionsPerConnection() > 0)
+  {
+    // Set CURLOPT_FRESH_CONNECT and CURLOPT_FORBID_REUSE to 1L every max_sessions_per_connection_
+    // requests. So libcurl will create a new connection instead of queue the request to the
+    // existing connection.
     reuse_connection = session_id_ % http_client_.GetMaxSessionsPerConnection() != 0;
   }
 
   curl_operation_.reset(new HttpOperation(http_request_->method_, url, http_request_->ssl_options_,
                                           callback_ptr, http_request_->headers_,
                                           http_request_->body_, false, http_request_->timeout_ms_,
-                                          reuse_connection));
+                                          reuse_connection, connection_options,
+                                          http_request_->body_slices_));
   bool success =
       CURLE_OK == curl_operation_->SendAsync(this, [this, callback](HttpOperation &operation) {
         if (operation.WasAborted())
@@ -228,6 +237,24 @@ void HttpClient::SetMaxSessionsPerConnection(std::size_t max_requests_per_connec
   max_sessions_per_connection_ = max_requests_per_connection;
 }
 
+void HttpClient::SetConnectionOptions(
+    const opentelemetry::ext::http::client::HttpConnectionOptions &options) noexcept
+{
+  std::lock_guard<std::mutex> lock_guard{multi_handle_m_};
+  connection_options_ = options;
+
+  if ((options.http_version == HttpVersion::kHttp2 ||
+       options.http_version == HttpVersion::kHttp2PriorKnowledge) &&
+      (curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP2) == 0)
+  {
+    OTEL_INTERNAL_LOG_WARN("[HTTP Client Curl] CURL is built without HTTP/2 support, using "
+                           "the default HTTP version");
+    connection_options_.http_version = HttpVersion::kDefault;
+  }
+
+  setMultiHandleOptions();
+}
+
 void HttpClient::CleanupSession(uint64_t session_id)
 {
   std::shared_ptr<Session> session;
@@ -595,6 +622,20 @@ void HttpClient::resetMultiHandle()
 
   // Create a another multi handle to continue pending sessions
   multi_handle_ = curl_multi_init();
+  setMultiHandleOptions();
+}
+
+void HttpClient::setMultiHandleOptions()
+{
+  curl_multi_setopt(multi_handle_, CURLMOPT_MAX_HOST_CONNECTIONS,
+                    static_cast<long>(connection_options_.max_connections_per_host));
+
+  if (connection_options_.http_version == HttpVersion::kHttp2 ||
+      connection_options_.http_version == HttpVersion::kHttp2PriorKnowledge)
+  {
+    // Multiplexing is only enabled by default since CURL 7.62.0
+    curl_multi_setopt(multi_handle_, CURLMOPT_PIPELINING, static_cast<long>(CURLPIPE_MULTIPLEX));
+  }
 }
 
 }  // namespace curl
@@ -135,20 +135,30 @@ size_t HttpOperation::ReadMemoryCallback(char *buffer, size_t size, size_t nitem
     self->DispatchEvent(opentelemetry::ext::http::client::SessionState::Sending);
   }
 
-  // EOF
-  if (self->request_nwrite_ >= self->request_body_.size())
-  {
-    return 0;
-  }
+  // Fill the buffer from the slices, returns 0 at EOF
+  size_t capacity = size * nitems;
+  size_t nwrite   = 0;
+  while (nwrite < capacity && self->request_slice_ < self->request_body_slices_.size())
+  {
+    const BodySlice &slice = self->request_body_slices_[self->request_slice_];
+    size_t slice_nwrite    = slice.size - self->request_nwrite_;
+    if (slice_nwrite > capacity - nwrite)
+    {
+      slice_nwrite = capacity - nwrite;
+    }
 
-  size_t nwrite = size * nitems;
-  if (nwrite > self->request_body_.size() - self->request_nwrite_)
-  {
-    nwrite = self->request_body_.size() - self->request_nwrite_;
+    if (slice_nwrite > 0)
+    {
+      memcpy(buffer + nwrite, slice.data + self->request_nwrite_, slice_nwrite);
+    }
+    nwrite += slice_nwrite;
+    self->request_nwrite_ += slice_nwrite;
+    if (self->request_nwrite_ >= slice.size)
+    {
+      ++self->request_slice_;
+      self->request_nwrite_ = 0;
+    }
   }
-
-  memcpy(buffer, &self->request_body_[self->request_nwrite_], nwrite);
-  self->request_nwrite_ += nwrite;
   return nwrite;
 }
 
@@ -243,7 +253,9 @@ HttpOperation::HttpOperation(opentelemetry::ext::http::client::Method method,
                              // Default connectivity and response size options
                              bool is_raw_response,
                              std::chrono::milliseconds http_conn_timeout,
-                             bool reuse_connection)
+                             bool reuse_connection,
+                             const HttpConnectionOptions &connection_options,
+                             const BodySlices &request_body_slices)
     : is_aborted_(false),
       is_finished_(false),
       is_cleaned_(false),
@@ -251,6 +263,7 @@ HttpOperation::HttpOperation(opentelemetry::ext::http::client::Method method,
       is_raw_response_(is_raw_response),
       reuse_connection_(reuse_connection),
       http_conn_timeout_(http_conn_timeout),
+      connection_options_(connection_options),
       // Result
       last_curl_result_(CURLE_OK),
       event_handle_(event_handle),
@@ -260,10 +273,17 @@ HttpOperation::HttpOperation(opentelemetry::ext::http::client::Method method,
       // Local vars
       request_headers_(request_headers),
       request_body_(request_body),
+      request_body_slices_(request_body_slices),
+      request_slice_(0),
       request_nwrite_(0),
       session_state_(opentelemetry::ext::http::client::SessionState::Created),
       response_code_(0)
 {
+  if (request_body_slices_.empty() && !request_body_.empty())
+  {
+    request_body_slices_.emplace_back(nullptr, request_body_.data(), request_body_.size());
+  }
+
   /* get a curl handle */
   curl_resource_.easy_handle = curl_easy_init();
   if (!curl_resource_.easy_handle)
@@ -570,6 +590,81 @@ CURLcode HttpOperation::SetCurlOffOption(CURLoption option, curl_off_t value)
   return rc;
 }
 
+CURLcode HttpOperation::SetupConnection()
+{
+  CURLcode rc = CURLE_OK;
+
+  switch (connection_options_.http_version)
+  {
+    case HttpVersion::kDefault:
+      break;
+    case HttpVersion::kHttp1_1:
+      rc = SetCurlLongOption(CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_1_1));
+      break;
+    case HttpVersion::kHttp2:
+    case HttpVersion::kHttp2PriorKnowledge:
+#if LIBCURL_VERSION_NUM >= CURL_VERSION_BITS(7, 49, 0)
+      rc = SetCurlLongOption(
+          CURLOPT_HTTP_VERSION,
+          static_cast<long>(connection_options_.http_version == HttpVersion::kHttp2
+                                ? CURL_HTTP_VERSION_2TLS
+                                : CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE));
+      if (rc != CURLE_OK)
+      {
+        return rc;
+      }
+
+      // Wait for the connections being established to know whether they can multiplex the
+      // request, rather than opening a new connection
+      rc = SetCurlLongOption(CURLOPT_PIPEWAIT, 1L);
+#else
+      // CURL 7.49.0 required for CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE.
+      OTEL_INTERNAL_LOG_ERROR("CURL 7.49.0 required for HTTP/2");
+#endif
+      break;
+  }
+  if (rc != CURLE_OK)
+  {
+    return rc;
+  }
+
+  if (connection_options_.keep_alive_idle.count() > 0)
+  {
+    rc = SetCurlLongOption(CURLOPT_TCP_KEEPALIVE, 1L);
+    if (rc != CURLE_OK)
+    {
+      return rc;
+    }
+
+    rc = SetCurlLongOption(CURLOPT_TCP_KEEPIDLE,
+                           static_cast<long>(connection_options_.keep_alive_idle.count()));
+    if (rc != CURLE_OK)
+    {
+      return rc;
+    }
+
+    rc = SetCurlLongOption(CURLOPT_TCP_KEEPINTVL,
+                           static_cast<long>(connection_options_.keep_alive_interval.count()));
+    if (rc != CURLE_OK)
+    {
+      return rc;
+    }
+  }
+
+  if (connection_options_.max_idle_time.count() > 0)
+  {
+#if LIBCURL_VERSION_NUM >= CURL_VERSION_BITS(7, 65, 0)
+    rc = SetCurlLongOption(CURLOPT_MAXAGE_CONN,
+                           static_cast<long>(connection_options_.max_idle_time.count()));
+#else
+    // CURL 7.65.0 required for CURLOPT_MAXAGE_CONN.
+    OTEL_INTERNAL_LOG_ERROR("CURL 7.65.0 required for MAX IDLE TIME");
+#endif
+  }
+
+  return rc;
+}
+
 CURLcode HttpOperation::Setup()
 {
   if (!curl_resource_.easy_handle)
@@ -924,6 +1019,12 @@ CURLcode HttpOperation::Setup()
     }
   }
 
+  rc = SetupConnection();
+  if (rc != CURLE_OK)
+  {
+    return rc;
+  }
+
   if (is_raw_response_)
   {
     rc = SetCurlLongOption(CURLOPT_HEADER, 1L);
@@ -976,7 +1077,11 @@ CURLcode HttpOperation::Setup()
   if (method_ == opentelemetry::ext::http::client::Method::Post)
   {
     // Request buffer
-    const curl_off_t req_size = static_cast<curl_off_t>(request_body_.size());
+    curl_off_t req_size = 0;
+    for (const auto &slice : request_body_slices_)
+    {
+      req_size += static_cast<curl_off_t>(slice.size);
+    }
     // POST
     rc = SetCurlLongOption(CURLOPT_POST, 1L);
     if (rc != CURLE_OK)
@@ -94,6 +94,44 @@ class FinishInCallbackHandler : public CustomEventHandler
   std::shared_ptr<http_client::Session> session_;
 };
 
+#ifndef _WIN32
+// Reads the TCP keep-alive options of the connection of the session when the response is received
+class KeepAliveEventHandler : public CustomEventHandler
+{
+public:
+  void OnEvent(http_client::SessionState state, nostd::string_view reason) noexcept override
+  {
+    if (state == http_client::SessionState::Response && session_ != nullptr)
+    {
+      curl_socket_t socket = CURL_SOCKET_BAD;
+      curl_easy_getinfo(session_->GetOperation()->GetCurlEasyHandle(), CURLINFO_ACTIVESOCKET,
+                        &socket);
+      if (socket != CURL_SOCKET_BAD)
+      {
+        int value        = 0;
+        socklen_t length = sizeof(value);
+        if (getsockopt(socket, SOL_SOCKET, SO_KEEPALIVE, &value, &length) == 0)
+        {
+          keep_alive_ = value;
+        }
+#  ifdef TCP_KEEPIDLE
+        length = sizeof(value);
+        if (getsockopt(socket, IPPROTO_TCP, TCP_KEEPIDLE, &value, &length) == 0)
+        {
+          keep_alive_idle_ = value;
+        }
+#  endif
+      }
+    }
+    CustomEventHandler::OnEvent(state, reason);
+  }
+
+  curl::Session *session_ = nullptr;
+  std::atomic<int> keep_alive_{-1};
+  std::atomic<int> keep_alive_idle_{-1};
+};
+#endif
+
 class BasicCurlHttpTests : public ::testing::Test, public HTTP_SERVER_NS::HttpRequestCallback
 {
 protected:
@@ -272,6 +310,36 @@ TEST_F(BasicCurlHttpTests, SendPostRequest)
   session_manager->FinishAllSessions();
 }
 
+TEST_F(BasicCurlHttpTests, SendPostRequestWithBodySlices)
+{
+  received_requests_.clear();
+  auto session_manager = http_client::HttpClientFactory::Create();
+  EXPECT_TRUE(session_manager != nullptr);
+
+  auto session = session_manager->CreateSession("http://127.0.0.1:19000");
+  auto request = session->CreateRequest();
+  request->SetUri("post/");
+  request->SetMethod(http_client::Method::Post);
+
+  // The first slice is larger than the upload buffer of curl, the second one is owned by the test
+  auto first                = std::make_shared<const http_client::Body>(100000, 'a');
+  static const char *second = "-data";
+  request->SetBodySlices(
+      {http_client::BodySlice(first),
+       http_client::BodySlice(nullptr, reinterpret_cast<const uint8_t *>(second), strlen(second))});
+  request->AddHeader("Content-Type", "text/plain");
+  auto handler = std::make_shared<PostEventHandler>();
+  session->SendRequest(handler);
+  ASSERT_TRUE(waitForRequests(30, 1));
+  session->FinishSession();
+  ASSERT_TRUE(handler->is_called_);
+  ASSERT_TRUE(handler->got_response_);
+
+  std::unique_lock<std::mutex> lock_requests(mtx_requests);
+  ASSERT_EQ(received_requests_.size(), 1u);
+  EXPECT_EQ(received_requests_[0].content, std::string(100000, 'a') + "-data");
+}
+
 TEST_F(BasicCurlHttpTests, RequestTimeout)
 {
   received_requests_.clear();
@@ -480,6 +548,82 @@ TEST_F(BasicCurlHttpTests, SendPostRequestAsync)
   }
 }
 
+TEST_F(BasicCurlHttpTests, SendPostRequestAsyncWithConnectionOptions)
+{
+  curl::HttpClient http_client;
+
+  // HTTP/2 is only negotiated over TLS, the requests to this server are sent with HTTP/1.1 over a
+  // single connection.
+  http_client::HttpConnectionOptions connection_options;
+  connection_options.http_version             = http_client::HttpVersion::kHttp2;
+  connection_options.max_connections_per_host = 1;
+  connection_options.keep_alive_idle          = std::chrono::seconds(30);
+  connection_options.max_idle_time            = std::chrono::seconds(60);
+  http_client.SetConnectionOptions(connection_options);
+
+  received_requests_.clear();
+  auto handler = std::make_shared<PostEventHandler>();
+
+  static constexpr const unsigned batch_count = 5;
+  std::shared_ptr<http_client::Session> sessions[batch_count];
+  for (auto &session : sessions)
+  {
+    session      = http_client.CreateSession("http://127.0.0.1:19000/post/");
+    auto request = session->CreateRequest();
+    request->SetMethod(http_client::Method::Post);
+    request->SetUri("post/");
+    session->SendRequest(handler);
+  }
+
+  ASSERT_TRUE(waitForRequests(30, batch_count));
+
+  for (auto &session : sessions)
+  {
+    session->FinishSession();
+    ASSERT_FALSE(session->IsSessionActive());
+  }
+
+  ASSERT_TRUE(handler->is_called_);
+  ASSERT_TRUE(handler->got_response_);
+}
+
+#ifndef _WIN32
+TEST_F(BasicCurlHttpTests, ConnectionOptionsReachCurlHandle)
+{
+  // The connection must be kept alive after the response to be read from the easy handle.
+  HTTP_SERVER_NS::HttpServer keep_alive_server;
+  int port = keep_alive_server.addListeningPort(HTTP_PORT + 1);
+  keep_alive_server.addHandler("/get/", *this);
+  keep_alive_server.start();
+
+  curl::HttpClient http_client;
+  http_client::HttpConnectionOptions connection_options;
+  connection_options.http_version    = http_client::HttpVersion::kHttp2;
+  connection_options.keep_alive_idle = std::chrono::seconds(30);
+  http_client.SetConnectionOptions(connection_options);
+
+  received_requests_.clear();
+  auto handler = std::make_shared<KeepAliveEventHandler>();
+  auto session = http_client.CreateSession("http://127.0.0.1:" + std::to_string(port) + "/get/");
+  handler->session_ = static_cast<curl::Session *>(session.get());
+  auto request      = session->CreateRequest();
+  request->SetMethod(http_client::Method::Get);
+  request->SetUri("get/");
+  session->SendRequest(handler);
+
+  ASSERT_TRUE(waitForRequests(30, 1));
+  session->FinishSession();
+  ASSERT_TRUE(handler->got_response_);
+  http_client.WaitBackgroundThreadExit();
+  keep_alive_server.stop();
+
+  EXPECT_EQ(handler->keep_alive_, 1);
+#  ifdef TCP_KEEPIDLE
+  EXPECT_EQ(handler->keep_alive_idle_, 30);
+#  endif
+}
+#endif
+
 TEST_F(BasicCurlHttpTests, FinishInAsyncCallback)
 {
   curl::HttpClient http_client;
@@ -0,0 +1,126 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace common
+{
+
+/**
+ * A reader/writer Mutex which spins like opentelemetry::common::SpinLockMutex instead of halting
+ * threads. Any number of threads can hold the lock shared, while the exclusive lock is held by a
+ * single thread. A thread waiting for the exclusive lock keeps new threads from taking the lock
+ * shared, so that writers are not starved by a steady flow of readers.
+ *
+ * lock() and unlock() implement the `BasicLockable` specification, and lock_shared() and
+ * unlock_shared() the shared part of the `SharedMutex` one.
+ */
+class SharedSpinLockMutex
+{
+public:
+  SharedSpinLockMutex() noexcept {}
+  SharedSpinLockMutex(const SharedSpinLockMutex &)            = delete;
+  SharedSpinLockMutex &operator=(const SharedSpinLockMutex &) = delete;
+
+  /** Blocks until the lock is held exclusively by the current thread. */
+  void lock() noexcept
+  {
+    // Take the writer bit, then wait for the threads holding the lock shared to release it.
+    SpinUntil(
+        [this] { return (state_.fetch_or(kWriter, std::memory_order_acquire) & kWriter) == 0; },
+        [this] { return (state_.load(std::memory_order_relaxed) & kWriter) == 0; });
+    SpinUntil([this] { return state_.load(std::memory_order_acquire) == kWriter; },
+              [] { return true; });
+  }
+
+  /** Releases the exclusive lock. */
+  void unlock() noexcept { state_.fetch_and(~kWriter, std::memory_order_release); }
+
+  /** Blocks until the lock is held shared by the current thread. */
+  void lock_shared() noexcept
+  {
+    SpinUntil(
+        [this] {
+          if ((state_.fetch_add(1, std::memory_order_acquire) & kWriter) == 0)
+          {
+            return true;
+          }
+          state_.fetch_sub(1, std::memory_order_relaxed);
+          return false;
+        },
+        [this] { return (state_.load(std::memory_order_relaxed) & kWriter) == 0; });
+  }
+
+  /** Releases the shared lock. */
+  void unlock_shared() noexcept { state_.fetch_sub(1, std::memory_order_release); }
+
+private:
+  static constexpr uint32_t kWriter = 1u << 31;
+
+  // Tries to acquire the lock until `try_acquire` succeeds, with the same back-off strategy as
+  // SpinLockMutex. `may_succeed` is checked before each new try, so that waiting threads do not
+  // keep on writing the state.
+  template <class TryAcquire, class MaySucceed>
+  static void SpinUntil(TryAcquire try_acquire, MaySucceed may_succeed) noexcept
+  {
+    for (;;)
+    {
+      if (try_acquire())
+      {
+        return;
+      }
+      for (int i = 0; i < opentelemetry::common::SPINLOCK_FAST_ITERATIONS; ++i)
+      {
+        if (may_succeed() && try_acquire())
+        {
+          return;
+        }
+        opentelemetry::common::SpinLockMutex::fast_yield();
+      }
+      std::this_thread::yield();
+      if (may_succeed() && try_acquire())
+      {
+        return;
+      }
+      std::this_thread::sleep_for(
+          std::chrono::milliseconds(opentelemetry::common::SPINLOCK_SLEEP_MS));
+    }
+  }
+
+  // The writer bit, and the number of threads holding, or trying to take, the lock shared
+  std::atomic<uint32_t> state_{0};
+};
+
+/**
+ * Holds a SharedSpinLockMutex shared for the duration of a scope.
+ */
+class SharedSpinLockGuard
+{
+public:
+  explicit SharedSpinLockGuard(SharedSpinLockMutex &mutex) noexcept : mutex_(mutex)
+  {
+    mutex_.lock_shared();
+  }
+  ~SharedSpinLockGuard() noexcept { mutex_.unlock_shared(); }
+
+  SharedSpinLockGuard(const SharedSpinLockGuard &)            = delete;
+  SharedSpinLockGuard &operator=(const SharedSpinLockGuard &) = delete;
+
+private:
+  SharedSpinLockMutex &mutex_;
+};
+
+}  // namespace common
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -32,6 +32,38 @@ class Aggregation
 
   virtual std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept = 0;
 
+  /**
+   * Merges the given aggregation into this one, with the same result as Merge() but without
+   * allocating a new aggregation.
+   *
+   * @param delta the newly captured (delta) aggregation
+   * @return false if the aggregation does not support merging in place, and Merge() is to be
+   * used instead.
+   */
+  virtual bool MergeInPlace(const Aggregation & /* delta */) noexcept { return false; }
+
+  /**
+   * Adds the buckets, count, sum, min and max of this explicit bucket histogram aggregation to the
+   * given point, without copying the buckets of the aggregation.
+   *
+   * @param point the point to add the histogram to
+   * @return false if this is not an explicit bucket histogram aggregation, or if its buckets or
+   * value type do not match the point.
+   */
+  virtual bool AddToHistogramPoint(HistogramPointData & /* point */) const noexcept
+  {
+    return false;
+  }
+
+  /**
+   * Resets the aggregation to its state before any measurement, so that it can be reused for the
+   * next collection.
+   *
+   * @return false if the aggregation does not support being reset, and is to be created again
+   * instead.
+   */
+  virtual bool Reset() noexcept { return false; }
+
   /**
    * Returns a new delta aggregation by comparing two cumulative measurements.
    *
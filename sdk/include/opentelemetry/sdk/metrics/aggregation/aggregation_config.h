@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "opentelemetry/version.h"
@@ -16,6 +18,10 @@ class AggregationConfig
 {
 public:
   virtual ~AggregationConfig() = default;
+
+  // Record sum and explicit bucket histogram measurements into atomic counters instead of under a
+  // lock. Recommended for instruments updated concurrently from many threads.
+  bool lock_free_ = false;
 };
 
 class HistogramAggregationConfig : public AggregationConfig
@@ -24,6 +30,18 @@ class HistogramAggregationConfig : public AggregationConfig
   std::vector<double> boundaries_;
   bool record_min_max_ = true;
 };
+
+class Base2ExponentialHistogramAggregationConfig : public AggregationConfig
+{
+public:
+  // Maximum number of buckets for each of the positive and negative ranges. The scale is
+  // reduced as needed to keep the recorded values within this number of buckets. Values lower
+  // than 3 are raised to 3, the number of buckets needed by the full range of doubles.
+  size_t max_buckets_ = 160;
+  // Initial, and maximum, scale of the histogram.
+  int32_t max_scale_   = 20;
+  bool record_min_max_ = true;
+};
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,67 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+
+#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_indexer.h"
+#include "opentelemetry/sdk/metrics/data/circular_buffer.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+class AggregationConfig;
+
+/**
+ * Aggregation into a base2 exponential histogram, as defined by the OpenTelemetry specification.
+ *
+ * Values are recorded at the highest scale which fits them into the configured maximum number of
+ * buckets: the histogram starts at the maximum scale, and whenever a value falls outside of the
+ * range representable by the bucket counters, the scale is reduced until it fits. Both long and
+ * double values are recorded as doubles.
+ */
+class Base2ExponentialHistogramAggregation : public Aggregation
+{
+public:
+  Base2ExponentialHistogramAggregation(const AggregationConfig *aggregation_config = nullptr);
+  Base2ExponentialHistogramAggregation(const ExponentialHistogramPointData &point_data);
+
+  void Aggregate(int64_t value, const PointAttributes &attributes = {}) noexcept override;
+
+  void Aggregate(double value, const PointAttributes &attributes = {}) noexcept override;
+
+  /* Returns the result of merge of the existing aggregation with delta aggregation. The result is
+   * at the lowest scale of both aggregations, reduced further if needed to fit the merged buckets
+   * into the maximum number of buckets. */
+  std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
+
+  /* Returns the new delta aggregation by comparing existing aggregation with next aggregation.
+   * Bucket counts of the `next` aggregation are expected to be greater or equal to the counts of
+   * the existing aggregation, at their common scale. */
+  std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
+
+  PointType ToPoint() const noexcept override;
+
+private:
+  void AggregateIntoBuckets(AdaptingCircularBufferCounter &buckets, double value) noexcept;
+
+  void Downscale(int32_t by) noexcept;
+
+  mutable opentelemetry::common::SpinLockMutex lock_;
+  // Holds everything but the buckets, which are materialized by ToPoint().
+  ExponentialHistogramPointData point_data_;
+  Base2ExponentialHistogramIndexer indexer_;
+  AdaptingCircularBufferCounter positive_buckets_;
+  AdaptingCircularBufferCounter negative_buckets_;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
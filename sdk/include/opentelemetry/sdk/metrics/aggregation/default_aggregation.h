@@ -6,6 +6,8 @@
 #include <memory>
 
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/drop_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/histogram_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/lastvalue_aggregation.h"
@@ -19,7 +21,6 @@ namespace sdk
 {
 namespace metrics
 {
-class AggregationConfig;
 
 class DefaultAggregation
 {
@@ -30,15 +31,24 @@ class DefaultAggregation
   {
     bool is_monotonic = true;
     auto aggr_type    = GetDefaultAggregationType(instrument_descriptor.type_, is_monotonic);
+    bool lock_free    = aggregation_config && aggregation_config->lock_free_;
     switch (aggr_type)
     {
       case AggregationType::kSum:
+        if (lock_free)
+        {
+          return CreateAtomicSumAggregation(instrument_descriptor, is_monotonic);
+        }
         return (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
                    ? std::move(std::unique_ptr<Aggregation>(new LongSumAggregation(is_monotonic)))
                    : std::move(
                          std::unique_ptr<Aggregation>(new DoubleSumAggregation(is_monotonic)));
         break;
       case AggregationType::kHistogram: {
+        if (lock_free)
+        {
+          return CreateAtomicHistogramAggregation(instrument_descriptor, aggregation_config);
+        }
         if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
         {
           return (std::unique_ptr<Aggregation>(new LongHistogramAggregation(aggregation_config)));
@@ -71,6 +81,10 @@ class DefaultAggregation
         return std::unique_ptr<Aggregation>(new DropAggregation());
         break;
       case AggregationType::kHistogram:
+        if (aggregation_config && aggregation_config->lock_free_)
+        {
+          return CreateAtomicHistogramAggregation(instrument_descriptor, aggregation_config);
+        }
         if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
         {
           return std::unique_ptr<Aggregation>(new LongHistogramAggregation(aggregation_config));
@@ -80,6 +94,10 @@ class DefaultAggregation
           return std::unique_ptr<Aggregation>(new DoubleHistogramAggregation(aggregation_config));
         }
         break;
+      case AggregationType::kBase2ExponentialHistogram:
+        return std::unique_ptr<Aggregation>(
+            new Base2ExponentialHistogramAggregation(aggregation_config));
+        break;
       case AggregationType::kLastValue:
         if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
         {
@@ -98,6 +116,10 @@ class DefaultAggregation
         {
           is_monotonic = false;
         }
+        if (aggregation_config && aggregation_config->lock_free_)
+        {
+          return CreateAtomicSumAggregation(instrument_descriptor, is_monotonic);
+        }
         if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
         {
           return std::unique_ptr<Aggregation>(new LongSumAggregation(is_monotonic));
@@ -138,6 +160,9 @@ class DefaultAggregation
           return std::unique_ptr<Aggregation>(
               new DoubleHistogramAggregation(nostd::get<HistogramPointData>(point_data)));
         }
+      case AggregationType::kBase2ExponentialHistogram:
+        return std::unique_ptr<Aggregation>(new Base2ExponentialHistogramAggregation(
+            nostd::get<ExponentialHistogramPointData>(point_data)));
       case AggregationType::kLastValue:
         if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
         {
@@ -165,6 +190,28 @@ class DefaultAggregation
     }
   }
 
+  static std::unique_ptr<Aggregation> CreateAtomicSumAggregation(
+      const InstrumentDescriptor &instrument_descriptor,
+      bool is_monotonic)
+  {
+    if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
+    {
+      return std::unique_ptr<Aggregation>(new LongAtomicSumAggregation(is_monotonic));
+    }
+    return std::unique_ptr<Aggregation>(new DoubleAtomicSumAggregation(is_monotonic));
+  }
+
+  static std::unique_ptr<Aggregation> CreateAtomicHistogramAggregation(
+      const InstrumentDescriptor &instrument_descriptor,
+      const AggregationConfig *aggregation_config)
+  {
+    if (instrument_descriptor.value_type_ == InstrumentValueType::kLong)
+    {
+      return std::unique_ptr<Aggregation>(new LongAtomicHistogramAggregation(aggregation_config));
+    }
+    return std::unique_ptr<Aggregation>(new DoubleAtomicHistogramAggregation(aggregation_config));
+  }
+
   static AggregationType GetDefaultAggregationType(InstrumentType instrument_type,
                                                    bool &is_monotonic)
   {
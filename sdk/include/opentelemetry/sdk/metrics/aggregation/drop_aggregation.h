@@ -40,6 +40,8 @@ class DropAggregation : public Aggregation
     return std::unique_ptr<Aggregation>(new DropAggregation());
   }
 
+  bool Reset() noexcept override { return true; }
+
   PointType ToPoint() const noexcept override
   {
     static DropPointData point_data;
@@ -4,10 +4,13 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 
+#include "opentelemetry/common/macros.h"
 #include "opentelemetry/common/spin_lock_mutex.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/version.h"
 
@@ -33,6 +36,12 @@ class LongHistogramAggregation : public Aggregation
    * boundaries */
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool AddToHistogramPoint(HistogramPointData &point) const noexcept override;
+
+  bool Reset() noexcept override;
+
   /* Returns the new delta aggregation by comparing existing aggregation with next aggregation with
    * same boundaries. Data points for `next` aggregation (sum , bucket-counts) should be more than
    * the current aggregation - which is the normal scenario as measurements values are monotonic
@@ -46,6 +55,7 @@ class LongHistogramAggregation : public Aggregation
   mutable opentelemetry::common::SpinLockMutex lock_;
   HistogramPointData point_data_;
   bool record_min_max_ = true;
+  HistogramBucketIndexer bucket_indexer_;
 };
 
 class DoubleHistogramAggregation : public Aggregation
@@ -63,6 +73,12 @@ class DoubleHistogramAggregation : public Aggregation
    * boundaries */
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool AddToHistogramPoint(HistogramPointData &point) const noexcept override;
+
+  bool Reset() noexcept override;
+
   /* Returns the new delta aggregation by comparing existing aggregation with next aggregation with
    * same boundaries. Data points for `next` aggregation (sum , bucket-counts) should be more than
    * the current aggregation - which is the normal scenario as measurements values are monotonic
@@ -76,6 +92,92 @@ class DoubleHistogramAggregation : public Aggregation
   mutable opentelemetry::common::SpinLockMutex lock_;
   mutable HistogramPointData point_data_;
   bool record_min_max_ = true;
+  HistogramBucketIndexer bucket_indexer_;
+};
+
+/**
+ * Explicit bucket histogram aggregations recording into a flat array of atomic counters, so that
+ * concurrent measurements never block each other nor the collection. Sum, min and max are updated
+ * with compare-and-swap loops, and the HistogramPointData is only materialized by ToPoint(). A
+ * point collected while measurements are being recorded may not include all of the fields of the
+ * measurements in flight.
+ */
+class LongAtomicHistogramAggregation : public Aggregation
+{
+public:
+  LongAtomicHistogramAggregation(const AggregationConfig *aggregation_config = nullptr);
+  LongAtomicHistogramAggregation(const HistogramPointData &);
+
+  void Aggregate(int64_t value, const PointAttributes &attributes = {}) noexcept override;
+
+  void Aggregate(double /* value */, const PointAttributes & /* attributes */) noexcept override {}
+
+  std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
+
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool AddToHistogramPoint(HistogramPointData &point) const noexcept override;
+
+  bool Reset() noexcept override;
+
+  std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
+
+  PointType ToPoint() const noexcept override;
+
+  // Allocated on a cache line boundary whatever the C++ standard, since new only honours the
+  // alignment of the class from C++17 onwards.
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr) noexcept;
+
+private:
+  std::vector<double> boundaries_;
+  bool record_min_max_ = true;
+  HistogramBucketIndexer bucket_indexer_;
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+  // The fields written by every measurement get a cache line of their own.
+  alignas(64) std::atomic<uint64_t> count_;
+  std::atomic<int64_t> sum_;
+  std::atomic<int64_t> min_;
+  std::atomic<int64_t> max_;
+};
+
+class DoubleAtomicHistogramAggregation : public Aggregation
+{
+public:
+  DoubleAtomicHistogramAggregation(const AggregationConfig *aggregation_config = nullptr);
+  DoubleAtomicHistogramAggregation(const HistogramPointData &);
+
+  void Aggregate(int64_t /* value */, const PointAttributes & /* attributes */) noexcept override {}
+
+  void Aggregate(double value, const PointAttributes &attributes = {}) noexcept override;
+
+  std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
+
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool AddToHistogramPoint(HistogramPointData &point) const noexcept override;
+
+  bool Reset() noexcept override;
+
+  std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
+
+  PointType ToPoint() const noexcept override;
+
+  // Allocated on a cache line boundary whatever the C++ standard, since new only honours the
+  // alignment of the class from C++17 onwards.
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr) noexcept;
+
+private:
+  std::vector<double> boundaries_;
+  bool record_min_max_ = true;
+  HistogramBucketIndexer bucket_indexer_;
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+  // The fields written by every measurement get a cache line of their own.
+  alignas(64) std::atomic<uint64_t> count_;
+  std::atomic<double> sum_;
+  std::atomic<double> min_;
+  std::atomic<double> max_;
 };
 
 template <class T>
@@ -0,0 +1,176 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "opentelemetry/version.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define OPENTELEMETRY_HISTOGRAM_INDEXER_SSE2
+#endif
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/*
+ * An indexer for explicit bucket histograms. It returns, for a given value, the index of the first
+ * boundary greater or equal to the value, which is the same as std::lower_bound over the sorted
+ * boundaries.
+ *
+ * The lookup strategy is picked once, from the boundaries:
+ * - small boundary sets are scanned with a vectorized compare (SSE2 where available), counting
+ *   the boundaries lower than the value, without branching on the compared values;
+ * - evenly spaced boundaries are indexed directly by dividing the value by the bucket width;
+ * - large boundary sets are searched in an Eytzinger (breadth-first) layout, which keeps the
+ *   first levels of the search in the same cache lines;
+ * - the other boundary sets are searched with std::lower_bound, which is as fast as the scan and
+ *   the Eytzinger search for these sizes.
+ *
+ * The boundaries are kept in a table aligned on a cache line.
+ */
+class HistogramBucketIndexer
+{
+public:
+  // Boundary sets up to this size are scanned linearly.
+  static constexpr size_t kMaxLinearBoundaries = 16;
+
+  // Boundary sets from this size are searched in the Eytzinger layout, unless evenly spaced.
+  static constexpr size_t kMinEytzingerBoundaries = 64;
+
+  enum class Strategy
+  {
+    kLinear,
+    kUniform,
+    kBinarySearch,
+    kEytzinger
+  };
+
+  /*
+   * Construct a new indexer for the given boundaries, which must be sorted in ascending order.
+   */
+  explicit HistogramBucketIndexer(const std::vector<double> &boundaries = {});
+
+  HistogramBucketIndexer(const HistogramBucketIndexer &other);
+  HistogramBucketIndexer &operator=(const HistogramBucketIndexer &other);
+  // Moving the storage keeps the table where it is.
+  HistogramBucketIndexer(HistogramBucketIndexer &&other)            = default;
+  HistogramBucketIndexer &operator=(HistogramBucketIndexer &&other) = default;
+
+  Strategy GetStrategy() const noexcept { return strategy_; }
+
+  /**
+   * Compute the index of the bucket the given value falls into.
+   *
+   * @param value Measured value.
+   * @return an index in [0, boundaries.size()].
+   */
+  size_t ComputeIndex(double value) const noexcept
+  {
+    switch (strategy_)
+    {
+      case Strategy::kUniform:
+        return ComputeUniformIndex(value);
+      case Strategy::kBinarySearch:
+        return std::lower_bound(table_, table_ + table_size_, value) - table_;
+      case Strategy::kEytzinger:
+        return ComputeEytzingerIndex(value);
+      default:
+        return ComputeLinearIndex(value);
+    }
+  }
+
+private:
+  size_t ComputeLinearIndex(double value) const noexcept
+  {
+    // table_ is padded with +infinity to a multiple of 4, which never compares lower.
+#ifdef OPENTELEMETRY_HISTOGRAM_INDEXER_SSE2
+    // Each comparison yields all ones (-1) in the lanes where the boundary is lower, which are
+    // subtracted from two independent accumulators.
+    const __m128d v = _mm_set1_pd(value);
+    __m128i low     = _mm_setzero_si128();
+    __m128i high    = _mm_setzero_si128();
+    for (size_t i = 0; i < table_size_; i += 4)
+    {
+      low  = _mm_sub_epi64(low, _mm_castpd_si128(_mm_cmplt_pd(_mm_load_pd(table_ + i), v)));
+      high = _mm_sub_epi64(high, _mm_castpd_si128(_mm_cmplt_pd(_mm_load_pd(table_ + i + 2), v)));
+    }
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), _mm_add_epi64(low, high));
+    return static_cast<size_t>(lanes[0] + lanes[1]);
+#else
+    size_t index = 0;
+    for (size_t i = 0; i < table_size_; i++)
+    {
+      index += static_cast<size_t>(table_[i] < value);
+    }
+    return index;
+#endif
+  }
+
+  size_t ComputeUniformIndex(double value) const noexcept
+  {
+    // The bucket is computed from the first boundary and the bucket width, then adjusted by at
+    // most one bucket for the rounding of the division. Values out of range, or NaN, are clamped
+    // by the adjustments.
+    double position = (value - first_boundary_) * inverse_width_;
+    size_t index    = 0;
+    if (position > 0)
+    {
+      index = position < static_cast<double>(table_size_) ? static_cast<size_t>(position)
+                                                          : table_size_;
+    }
+    while (index > 0 && table_[index - 1] >= value)
+    {
+      index--;
+    }
+    while (index < table_size_ && table_[index] < value)
+    {
+      index++;
+    }
+    return index;
+  }
+
+  size_t ComputeEytzingerIndex(double value) const noexcept
+  {
+    // table_[k] holds the boundary of node k, with children 2k and 2k+1, and table_[0] unused.
+    size_t k = 1;
+    while (k < table_size_)
+    {
+      k = 2 * k + static_cast<size_t>(table_[k] < value);
+    }
+    // Go back up to the last node where the search went left, which is the lower bound.
+    while (k & 1)
+    {
+      k >>= 1;
+    }
+    k >>= 1;
+    return sorted_indexes_[k];
+  }
+
+  // Copies the table into storage_, at the first cache line boundary.
+  void SetTable(const double *table, size_t size);
+
+  Strategy strategy_;
+  std::vector<double> storage_;
+  const double *table_ = nullptr;
+  size_t table_size_   = 0;
+  // Only for kEytzinger: the index of each node in the sorted boundaries, and the size of the
+  // boundaries for the node 0 (value greater than every boundary).
+  std::vector<size_t> sorted_indexes_;
+  // Only for kUniform.
+  double first_boundary_ = 0;
+  double inverse_width_  = 0;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -28,6 +28,10 @@ class LongLastValueAggregation : public Aggregation
 
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool Reset() noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
@@ -50,6 +54,10 @@ class DoubleLastValueAggregation : public Aggregation
 
   virtual std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool Reset() noexcept override;
+
   virtual std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
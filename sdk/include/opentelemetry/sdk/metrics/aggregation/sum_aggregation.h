@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
@@ -29,6 +30,10 @@ class LongSumAggregation : public Aggregation
 
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool Reset() noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
@@ -51,6 +56,10 @@ class DoubleSumAggregation : public Aggregation
 
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool Reset() noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
@@ -60,6 +69,60 @@ class DoubleSumAggregation : public Aggregation
   SumPointData point_data_;
 };
 
+/**
+ * Sum aggregations recording into an atomic counter, so that concurrent measurements never block
+ * each other nor the collection. The SumPointData is only materialized by ToPoint().
+ */
+class LongAtomicSumAggregation : public Aggregation
+{
+public:
+  LongAtomicSumAggregation(bool is_monotonic);
+  LongAtomicSumAggregation(const SumPointData &);
+
+  void Aggregate(int64_t value, const PointAttributes &attributes = {}) noexcept override;
+
+  void Aggregate(double /* value */, const PointAttributes & /* attributes */) noexcept override {}
+
+  std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
+
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool Reset() noexcept override;
+
+  std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
+
+  PointType ToPoint() const noexcept override;
+
+private:
+  const bool is_monotonic_;
+  std::atomic<int64_t> value_;
+};
+
+class DoubleAtomicSumAggregation : public Aggregation
+{
+public:
+  DoubleAtomicSumAggregation(bool is_monotonic);
+  DoubleAtomicSumAggregation(const SumPointData &);
+
+  void Aggregate(int64_t /* value */, const PointAttributes & /* attributes */) noexcept override {}
+
+  void Aggregate(double value, const PointAttributes &attributes = {}) noexcept override;
+
+  std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
+
+  bool MergeInPlace(const Aggregation &delta) noexcept override;
+
+  bool Reset() noexcept override;
+
+  std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
+
+  PointType ToPoint() const noexcept override;
+
+private:
+  const bool is_monotonic_;
+  std::atomic<double> value_;
+};
+
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
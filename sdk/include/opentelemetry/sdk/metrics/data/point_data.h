@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "opentelemetry/common/timestamp.h"
@@ -64,6 +66,36 @@ class HistogramPointData
   bool record_min_max_            = true;
 };
 
+class ExponentialHistogramBuckets
+{
+public:
+  // Index of the first bucket in counts_, at the scale of the enclosing point.
+  int32_t offset_               = 0;
+  std::vector<uint64_t> counts_ = {};
+};
+
+class ExponentialHistogramPointData
+{
+public:
+  // TODO: remove ctors and initializers when GCC<5 stops shipping on Ubuntu
+  ExponentialHistogramPointData(ExponentialHistogramPointData &&)      = default;
+  ExponentialHistogramPointData(const ExponentialHistogramPointData &) = default;
+  ExponentialHistogramPointData &operator=(ExponentialHistogramPointData &&) = default;
+  ExponentialHistogramPointData()                                            = default;
+
+  double sum_                                   = {};
+  double min_                                   = {};
+  double max_                                   = {};
+  double zero_threshold_                        = {};
+  uint64_t count_                               = {};
+  uint64_t zero_count_                          = {};
+  int32_t scale_                                = {};
+  size_t max_buckets_                           = {};
+  ExponentialHistogramBuckets positive_buckets_ = {};
+  ExponentialHistogramBuckets negative_buckets_ = {};
+  bool record_min_max_                          = true;
+};
+
 class DropPointData
 {
 public:
@@ -41,6 +41,13 @@ class AttributeHashGenerator
   }
 };
 
+/**
+ * Maps attribute hashes to the attributes and aggregation of each series.
+ *
+ * Clear() resets the aggregations in place and keeps the series, so that a hashmap refilled
+ * after being collected does not allocate the series recorded again. A series kept that way is
+ * not visible until it is set again, and it is removed by the next Clear() if it was not.
+ */
 class AttributesHashMap
 {
 public:
@@ -50,9 +57,9 @@ class AttributesHashMap
   Aggregation *Get(size_t hash) const
   {
     auto it = hash_map_.find(hash);
-    if (it != hash_map_.end())
+    if (it != hash_map_.end() && it->second.active)
     {
-      return it->second.second.get();
+      return it->second.aggregation.get();
     }
     return nullptr;
   }
@@ -61,7 +68,7 @@ class AttributesHashMap
    * @return check if key is present in hash
    *
    */
-  bool Has(size_t hash) const { return hash_map_.find(hash) != hash_map_.end(); }
+  bool Has(size_t hash) const { return Get(hash) != nullptr; }
 
   /**
    * @return the pointer to value for given key if present.
@@ -72,61 +79,22 @@ class AttributesHashMap
                                std::function<std::unique_ptr<Aggregation>()> aggregation_callback,
                                size_t hash)
   {
-    auto it = hash_map_.find(hash);
-    if (it != hash_map_.end())
-    {
-      return it->second.second.get();
-    }
-
-    if (IsOverflowAttributes())
-    {
-      return GetOrSetOveflowAttributes(aggregation_callback);
-    }
-
-    MetricAttributes attr{attributes};
-
-    hash_map_[hash] = {attr, aggregation_callback()};
-    return hash_map_[hash].second.get();
+    return GetOrSetDefault(
+        [&attributes]() { return MetricAttributes{attributes}; }, aggregation_callback, hash);
   }
 
   Aggregation *GetOrSetDefault(std::function<std::unique_ptr<Aggregation>()> aggregation_callback,
                                size_t hash)
   {
-    auto it = hash_map_.find(hash);
-    if (it != hash_map_.end())
-    {
-      return it->second.second.get();
-    }
-
-    if (IsOverflowAttributes())
-    {
-      return GetOrSetOveflowAttributes(aggregation_callback);
-    }
-
-    MetricAttributes attr{};
-    hash_map_[hash] = {attr, aggregation_callback()};
-    return hash_map_[hash].second.get();
+    return GetOrSetDefault([]() { return MetricAttributes{}; }, aggregation_callback, hash);
   }
 
   Aggregation *GetOrSetDefault(const MetricAttributes &attributes,
                                std::function<std::unique_ptr<Aggregation>()> aggregation_callback,
                                size_t hash)
   {
-    auto it = hash_map_.find(hash);
-    if (it != hash_map_.end())
-    {
-      return it->second.second.get();
-    }
-
-    if (IsOverflowAttributes())
-    {
-      return GetOrSetOveflowAttributes(aggregation_callback);
-    }
-
-    MetricAttributes attr{attributes};
-
-    hash_map_[hash] = {attr, aggregation_callback()};
-    return hash_map_[hash].second.get();
+    return GetOrSetDefault(
+        [&attributes]() { return MetricAttributes{attributes}; }, aggregation_callback, hash);
   }
 
   /**
@@ -136,41 +104,50 @@ class AttributesHashMap
            std::unique_ptr<Aggregation> aggr,
            size_t hash)
   {
-    auto it = hash_map_.find(hash);
-    if (it != hash_map_.end())
-    {
-      it->second.second = std::move(aggr);
-    }
-    else if (IsOverflowAttributes())
-    {
-      hash_map_[kOverflowAttributesHash] = {
-          MetricAttributes{{kAttributesLimitOverflowKey, kAttributesLimitOverflowValue}},
-          std::move(aggr)};
-    }
-    else
-    {
-      MetricAttributes attr{attributes};
-      hash_map_[hash] = {attr, std::move(aggr)};
-    }
+    Set([&attributes]() { return MetricAttributes{attributes}; }, std::move(aggr), hash);
   }
 
   void Set(const MetricAttributes &attributes, std::unique_ptr<Aggregation> aggr, size_t hash)
   {
-    auto it = hash_map_.find(hash);
-    if (it != hash_map_.end())
-    {
-      it->second.second = std::move(aggr);
-    }
-    else if (IsOverflowAttributes())
+    Set([&attributes]() { return MetricAttributes{attributes}; }, std::move(aggr), hash);
+  }
+
+  /**
+   * Merge the given aggregation into the value for given key, in place when the aggregation
+   * supports it. If not present, the value is created through the provided callback, subject to
+   * the cardinality limit of this hashmap.
+   */
+  void Merge(const MetricAttributes &attributes,
+             const Aggregation &aggregation,
+             std::function<std::unique_ptr<Aggregation>()> aggregation_callback,
+             size_t hash)
+  {
+    Aggregation *value = GetOrSetDefault(attributes, aggregation_callback, hash);
+    if (!value->MergeInPlace(aggregation))
     {
-      hash_map_[kOverflowAttributesHash] = {
-          MetricAttributes{{kAttributesLimitOverflowKey, kAttributesLimitOverflowValue}},
-          std::move(aggr)};
+      // The value is either the one of the key, or the overflow one.
+      auto it = hash_map_.find(hash);
+      if (it == hash_map_.end() || it->second.aggregation.get() != value)
+      {
+        it = hash_map_.find(kOverflowAttributesHash);
+      }
+      it->second.aggregation = value->Merge(aggregation);
     }
-    else
+  }
+
+  /**
+   * Merge all the entries of the given hashmap into this one, reusing the hashes it was built
+   * with.
+   */
+  void Merge(const AttributesHashMap &other,
+             std::function<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    for (auto &kv : other.hash_map_)
     {
-      MetricAttributes attr{attributes};
-      hash_map_[hash] = {attr, std::move(aggr)};
+      if (kv.second.active)
+      {
+        Merge(kv.second.attributes, *kv.second.aggregation, aggregation_callback, kv.first);
+      }
     }
   }
 
@@ -182,7 +159,7 @@ class AttributesHashMap
   {
     for (auto &kv : hash_map_)
     {
-      if (!callback(kv.second.first, *(kv.second.second.get())))
+      if (kv.second.active && !callback(kv.second.attributes, *(kv.second.aggregation.get())))
       {
         return false;  // callback is not prepared to consume data
       }
@@ -193,33 +170,121 @@ class AttributesHashMap
   /**
    * Return the size of hash.
    */
-  size_t Size() { return hash_map_.size(); }
+  size_t Size() { return active_size_; }
+
+  /**
+   * Remove all the entries. The aggregations which can be reset are kept with their series, to
+   * be reused when the series are set again, while the series kept by the previous Clear() and
+   * not set since are removed.
+   */
+  void Clear()
+  {
+    for (auto it = hash_map_.begin(); it != hash_map_.end();)
+    {
+      if (it->second.active && it->second.aggregation->Reset())
+      {
+        it->second.active = false;
+        ++it;
+      }
+      else
+      {
+        it = hash_map_.erase(it);
+      }
+    }
+    active_size_ = 0;
+  }
 
 private:
-  std::unordered_map<size_t, std::pair<MetricAttributes, std::unique_ptr<Aggregation>>> hash_map_;
+  struct Entry
+  {
+    MetricAttributes attributes;
+    std::unique_ptr<Aggregation> aggregation;
+    // false for the series kept by Clear() and not set since
+    bool active;
+  };
+
+  std::unordered_map<size_t, Entry> hash_map_;
+  size_t active_size_ = 0;
   size_t attributes_limit_;
 
-  Aggregation *GetOrSetOveflowAttributes(
-      std::function<std::unique_ptr<Aggregation>()> aggregation_callback)
+  template <class MakeAttributes>
+  Aggregation *GetOrSetDefault(MakeAttributes make_attributes,
+                               std::function<std::unique_ptr<Aggregation>()> &aggregation_callback,
+                               size_t hash)
   {
-    auto agg = aggregation_callback();
-    return GetOrSetOveflowAttributes(std::move(agg));
+    auto it = hash_map_.find(hash);
+    if (it != hash_map_.end() && it->second.active)
+    {
+      return it->second.aggregation.get();
+    }
+
+    if (IsOverflowAttributes())
+    {
+      return GetOrSetOveflowAttributes(aggregation_callback);
+    }
+
+    if (it == hash_map_.end())
+    {
+      it = hash_map_.emplace(hash, Entry{make_attributes(), aggregation_callback(), false}).first;
+    }
+    Activate(it->second);
+    return it->second.aggregation.get();
   }
 
-  Aggregation *GetOrSetOveflowAttributes(std::unique_ptr<Aggregation> agg)
+  template <class MakeAttributes>
+  void Set(MakeAttributes make_attributes, std::unique_ptr<Aggregation> aggr, size_t hash)
   {
-    auto it = hash_map_.find(kOverflowAttributesHash);
-    if (it != hash_map_.end())
+    auto it = hash_map_.find(hash);
+    if (it == hash_map_.end() || !it->second.active)
+    {
+      if (IsOverflowAttributes())
+      {
+        hash = kOverflowAttributesHash;
+        it   = hash_map_.find(hash);
+        if (it == hash_map_.end())
+        {
+          it = hash_map_
+                   .emplace(hash, Entry{MetricAttributes{{kAttributesLimitOverflowKey,
+                                                          kAttributesLimitOverflowValue}},
+                                        nullptr, false})
+                   .first;
+        }
+      }
+      else if (it == hash_map_.end())
+      {
+        it = hash_map_.emplace(hash, Entry{make_attributes(), nullptr, false}).first;
+      }
+      Activate(it->second);
+    }
+    it->second.aggregation = std::move(aggr);
+  }
+
+  void Activate(Entry &entry)
+  {
+    if (!entry.active)
     {
-      return it->second.second.get();
+      entry.active = true;
+      ++active_size_;
     }
+  }
 
-    MetricAttributes attr{{kAttributesLimitOverflowKey, kAttributesLimitOverflowValue}};
-    hash_map_[kOverflowAttributesHash] = {attr, std::move(agg)};
-    return hash_map_[kOverflowAttributesHash].second.get();
+  Aggregation *GetOrSetOveflowAttributes(
+      std::function<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    auto it = hash_map_.find(kOverflowAttributesHash);
+    if (it == hash_map_.end())
+    {
+      MetricAttributes attr{{kAttributesLimitOverflowKey, kAttributesLimitOverflowValue}};
+      it = hash_map_
+               .emplace(kOverflowAttributesHash,
+                        Entry{std::move(attr), aggregation_callback(), false})
+               .first;
+    }
+    Activate(it->second);
+    return it->second.aggregation.get();
   }
 
-  bool IsOverflowAttributes() const { return (hash_map_.size() + 1 >= attributes_limit_); }
+  bool IsOverflowAttributes() const { return (active_size_ + 1 >= attributes_limit_); }
 };
 }  // namespace metrics
 
@@ -47,6 +47,17 @@ class MetricStorage
                        nostd::function_ref<bool(MetricData)> callback) noexcept = 0;
 };
 
+/* Represents the sync metric storage bound to a fixed set of attributes */
+class BoundSyncWritableMetricStorage
+{
+public:
+  virtual void RecordLong(int64_t value) noexcept = 0;
+
+  virtual void RecordDouble(double value) noexcept = 0;
+
+  virtual ~BoundSyncWritableMetricStorage() = default;
+};
+
 /* Represents the sync metric storage */
 class SyncWritableMetricStorage
 {
@@ -65,6 +76,18 @@ class SyncWritableMetricStorage
                             const opentelemetry::common::KeyValueIterable &attributes,
                             const opentelemetry::context::Context &context) noexcept = 0;
 
+  /**
+   * Resolve the given attributes once, and return a storage to record measurements for them
+   * without looking them up again. The returned storage stays valid across collections.
+   *
+   * @return the bound storage, or nullptr if the storage does not support binding.
+   */
+  virtual std::unique_ptr<BoundSyncWritableMetricStorage> Bind(
+      const opentelemetry::common::KeyValueIterable & /* attributes */) noexcept
+  {
+    return nullptr;
+  }
+
   virtual ~SyncWritableMetricStorage() = default;
 };
 
@@ -99,6 +122,14 @@ class NoopMetricStorage : public MetricStorage
   }
 };
 
+class NoopBoundWritableMetricStorage : public BoundSyncWritableMetricStorage
+{
+public:
+  void RecordLong(int64_t /* value */) noexcept override {}
+
+  void RecordDouble(double /* value */) noexcept override {}
+};
+
 class NoopWritableMetricStorage : public SyncWritableMetricStorage
 {
 public:
@@ -118,6 +149,12 @@ class NoopWritableMetricStorage : public SyncWritableMetricStorage
                     const opentelemetry::common::KeyValueIterable & /* attributes */,
                     const opentelemetry::context::Context & /* context */) noexcept override
   {}
+
+  std::unique_ptr<BoundSyncWritableMetricStorage> Bind(
+      const opentelemetry::common::KeyValueIterable & /* attributes */) noexcept override
+  {
+    return std::unique_ptr<BoundSyncWritableMetricStorage>(new NoopBoundWritableMetricStorage());
+  }
 };
 
 class NoopAsyncWritableMetricStorage : public AsyncWritableMetricStorage
@@ -28,6 +28,34 @@ namespace sdk
 namespace metrics
 {
 
+class BoundSyncMultiMetricStorage : public BoundSyncWritableMetricStorage
+{
+public:
+  void AddStorage(std::unique_ptr<BoundSyncWritableMetricStorage> storage)
+  {
+    storages_.push_back(std::move(storage));
+  }
+
+  void RecordLong(int64_t value) noexcept override
+  {
+    for (auto &s : storages_)
+    {
+      s->RecordLong(value);
+    }
+  }
+
+  void RecordDouble(double value) noexcept override
+  {
+    for (auto &s : storages_)
+    {
+      s->RecordDouble(value);
+    }
+  }
+
+private:
+  std::vector<std::unique_ptr<BoundSyncWritableMetricStorage>> storages_;
+};
+
 class SyncMultiMetricStorage : public SyncWritableMetricStorage
 {
 public:
@@ -74,6 +102,21 @@ class SyncMultiMetricStorage : public SyncWritableMetricStorage
     }
   }
 
+  std::unique_ptr<BoundSyncWritableMetricStorage> Bind(
+      const opentelemetry::common::KeyValueIterable &attributes) noexcept override
+  {
+    std::unique_ptr<BoundSyncMultiMetricStorage> bound_storages(new BoundSyncMultiMetricStorage());
+    for (auto &s : storages_)
+    {
+      auto bound_storage = s->Bind(attributes);
+      if (bound_storage)
+      {
+        bound_storages->AddStorage(std::move(bound_storage));
+      }
+    }
+    return std::unique_ptr<BoundSyncWritableMetricStorage>(bound_storages.release());
+  }
+
 private:
   std::vector<std::shared_ptr<SyncWritableMetricStorage>> storages_;
 };
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
 #include "opentelemetry/nostd/function_ref.h"
@@ -16,6 +18,7 @@
 #include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/sdk/common/attributemap_hash.h"
+#include "opentelemetry/sdk/common/shared_spin_lock_mutex.h"
 #include "opentelemetry/sdk/metrics/aggregation/default_aggregation.h"
 #include "opentelemetry/sdk/metrics/exemplar/reservoir.h"
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
@@ -41,20 +44,32 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
                     nostd::shared_ptr<ExemplarReservoir> &&exemplar_reservoir
                         OPENTELEMETRY_MAYBE_UNUSED,
                     const AggregationConfig *aggregation_config,
-                    size_t attributes_limit = kAggregationCardinalityLimit)
+                    size_t attributes_limit = kAggregationCardinalityLimit,
+                    size_t shard_count      = 1)
       : instrument_descriptor_(instrument_descriptor),
-        attributes_hashmap_(new AttributesHashMap(attributes_limit)),
+        attributes_limit_(attributes_limit),
+        shard_count_(shard_count == 0 ? 1 : shard_count),
+        shards_(new Shard[shard_count_]),
         attributes_processor_(attributes_processor),
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
         exemplar_reservoir_(exemplar_reservoir),
 #endif
         temporal_metric_storage_(instrument_descriptor, aggregation_type, aggregation_config)
   {
+    bool is_monotonic   = false;
+    is_sum_aggregation_ = aggregation_type == AggregationType::kSum ||
+                          (aggregation_type == AggregationType::kDefault &&
+                           DefaultAggregation::GetDefaultAggregationType(
+                               instrument_descriptor.type_, is_monotonic) == AggregationType::kSum);
     create_default_aggregation_ = [&, aggregation_type,
                                    aggregation_config]() -> std::unique_ptr<Aggregation> {
       return DefaultAggregation::CreateAggregation(aggregation_type, instrument_descriptor_,
                                                    aggregation_config);
     };
+    for (size_t i = 0; i < shard_count_; i++)
+    {
+      shards_[i].attributes_hashmap.reset(new AttributesHashMap(attributes_limit_));
+    }
   }
 
   void RecordLong(int64_t value,
@@ -69,8 +84,18 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
     exemplar_reservoir_->OfferMeasurement(value, {}, context, std::chrono::system_clock::now());
 #endif
     static size_t hash = opentelemetry::sdk::common::GetHash("");
-    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(attribute_hashmap_lock_);
-    attributes_hashmap_->GetOrSetDefault(create_default_aggregation_, hash)->Aggregate(value);
+    Shard &shard       = GetShard();
+    {
+      opentelemetry::sdk::common::SharedSpinLockGuard guard(shard.lock);
+      Aggregation *aggregation = shard.attributes_hashmap->Get(hash);
+      if (aggregation != nullptr)
+      {
+        aggregation->Aggregate(value);
+        return;
+      }
+    }
+    std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(shard.lock);
+    shard.attributes_hashmap->GetOrSetDefault(create_default_aggregation_, hash)->Aggregate(value);
   }
 
   void RecordLong(int64_t value,
@@ -98,8 +123,18 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
           }
         });
 
-    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(attribute_hashmap_lock_);
-    attributes_hashmap_->GetOrSetDefault(attributes, create_default_aggregation_, hash)
+    Shard &shard = GetShard();
+    {
+      opentelemetry::sdk::common::SharedSpinLockGuard guard(shard.lock);
+      Aggregation *aggregation = shard.attributes_hashmap->Get(hash);
+      if (aggregation != nullptr)
+      {
+        aggregation->Aggregate(value);
+        return;
+      }
+    }
+    std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(shard.lock);
+    shard.attributes_hashmap->GetOrSetDefault(attributes, create_default_aggregation_, hash)
         ->Aggregate(value);
   }
 
@@ -115,8 +150,18 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
     exemplar_reservoir_->OfferMeasurement(value, {}, context, std::chrono::system_clock::now());
 #endif
     static size_t hash = opentelemetry::sdk::common::GetHash("");
-    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(attribute_hashmap_lock_);
-    attributes_hashmap_->GetOrSetDefault(create_default_aggregation_, hash)->Aggregate(value);
+    Shard &shard       = GetShard();
+    {
+      opentelemetry::sdk::common::SharedSpinLockGuard guard(shard.lock);
+      Aggregation *aggregation = shard.attributes_hashmap->Get(hash);
+      if (aggregation != nullptr)
+      {
+        aggregation->Aggregate(value);
+        return;
+      }
+    }
+    std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(shard.lock);
+    shard.attributes_hashmap->GetOrSetDefault(create_default_aggregation_, hash)->Aggregate(value);
   }
 
   void RecordDouble(double value,
@@ -147,11 +192,24 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
             return true;
           }
         });
-    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(attribute_hashmap_lock_);
-    attributes_hashmap_->GetOrSetDefault(attributes, create_default_aggregation_, hash)
+    Shard &shard = GetShard();
+    {
+      opentelemetry::sdk::common::SharedSpinLockGuard guard(shard.lock);
+      Aggregation *aggregation = shard.attributes_hashmap->Get(hash);
+      if (aggregation != nullptr)
+      {
+        aggregation->Aggregate(value);
+        return;
+      }
+    }
+    std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(shard.lock);
+    shard.attributes_hashmap->GetOrSetDefault(attributes, create_default_aggregation_, hash)
         ->Aggregate(value);
   }
 
+  std::unique_ptr<BoundSyncWritableMetricStorage> Bind(
+      const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
+
   bool Collect(CollectorHandle *collector,
                nostd::span<std::shared_ptr<CollectorHandle>> collectors,
                opentelemetry::common::SystemTimestamp sdk_start_ts,
@@ -159,16 +217,84 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
                nostd::function_ref<bool(MetricData)> callback) noexcept override;
 
 private:
+  // A shard owns a hashmap to maintain the metrics for delta collection (i.e, collection since
+  // last Collect call), guarded by its own lock. Recording threads are spread over the shards so
+  // that they do not all contend on the same lock, and the shards are merged on Collect.
+  // Measurements of the series already in the hashmap are recorded with the lock held shared,
+  // since aggregations can be updated concurrently, and the lock is only held exclusively to add
+  // series and to swap the hashmap out.
+  // The hashmap swapped out on Collect is cleared and kept as the inactive one once collected,
+  // so that the next Collect swaps it back in, with its series and aggregations reset in place,
+  // instead of allocating a new hashmap.
+  struct Shard
+  {
+    opentelemetry::sdk::common::SharedSpinLockMutex lock;
+    std::shared_ptr<AttributesHashMap> attributes_hashmap;
+    std::shared_ptr<AttributesHashMap> inactive_hashmap;
+    // keep the locks of adjacent shards on separate cache lines
+    char padding[64];
+  };
+
+  Shard &GetShard() noexcept
+  {
+    if (shard_count_ == 1)
+    {
+      return shards_[0];
+    }
+    return shards_[GetThreadShardIndex() % shard_count_];
+  }
+
+  static size_t GetThreadShardIndex() noexcept;
+
+  std::shared_ptr<AttributesHashMap> SwapShardHashMap(Shard &shard) noexcept;
+
+  // Clears the collected hashmap and keeps it as the inactive one, unless it is still referenced
+  void RecycleHashMap(opentelemetry::sdk::common::SharedSpinLockMutex &lock,
+                      std::shared_ptr<AttributesHashMap> &inactive_hashmap,
+                      std::shared_ptr<AttributesHashMap> hashmap) noexcept;
+
+  // A series bound through Bind(). It is shared between the storage and the bound storage, and
+  // drained into the delta metrics on Collect when it was recorded to, so it stays valid across
+  // collections. Like any other series, it is drained into the overflow series once the
+  // cardinality limit of the delta metrics is reached. Sums are accumulated in atomics, other
+  // aggregations are recorded under the entry lock.
+  struct BoundEntry
+  {
+    BoundEntry(MetricAttributes &&attributes_, size_t hash_, bool is_sum_)
+        : attributes(std::move(attributes_)), hash(hash_), is_sum(is_sum_)
+    {}
+
+    const MetricAttributes attributes;
+    const size_t hash;
+    const bool is_sum;
+    std::atomic<int64_t> long_sum{0};
+    std::atomic<double> double_sum{0.0};
+    opentelemetry::common::SpinLockMutex lock;
+    std::unique_ptr<Aggregation> aggregation;
+    // set after each measurement, so that series recording a zero sum are still collected
+    std::atomic<bool> has_records{false};
+  };
+
+  class BoundStorage;
+
+  void CollectBoundEntries(AttributesHashMap &delta_metrics) noexcept;
+
   InstrumentDescriptor instrument_descriptor_;
-  // hashmap to maintain the metrics for delta collection (i.e, collection since last Collect call)
-  std::unique_ptr<AttributesHashMap> attributes_hashmap_;
+  size_t attributes_limit_;
+  size_t shard_count_;
+  std::unique_ptr<Shard[]> shards_;
+  // the hashmap the shards were merged into, kept across collections like the shard ones
+  std::shared_ptr<AttributesHashMap> inactive_merged_hashmap_;
+  opentelemetry::sdk::common::SharedSpinLockMutex merged_hashmap_lock_;
   std::function<std::unique_ptr<Aggregation>()> create_default_aggregation_;
   const AttributesProcessor *attributes_processor_;
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
   nostd::shared_ptr<ExemplarReservoir> exemplar_reservoir_;
 #endif
   TemporalMetricStorage temporal_metric_storage_;
-  opentelemetry::common::SpinLockMutex attribute_hashmap_lock_;
+  bool is_sum_aggregation_;
+  std::vector<std::shared_ptr<BoundEntry>> bound_entries_;
+  opentelemetry::common::SpinLockMutex bound_entries_lock_;
 };
 
 }  // namespace metrics
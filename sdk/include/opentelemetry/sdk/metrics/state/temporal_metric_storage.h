@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -19,6 +20,7 @@ namespace sdk
 {
 namespace metrics
 {
+class Aggregation;
 class AggregationConfig;
 class AttributesHashMap;
 class CollectorHandle;
@@ -26,6 +28,8 @@ class MetricData;
 
 struct LastReportedMetrics
 {
+  // The cumulative metrics reported to the collector, updated in place on each collection. Not
+  // kept for collectors with delta temporality.
   std::unique_ptr<AttributesHashMap> attributes_map;
   opentelemetry::common::SystemTimestamp collection_ts;
 };
@@ -57,6 +61,7 @@ class TemporalMetricStorage
   // Lock while building metrics
   mutable opentelemetry::common::SpinLockMutex lock_;
   const AggregationConfig *aggregation_config_;
+  std::function<std::unique_ptr<Aggregation>()> create_default_aggregation_;
 };
 }  // namespace metrics
 }  // namespace sdk
@@ -18,6 +18,7 @@ namespace metrics
 {
 
 // forward declaration
+class BoundSyncWritableMetricStorage;
 class SyncWritableMetricStorage;
 
 class Synchronous
@@ -33,6 +34,72 @@ class Synchronous
   std::unique_ptr<SyncWritableMetricStorage> storage_;
 };
 
+/**
+ * A synchronous instrument bound to a fixed set of attributes, as returned by the Bind method of
+ * the SDK instruments. The attributes are resolved once when binding, so recording a measurement
+ * does not hash and look them up again. A bound instrument stays valid across collections.
+ */
+class BoundSynchronous
+{
+public:
+  BoundSynchronous(InstrumentDescriptor instrument_descriptor,
+                   std::unique_ptr<BoundSyncWritableMetricStorage> storage)
+      : instrument_descriptor_(instrument_descriptor), storage_(std::move(storage))
+  {}
+
+protected:
+  InstrumentDescriptor instrument_descriptor_;
+  std::unique_ptr<BoundSyncWritableMetricStorage> storage_;
+};
+
+class BoundLongCounter : public BoundSynchronous
+{
+public:
+  using BoundSynchronous::BoundSynchronous;
+
+  void Add(uint64_t value) noexcept;
+};
+
+class BoundDoubleCounter : public BoundSynchronous
+{
+public:
+  using BoundSynchronous::BoundSynchronous;
+
+  void Add(double value) noexcept;
+};
+
+class BoundLongUpDownCounter : public BoundSynchronous
+{
+public:
+  using BoundSynchronous::BoundSynchronous;
+
+  void Add(int64_t value) noexcept;
+};
+
+class BoundDoubleUpDownCounter : public BoundSynchronous
+{
+public:
+  using BoundSynchronous::BoundSynchronous;
+
+  void Add(double value) noexcept;
+};
+
+class BoundLongHistogram : public BoundSynchronous
+{
+public:
+  using BoundSynchronous::BoundSynchronous;
+
+  void Record(uint64_t value) noexcept;
+};
+
+class BoundDoubleHistogram : public BoundSynchronous
+{
+public:
+  using BoundSynchronous::BoundSynchronous;
+
+  void Record(double value) noexcept;
+};
+
 class LongCounter : public Synchronous, public opentelemetry::metrics::Counter<uint64_t>
 {
 public:
@@ -49,6 +116,8 @@ class LongCounter : public Synchronous, public opentelemetry::metrics::Counter<u
   void Add(uint64_t value) noexcept override;
 
   void Add(uint64_t value, const opentelemetry::context::Context &context) noexcept override;
+
+  BoundLongCounter Bind(const opentelemetry::common::KeyValueIterable &attributes) noexcept;
 };
 
 class DoubleCounter : public Synchronous, public opentelemetry::metrics::Counter<double>
@@ -66,6 +135,8 @@ class DoubleCounter : public Synchronous, public opentelemetry::metrics::Counter
 
   void Add(double value) noexcept override;
   void Add(double value, const opentelemetry::context::Context &context) noexcept override;
+
+  BoundDoubleCounter Bind(const opentelemetry::common::KeyValueIterable &attributes) noexcept;
 };
 
 class LongUpDownCounter : public Synchronous, public opentelemetry::metrics::UpDownCounter<int64_t>
@@ -82,6 +153,8 @@ class LongUpDownCounter : public Synchronous, public opentelemetry::metrics::UpD
 
   void Add(int64_t value) noexcept override;
   void Add(int64_t value, const opentelemetry::context::Context &context) noexcept override;
+
+  BoundLongUpDownCounter Bind(const opentelemetry::common::KeyValueIterable &attributes) noexcept;
 };
 
 class DoubleUpDownCounter : public Synchronous, public opentelemetry::metrics::UpDownCounter<double>
@@ -98,6 +171,8 @@ class DoubleUpDownCounter : public Synchronous, public opentelemetry::metrics::U
 
   void Add(double value) noexcept override;
   void Add(double value, const opentelemetry::context::Context &context) noexcept override;
+
+  BoundDoubleUpDownCounter Bind(const opentelemetry::common::KeyValueIterable &attributes) noexcept;
 };
 
 class LongHistogram : public Synchronous, public opentelemetry::metrics::Histogram<uint64_t>
@@ -118,6 +193,8 @@ class LongHistogram : public Synchronous, public opentelemetry::metrics::Histogr
               const opentelemetry::context::Context &context) noexcept override;
 
   void Record(uint64_t value, const opentelemetry::context::Context &context) noexcept override;
+
+  BoundLongHistogram Bind(const opentelemetry::common::KeyValueIterable &attributes) noexcept;
 };
 
 class DoubleHistogram : public Synchronous, public opentelemetry::metrics::Histogram<double>
@@ -138,6 +215,8 @@ class DoubleHistogram : public Synchronous, public opentelemetry::metrics::Histo
               const opentelemetry::context::Context &context) noexcept override;
 
   void Record(double value, const opentelemetry::context::Context &context) noexcept override;
+
+  BoundDoubleHistogram Bind(const opentelemetry::common::KeyValueIterable &attributes) noexcept;
 };
 
 }  // namespace metrics
@@ -49,6 +49,14 @@ class OPENTELEMETRY_EXPORT ViewFactory
                                       AggregationType aggregation_type,
                                       std::shared_ptr<AggregationConfig> aggregation_config,
                                       std::unique_ptr<AttributesProcessor> attributes_processor);
+
+  static std::unique_ptr<View> Create(const std::string &name,
+                                      const std::string &description,
+                                      const std::string &unit,
+                                      AggregationType aggregation_type,
+                                      std::shared_ptr<AggregationConfig> aggregation_config,
+                                      std::unique_ptr<AttributesProcessor> attributes_processor,
+                                      size_t storage_shard_count);
 };
 
 }  // namespace metrics
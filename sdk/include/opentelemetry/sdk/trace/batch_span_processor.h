@@ -8,6 +8,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "opentelemetry/sdk/common/circular_buffer.h"
 #include "opentelemetry/sdk/trace/processor.h"
@@ -107,6 +108,27 @@ class BatchSpanProcessor : public SpanProcessor
    */
   void DrainQueue();
 
+  /**
+   * Returns the shard of the queue the calling thread adds its spans to.
+   */
+  opentelemetry::sdk::common::CircularBuffer<Recordable> &GetShard() noexcept;
+
+  opentelemetry::sdk::common::CircularBuffer<Recordable> &GetShard(size_t index) noexcept
+  {
+    return index == 0 ? buffer_ : *additional_shards_[index - 1];
+  }
+
+  /**
+   * Returns the number of spans in all the shards of the queue.
+   */
+  size_t GetQueueSize() const noexcept;
+
+  /**
+   * Moves up to max_spans spans from the shards of the queue to spans, taking them from the
+   * shards in round-robin order. This method must only be called from the worker thread.
+   */
+  void ConsumeSpans(size_t max_spans, std::vector<std::unique_ptr<Recordable>> &spans) noexcept;
+
   struct SynchronizationData
   {
     /* Synchronization primitives */
@@ -119,6 +141,9 @@ class BatchSpanProcessor : public SpanProcessor
     std::atomic<bool> is_force_flush_notified{false};
     std::atomic<std::chrono::microseconds::rep> force_flush_timeout_us{0};
     std::atomic<bool> is_shutdown{false};
+    /* Set by the first thread notifying the worker thread when the queue is sharded, so that the
+     * next threads do not notify it again until it wakes up */
+    std::atomic<bool> is_background_worker_notified{false};
   };
 
   /**
@@ -142,9 +167,21 @@ class BatchSpanProcessor : public SpanProcessor
   const std::chrono::milliseconds schedule_delay_millis_;
   const size_t max_export_batch_size_;
 
-  /* The buffer/queue to which the ended spans are added */
+  /* The number of shards of the queue, and the spans each of them holds before notifying the
+   * worker thread */
+  const size_t shard_count_;
+  const size_t shard_notify_size_;
+
+  /* The buffer/queue to which the ended spans are added, which is the first shard of the queue */
   opentelemetry::sdk::common::CircularBuffer<Recordable> buffer_;
 
+  /* The other shards of the queue, if any */
+  std::vector<std::unique_ptr<opentelemetry::sdk::common::CircularBuffer<Recordable>>>
+      additional_shards_;
+
+  /* The shard the worker thread consumes first in the next batch */
+  size_t next_consumed_shard_ = 0;
+
   std::shared_ptr<SynchronizationData> synchronization_data_;
 
   /* The background worker thread */
@@ -33,6 +33,14 @@ struct BatchSpanProcessorOptions
    * equal to max_queue_size.
    */
   size_t max_export_batch_size = 512;
+
+  /**
+   * The number of shards the queue is split into. Threads ending spans are spread over the shards,
+   * each holding an equal part of max_queue_size, so that they do not all contend on the same
+   * queue. The worker thread drains the shards in round-robin order. A value of 0 or 1 keeps a
+   * single queue.
+   */
+  size_t queue_shard_count = 1;
 };
 
 }  // namespace trace
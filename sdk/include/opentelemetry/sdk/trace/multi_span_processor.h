@@ -10,6 +10,8 @@
 
 #include "opentelemetry/sdk/trace/multi_recordable.h"
 #include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/shared_span_data.h"
+#include "opentelemetry/sdk/trace/span_data.h"
 #include "opentelemetry/version.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -20,7 +22,17 @@ namespace trace
 
 /** Instantiation options. */
 struct MultiSpanProcessorOptions
-{};
+{
+  /**
+   * Record each span once into a SpanData shared by all the processors, instead of into one
+   * recordable per processor.
+   *
+   * The processors receive that SpanData in OnStart, and a SharedSpanData in OnEnd.
+   * SimpleSpanProcessor and BatchSpanProcessor convert it into a recordable of their exporter when
+   * they export it, other processors must handle SharedSpanData recordables themselves.
+   */
+  bool share_span_data = false;
+};
 
 /**
  * Span processor allow hooks for span start and end method invocations.
@@ -31,8 +43,9 @@ struct MultiSpanProcessorOptions
 class MultiSpanProcessor : public SpanProcessor
 {
 public:
-  MultiSpanProcessor(std::vector<std::unique_ptr<SpanProcessor>> &&processors)
-      : head_(nullptr), tail_(nullptr), count_(0)
+  MultiSpanProcessor(std::vector<std::unique_ptr<SpanProcessor>> &&processors,
+                     const MultiSpanProcessorOptions &options = MultiSpanProcessorOptions())
+      : head_(nullptr), tail_(nullptr), count_(0), share_span_data_(options.share_span_data)
   {
     for (auto &processor : processors)
     {
@@ -61,6 +74,10 @@ class MultiSpanProcessor : public SpanProcessor
 
   std::unique_ptr<Recordable> MakeRecordable() noexcept override
   {
+    if (share_span_data_)
+    {
+      return std::unique_ptr<Recordable>(new SpanData);
+    }
     auto recordable       = std::unique_ptr<Recordable>(new MultiRecordable);
     auto multi_recordable = static_cast<MultiRecordable *>(recordable.get());
     ProcessorNode *node   = head_;
@@ -76,6 +93,16 @@ class MultiSpanProcessor : public SpanProcessor
   virtual void OnStart(Recordable &span,
                        const opentelemetry::trace::SpanContext &parent_context) noexcept override
   {
+    if (share_span_data_)
+    {
+      ProcessorNode *node = head_;
+      while (node != nullptr)
+      {
+        node->value_->OnStart(span, parent_context);
+        node = node->next_;
+      }
+      return;
+    }
     auto multi_recordable = static_cast<MultiRecordable *>(&span);
     ProcessorNode *node   = head_;
     while (node != nullptr)
@@ -92,6 +119,17 @@ class MultiSpanProcessor : public SpanProcessor
 
   virtual void OnEnd(std::unique_ptr<Recordable> &&span) noexcept override
   {
+    if (share_span_data_)
+    {
+      std::shared_ptr<const SpanData> span_data(static_cast<SpanData *>(span.release()));
+      ProcessorNode *node = head_;
+      while (node != nullptr)
+      {
+        node->value_->OnEnd(std::unique_ptr<Recordable>(new SharedSpanData(span_data)));
+        node = node->next_;
+      }
+      return;
+    }
     auto multi_recordable = static_cast<MultiRecordable *>(span.release());
     ProcessorNode *node   = head_;
     while (node != nullptr)
@@ -182,6 +220,7 @@ class MultiSpanProcessor : public SpanProcessor
 
   ProcessorNode *head_, *tail_;
   size_t count_;
+  bool share_span_data_;
 };
 }  // namespace trace
 }  // namespace sdk
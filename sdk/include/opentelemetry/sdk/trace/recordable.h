@@ -34,6 +34,7 @@ namespace trace
 {
 
 using namespace opentelemetry::sdk::instrumentationscope;
+class SharedSpanData;
 class SpanData;
 
 /**
@@ -167,6 +168,13 @@ class Recordable
 
   virtual explicit operator SpanData *() const { return nullptr; }
 
+  /**
+   * Get the SharedSpanData object for this Recordable.
+   *
+   * @return this if the recordable is a SharedSpanData, nullptr otherwise
+   */
+  virtual const SharedSpanData *GetSharedSpanData() const noexcept { return nullptr; }
+
   /**
    * Set the instrumentation scope of the span.
    * @param instrumentation_scope the instrumentation scope to set
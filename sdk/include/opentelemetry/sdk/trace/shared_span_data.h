@@ -0,0 +1,98 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+
+#include "opentelemetry/sdk/trace/exporter.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+/**
+ * A recordable sharing the SpanData of an ended span with other recordables.
+ *
+ * A MultiSpanProcessor created with MultiSpanProcessorOptions::share_span_data records each span
+ * once, and passes one SharedSpanData per processor to OnEnd. The span data is converted into the
+ * recordable of an exporter only when the span is exported, see Convert.
+ *
+ * The span data is immutable, the Recordable setters do nothing.
+ */
+class SharedSpanData final : public Recordable
+{
+public:
+  explicit SharedSpanData(std::shared_ptr<const SpanData> span_data) noexcept
+      : span_data_(std::move(span_data))
+  {}
+
+  /**
+   * Get the shared span data.
+   */
+  const SpanData &GetSpanData() const noexcept { return *span_data_; }
+
+  /**
+   * Record the shared span data into the given recordable.
+   * @param recordable the recordable to record the span data into
+   */
+  void CopyTo(Recordable &recordable) const noexcept;
+
+  /**
+   * Replace the given recordable by a recordable made by the exporter, if it is a SharedSpanData.
+   * Span processors call this before passing spans to their exporter.
+   * @param recordable the recordable to convert
+   * @param exporter the exporter the recordable is exported to
+   */
+  static void Convert(std::unique_ptr<Recordable> &recordable, SpanExporter &exporter) noexcept;
+
+  const SharedSpanData *GetSharedSpanData() const noexcept override { return this; }
+
+  void SetIdentity(const opentelemetry::trace::SpanContext & /* span_context */,
+                   opentelemetry::trace::SpanId /* parent_span_id */) noexcept override
+  {}
+
+  void SetAttribute(nostd::string_view /* key */,
+                    const opentelemetry::common::AttributeValue & /* value */) noexcept override
+  {}
+
+  void AddEvent(nostd::string_view /* name */,
+                opentelemetry::common::SystemTimestamp /* timestamp */,
+                const opentelemetry::common::KeyValueIterable & /* attributes */) noexcept override
+  {}
+
+  void AddLink(const opentelemetry::trace::SpanContext & /* span_context */,
+               const opentelemetry::common::KeyValueIterable & /* attributes */) noexcept override
+  {}
+
+  void SetStatus(opentelemetry::trace::StatusCode /* code */,
+                 nostd::string_view /* description */) noexcept override
+  {}
+
+  void SetName(nostd::string_view /* name */) noexcept override {}
+
+  void SetSpanKind(opentelemetry::trace::SpanKind /* span_kind */) noexcept override {}
+
+  void SetResource(const opentelemetry::sdk::resource::Resource & /* resource */) noexcept override
+  {}
+
+  void SetStartTime(opentelemetry::common::SystemTimestamp /* start_time */) noexcept override {}
+
+  void SetDuration(std::chrono::nanoseconds /* duration */) noexcept override {}
+
+  void SetInstrumentationScope(
+      const InstrumentationScope & /* instrumentation_scope */) noexcept override
+  {}
+
+private:
+  std::shared_ptr<const SpanData> span_data_;
+};
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -13,6 +13,7 @@
 #include "opentelemetry/sdk/trace/exporter.h"
 #include "opentelemetry/sdk/trace/processor.h"
 #include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/sdk/trace/shared_span_data.h"
 #include "opentelemetry/version.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -51,6 +52,7 @@ class SimpleSpanProcessor : public SpanProcessor
 
   void OnEnd(std::unique_ptr<Recordable> &&span) noexcept override
   {
+    SharedSpanData::Convert(span, *exporter_);
     nostd::span<std::unique_ptr<Recordable>> batch(&span, 1);
     const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
     if (exporter_->Export(batch) == sdk::common::ExportResult::kFailure)
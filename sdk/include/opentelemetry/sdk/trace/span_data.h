@@ -62,6 +62,9 @@ class SpanDataEvent
   }
 
 private:
+  // reuses the event on SpanData::Reset()
+  friend class SpanData;
+
   std::string name_;
   opentelemetry::common::SystemTimestamp timestamp_;
   opentelemetry::sdk::common::AttributeMap attribute_map_;
@@ -95,6 +98,9 @@ class SpanDataLink
   const opentelemetry::trace::SpanContext &GetSpanContext() const noexcept { return span_context_; }
 
 private:
+  // reuses the link on SpanData::Reset()
+  friend class SpanData;
+
   opentelemetry::trace::SpanContext span_context_;
   opentelemetry::sdk::common::AttributeMap attribute_map_;
 };
@@ -240,7 +246,7 @@ class SpanData final : public Recordable
   void SetAttribute(nostd::string_view key,
                     const opentelemetry::common::AttributeValue &value) noexcept override
   {
-    attribute_map_.SetAttribute(key, value);
+    SetAttribute(attribute_map_, key, value);
   }
 
   void AddEvent(nostd::string_view name,
@@ -250,15 +256,34 @@ class SpanData final : public Recordable
                     opentelemetry::common::KeyValueIterableView<std::map<std::string, int>>(
                         {})) noexcept override
   {
-    SpanDataEvent event(std::string(name), timestamp, attributes);
-    events_.push_back(event);
+    if (spare_events_.empty())
+    {
+      SpanDataEvent event(std::string(name), timestamp, attributes);
+      events_.push_back(event);
+      return;
+    }
+    events_.push_back(std::move(spare_events_.back()));
+    spare_events_.pop_back();
+    SpanDataEvent &event = events_.back();
+    event.name_.assign(name.data(), name.size());
+    event.timestamp_ = timestamp;
+    SetAttributes(event.attribute_map_, attributes);
   }
 
   void AddLink(const opentelemetry::trace::SpanContext &span_context,
                const opentelemetry::common::KeyValueIterable &attributes) noexcept override
   {
-    SpanDataLink link(span_context, attributes);
-    links_.push_back(link);
+    if (spare_links_.empty())
+    {
+      SpanDataLink link(span_context, attributes);
+      links_.push_back(link);
+      return;
+    }
+    links_.push_back(std::move(spare_links_.back()));
+    spare_links_.pop_back();
+    SpanDataLink &link = links_.back();
+    link.span_context_ = span_context;
+    SetAttributes(link.attribute_map_, attributes);
   }
 
   void SetStatus(opentelemetry::trace::StatusCode code,
@@ -295,7 +320,59 @@ class SpanData final : public Recordable
     instrumentation_scope_ = &instrumentation_scope;
   }
 
+  /**
+   * Reset all the data of this span, keeping the memory allocated for its name, status
+   * description, attributes, events and links, so that it can be reused for another span.
+   *
+   * The events and links are kept with their name and attribute buckets, to be reused by the next
+   * AddEvent() and AddLink() calls. When the standard library the SDK is built with supports node
+   * extraction, the attribute nodes are kept as well, one per distinct key, for the next
+   * attributes set.
+   */
+  void Reset() noexcept
+  {
+    span_context_   = opentelemetry::trace::SpanContext{false, false};
+    parent_span_id_ = opentelemetry::trace::SpanId();
+    start_time_     = opentelemetry::common::SystemTimestamp();
+    duration_       = std::chrono::nanoseconds{0};
+    name_.clear();
+    status_code_ = opentelemetry::trace::StatusCode::kUnset;
+    status_desc_.clear();
+    ClearAttributes(attribute_map_);
+    for (auto &event : events_)
+    {
+      ClearAttributes(event.attribute_map_);
+      spare_events_.push_back(std::move(event));
+    }
+    events_.clear();
+    for (auto &link : links_)
+    {
+      ClearAttributes(link.attribute_map_);
+      spare_links_.push_back(std::move(link));
+    }
+    links_.clear();
+    span_kind_             = opentelemetry::trace::SpanKind::kInternal;
+    resource_              = nullptr;
+    instrumentation_scope_ = nullptr;
+  }
+
 private:
+  void SetAttribute(opentelemetry::sdk::common::AttributeMap &attributes,
+                    nostd::string_view key,
+                    const opentelemetry::common::AttributeValue &value) noexcept;
+
+  void SetAttributes(opentelemetry::sdk::common::AttributeMap &attributes,
+                     const opentelemetry::common::KeyValueIterable &values) noexcept
+  {
+    values.ForEachKeyValue(
+        [&](nostd::string_view key, opentelemetry::common::AttributeValue value) noexcept {
+          SetAttribute(attributes, key, value);
+          return true;
+        });
+  }
+
+  void ClearAttributes(opentelemetry::sdk::common::AttributeMap &attributes) noexcept;
+
   opentelemetry::trace::SpanContext span_context_{false, false};
   opentelemetry::trace::SpanId parent_span_id_;
   opentelemetry::common::SystemTimestamp start_time_;
@@ -309,6 +386,10 @@ class SpanData final : public Recordable
   opentelemetry::trace::SpanKind span_kind_{opentelemetry::trace::SpanKind::kInternal};
   const opentelemetry::sdk::resource::Resource *resource_;
   const InstrumentationScope *instrumentation_scope_;
+  // storage kept by Reset() for the next span
+  std::vector<SpanDataEvent> spare_events_;
+  std::vector<SpanDataLink> spare_links_;
+  opentelemetry::sdk::common::AttributeMap spare_attributes_;
 };
 }  // namespace trace
 }  // namespace sdk
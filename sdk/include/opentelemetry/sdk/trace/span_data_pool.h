@@ -0,0 +1,65 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+/**
+ * A pool of SpanData recordables, for exporters which make SpanData recordables and do not keep
+ * them after export.
+ *
+ * The exporter makes its recordables from the pool, and recycles each exported batch back into
+ * it. Recycled recordables are reset, but keep the memory allocated for their strings,
+ * attributes, events and links, so that spans ended at a steady rate do not allocate a new
+ * recordable once the pool is warm.
+ */
+class SpanDataPool
+{
+public:
+  /**
+   * @param max_size The maximum number of recordables kept in the pool. Recordables recycled
+   * while the pool is full are released.
+   */
+  explicit SpanDataPool(size_t max_size = 2048) noexcept;
+
+  /**
+   * Returns a recycled recordable from the pool, or a new one if the pool is empty.
+   */
+  std::unique_ptr<Recordable> MakeRecordable() noexcept;
+
+  /**
+   * Reset the given recordables and move them back into the pool. Recordables which were
+   * released by the exporter are skipped.
+   *
+   * NOTE: The recordables must have been made by MakeRecordable().
+   */
+  void Recycle(const nostd::span<std::unique_ptr<Recordable>> &recordables) noexcept;
+
+  /**
+   * Returns the number of recordables in the pool.
+   */
+  size_t GetSize() noexcept;
+
+private:
+  const size_t max_size_;
+  opentelemetry::common::SpinLockMutex lock_;
+  std::vector<std::unique_ptr<SpanData>> free_recordables_;
+};
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -54,6 +54,9 @@ class Tracer final : public opentelemetry::trace::Tracer,
   /** Returns the configured Id generator */
   IdGenerator &GetIdGenerator() const noexcept { return context_->GetIdGenerator(); }
 
+  /** Returns whether the spans started by this tracer are guarded by a spin lock */
+  bool GetSpanSpinLock() const noexcept { return context_->GetSpanSpinLock(); }
+
   /** Returns the associated instrumentation scope */
   const InstrumentationScope &GetInstrumentationScope() const noexcept
   {
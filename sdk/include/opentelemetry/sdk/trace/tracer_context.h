@@ -35,13 +35,21 @@ namespace trace
 class TracerContext
 {
 public:
+  /**
+   * @param span_spin_lock whether to guard the spans started from this context with a spin lock
+   * instead of a std::mutex. The spin lock is cheaper to take and smaller than a std::mutex when a
+   * span is only modified by the thread that started it, which is the common case. Spans modified
+   * concurrently by several threads, or ended while a slow processor exports synchronously, are
+   * better served by the default std::mutex.
+   */
   explicit TracerContext(
       std::vector<std::unique_ptr<SpanProcessor>> &&processor,
       opentelemetry::sdk::resource::Resource resource =
           opentelemetry::sdk::resource::Resource::Create({}),
       std::unique_ptr<Sampler> sampler = std::unique_ptr<AlwaysOnSampler>(new AlwaysOnSampler),
       std::unique_ptr<IdGenerator> id_generator =
-          std::unique_ptr<IdGenerator>(new RandomIdGenerator())) noexcept;
+          std::unique_ptr<IdGenerator>(new RandomIdGenerator()),
+      bool span_spin_lock = false) noexcept;
 
   virtual ~TracerContext() = default;
 
@@ -81,6 +89,11 @@ class TracerContext
    */
   opentelemetry::sdk::trace::IdGenerator &GetIdGenerator() const noexcept;
 
+  /**
+   * @return whether the spans started from this context are guarded by a spin lock.
+   */
+  bool GetSpanSpinLock() const noexcept;
+
   /**
    * Force all active SpanProcessors to flush any buffered spans
    * within the given timeout.
@@ -98,6 +111,7 @@ class TracerContext
   std::unique_ptr<Sampler> sampler_;
   std::unique_ptr<IdGenerator> id_generator_;
   std::unique_ptr<SpanProcessor> processor_;
+  const bool span_spin_lock_;
 };
 
 }  // namespace trace
@@ -38,6 +38,8 @@ class TracerProvider final : public opentelemetry::trace::TracerProvider
    * not be a nullptr.
    * @param id_generator The custom id generator for this tracer provider. This must
    * not be a nullptr
+   * @param span_spin_lock Whether to guard the spans with a spin lock instead of a std::mutex.
+   * See @ref TracerContext.
    */
   explicit TracerProvider(
       std::unique_ptr<SpanProcessor> processor,
@@ -45,7 +47,8 @@ class TracerProvider final : public opentelemetry::trace::TracerProvider
           opentelemetry::sdk::resource::Resource::Create({}),
       std::unique_ptr<Sampler> sampler = std::unique_ptr<AlwaysOnSampler>(new AlwaysOnSampler),
       std::unique_ptr<IdGenerator> id_generator =
-          std::unique_ptr<IdGenerator>(new RandomIdGenerator())) noexcept;
+          std::unique_ptr<IdGenerator>(new RandomIdGenerator()),
+      bool span_spin_lock = false) noexcept;
 
   explicit TracerProvider(
       std::vector<std::unique_ptr<SpanProcessor>> &&processors,
@@ -53,7 +56,8 @@ class TracerProvider final : public opentelemetry::trace::TracerProvider
           opentelemetry::sdk::resource::Resource::Create({}),
       std::unique_ptr<Sampler> sampler = std::unique_ptr<AlwaysOnSampler>(new AlwaysOnSampler),
       std::unique_ptr<IdGenerator> id_generator =
-          std::unique_ptr<IdGenerator>(new RandomIdGenerator())) noexcept;
+          std::unique_ptr<IdGenerator>(new RandomIdGenerator()),
+      bool span_spin_lock = false) noexcept;
 
   /**
    * Initialize a new tracer provider with a specified context
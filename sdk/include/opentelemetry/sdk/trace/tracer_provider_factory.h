@@ -55,6 +55,13 @@ class OPENTELEMETRY_EXPORT TracerProviderFactory
       std::unique_ptr<Sampler> sampler,
       std::unique_ptr<IdGenerator> id_generator);
 
+  static std::unique_ptr<opentelemetry::trace::TracerProvider> Create(
+      std::unique_ptr<SpanProcessor> processor,
+      const opentelemetry::sdk::resource::Resource &resource,
+      std::unique_ptr<Sampler> sampler,
+      std::unique_ptr<IdGenerator> id_generator,
+      bool span_spin_lock);
+
   /* Serie of builders with a vector of processor. */
 
   static std::unique_ptr<opentelemetry::trace::TracerProvider> Create(
@@ -75,6 +82,13 @@ class OPENTELEMETRY_EXPORT TracerProviderFactory
       std::unique_ptr<Sampler> sampler,
       std::unique_ptr<IdGenerator> id_generator);
 
+  static std::unique_ptr<opentelemetry::trace::TracerProvider> Create(
+      std::vector<std::unique_ptr<SpanProcessor>> &&processors,
+      const opentelemetry::sdk::resource::Resource &resource,
+      std::unique_ptr<Sampler> sampler,
+      std::unique_ptr<IdGenerator> id_generator,
+      bool span_spin_lock);
+
   /* Create with a tracer context. */
 
   static std::unique_ptr<opentelemetry::trace::TracerProvider> Create(
@@ -0,0 +1,360 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/version.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+namespace
+{
+
+// Scale limits as defined by the specification. At the minimum scale, the normal doubles fall into
+// buckets -1 and 0, and the subnormal doubles below 2^-1024 into bucket -2. Any double therefore
+// fits into three buckets, so the number of buckets is never allowed to be lower than that.
+constexpr int32_t kMinScale      = -10;
+constexpr int32_t kMaxScale      = 20;
+constexpr size_t kMinMaxBuckets  = 3;
+constexpr size_t kDefaultBuckets = 160;
+
+size_t GetMaxBuckets(const Base2ExponentialHistogramAggregationConfig *config)
+{
+  return config ? (std::max)(config->max_buckets_, kMinMaxBuckets) : kDefaultBuckets;
+}
+
+int32_t GetMaxScale(const Base2ExponentialHistogramAggregationConfig *config)
+{
+  return config ? (std::min)((std::max)(config->max_scale_, kMinScale), kMaxScale) : kMaxScale;
+}
+
+// Returns by how much the scale needs to be reduced, for the bucket indexes in the range
+// [start_index, end_index] to fit into max_buckets buckets.
+int32_t GetScaleReduction(int32_t start_index, int32_t end_index, size_t max_buckets)
+{
+  int32_t scale_reduction = 0;
+  while (static_cast<size_t>(static_cast<int64_t>(end_index) - start_index) + 1 > max_buckets)
+  {
+    start_index >>= 1;
+    end_index >>= 1;
+    scale_reduction++;
+  }
+  return scale_reduction;
+}
+
+// Extends [start_index, end_index] with the range of the buckets, downscaled by the given
+// amount. Returns false if the buckets are empty.
+bool ExtendIndexRange(const ExponentialHistogramBuckets &buckets,
+                      int32_t scale_reduction,
+                      bool has_range,
+                      int32_t &start_index,
+                      int32_t &end_index)
+{
+  if (buckets.counts_.empty())
+  {
+    return has_range;
+  }
+  int32_t start = buckets.offset_ >> scale_reduction;
+  int32_t end =
+      (buckets.offset_ + static_cast<int32_t>(buckets.counts_.size()) - 1) >> scale_reduction;
+  start_index = has_range ? (std::min)(start_index, start) : start;
+  end_index   = has_range ? (std::max)(end_index, end) : end;
+  return true;
+}
+
+// Adds (or subtracts) the buckets, downscaled by the given amount, into counts whose first
+// element holds the bucket at start_index.
+void AccumulateBuckets(const ExponentialHistogramBuckets &buckets,
+                       int32_t scale_reduction,
+                       int32_t start_index,
+                       bool subtract,
+                       std::vector<uint64_t> &counts)
+{
+  for (size_t i = 0; i < buckets.counts_.size(); i++)
+  {
+    int32_t index = (buckets.offset_ + static_cast<int32_t>(i)) >> scale_reduction;
+    uint64_t &count = counts[static_cast<size_t>(index - start_index)];
+    if (subtract)
+    {
+      count = count >= buckets.counts_[i] ? count - buckets.counts_[i] : 0;
+    }
+    else
+    {
+      count += buckets.counts_[i];
+    }
+  }
+}
+
+// Combines the buckets of both sides, downscaled by their respective amounts, into buckets
+// without leading or trailing empty buckets.
+ExponentialHistogramBuckets CombineBuckets(const ExponentialHistogramBuckets &left,
+                                           int32_t left_scale_reduction,
+                                           const ExponentialHistogramBuckets &right,
+                                           int32_t right_scale_reduction,
+                                           bool subtract)
+{
+  ExponentialHistogramBuckets result;
+  int32_t start_index = 0;
+  int32_t end_index   = 0;
+  bool has_range = ExtendIndexRange(left, left_scale_reduction, false, start_index, end_index);
+  has_range = ExtendIndexRange(right, right_scale_reduction, has_range, start_index, end_index);
+  if (!has_range)
+  {
+    return result;
+  }
+
+  std::vector<uint64_t> counts(static_cast<size_t>(end_index - start_index) + 1, 0);
+  AccumulateBuckets(left, left_scale_reduction, start_index, false, counts);
+  AccumulateBuckets(right, right_scale_reduction, start_index, subtract, counts);
+
+  auto first = std::find_if(counts.begin(), counts.end(), [](uint64_t c) { return c != 0; });
+  if (first == counts.end())
+  {
+    return result;
+  }
+  auto last =
+      std::find_if(counts.rbegin(), counts.rend(), [](uint64_t c) { return c != 0; }).base();
+  result.offset_ = start_index + static_cast<int32_t>(first - counts.begin());
+  result.counts_.assign(first, last);
+  return result;
+}
+
+// Combines the positive and negative buckets of both points into the result, at the lowest
+// scale of both points, reduced further if needed to fit into result.max_buckets_.
+void CombinePointBuckets(const ExponentialHistogramPointData &left,
+                         const ExponentialHistogramPointData &right,
+                         bool subtract,
+                         ExponentialHistogramPointData &result)
+{
+  int32_t scale           = (std::min)(left.scale_, right.scale_);
+  int32_t scale_reduction = 0;
+  for (auto buckets : {&ExponentialHistogramPointData::positive_buckets_,
+                       &ExponentialHistogramPointData::negative_buckets_})
+  {
+    int32_t start_index = 0;
+    int32_t end_index   = 0;
+    bool has_range =
+        ExtendIndexRange(left.*buckets, left.scale_ - scale, false, start_index, end_index);
+    has_range =
+        ExtendIndexRange(right.*buckets, right.scale_ - scale, has_range, start_index, end_index);
+    if (has_range)
+    {
+      scale_reduction = (std::max)(
+          scale_reduction, GetScaleReduction(start_index, end_index, result.max_buckets_));
+    }
+  }
+  result.scale_            = scale - scale_reduction;
+  result.positive_buckets_ = CombineBuckets(left.positive_buckets_, left.scale_ - result.scale_,
+                                            right.positive_buckets_, right.scale_ - result.scale_,
+                                            subtract);
+  result.negative_buckets_ = CombineBuckets(left.negative_buckets_, left.scale_ - result.scale_,
+                                            right.negative_buckets_, right.scale_ - result.scale_,
+                                            subtract);
+}
+
+ExponentialHistogramBuckets ToBuckets(const AdaptingCircularBufferCounter &counter)
+{
+  ExponentialHistogramBuckets buckets;
+  if (counter.Empty())
+  {
+    return buckets;
+  }
+  buckets.offset_ = counter.StartIndex();
+  buckets.counts_.reserve(static_cast<size_t>(counter.EndIndex() - counter.StartIndex()) + 1);
+  for (int32_t i = counter.StartIndex(); i <= counter.EndIndex(); i++)
+  {
+    buckets.counts_.push_back(counter.Get(i));
+  }
+  return buckets;
+}
+
+void FromBuckets(const ExponentialHistogramBuckets &buckets,
+                 AdaptingCircularBufferCounter &counter)
+{
+  for (size_t i = 0; i < buckets.counts_.size(); i++)
+  {
+    if (buckets.counts_[i])
+    {
+      counter.Increment(buckets.offset_ + static_cast<int32_t>(i), buckets.counts_[i]);
+    }
+  }
+}
+
+}  // namespace
+
+Base2ExponentialHistogramAggregation::Base2ExponentialHistogramAggregation(
+    const AggregationConfig *aggregation_config)
+    : indexer_(GetMaxScale(
+          static_cast<const Base2ExponentialHistogramAggregationConfig *>(aggregation_config))),
+      positive_buckets_(GetMaxBuckets(
+          static_cast<const Base2ExponentialHistogramAggregationConfig *>(aggregation_config))),
+      negative_buckets_(positive_buckets_.MaxSize())
+{
+  auto ac = static_cast<const Base2ExponentialHistogramAggregationConfig *>(aggregation_config);
+  if (ac)
+  {
+    point_data_.record_min_max_ = ac->record_min_max_;
+  }
+  point_data_.max_buckets_ = positive_buckets_.MaxSize();
+  point_data_.scale_       = GetMaxScale(ac);
+  point_data_.min_         = (std::numeric_limits<double>::max)();
+  point_data_.max_         = (std::numeric_limits<double>::lowest)();
+}
+
+Base2ExponentialHistogramAggregation::Base2ExponentialHistogramAggregation(
+    const ExponentialHistogramPointData &point_data)
+    : point_data_{point_data},
+      indexer_(point_data.scale_),
+      positive_buckets_((std::max)(point_data.max_buckets_, kMinMaxBuckets)),
+      negative_buckets_(positive_buckets_.MaxSize())
+{
+  FromBuckets(point_data_.positive_buckets_, positive_buckets_);
+  FromBuckets(point_data_.negative_buckets_, negative_buckets_);
+  point_data_.positive_buckets_ = {};
+  point_data_.negative_buckets_ = {};
+  point_data_.max_buckets_      = positive_buckets_.MaxSize();
+}
+
+void Base2ExponentialHistogramAggregation::Aggregate(int64_t value,
+                                                     const PointAttributes &attributes) noexcept
+{
+  Aggregate(static_cast<double>(value), attributes);
+}
+
+void Base2ExponentialHistogramAggregation::Aggregate(
+    double value,
+    const PointAttributes & /* attributes */) noexcept
+{
+  if (!std::isfinite(value))
+  {
+    return;
+  }
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.count_ += 1;
+  point_data_.sum_ += value;
+  if (point_data_.record_min_max_)
+  {
+    point_data_.min_ = (std::min)(point_data_.min_, value);
+    point_data_.max_ = (std::max)(point_data_.max_, value);
+  }
+  if (value == 0)
+  {
+    point_data_.zero_count_ += 1;
+  }
+  else if (value > 0)
+  {
+    AggregateIntoBuckets(positive_buckets_, value);
+  }
+  else
+  {
+    AggregateIntoBuckets(negative_buckets_, value);
+  }
+}
+
+void Base2ExponentialHistogramAggregation::AggregateIntoBuckets(
+    AdaptingCircularBufferCounter &buckets,
+    double value) noexcept
+{
+  int32_t index = indexer_.ComputeIndex(value);
+  if (buckets.Increment(index, 1))
+  {
+    return;
+  }
+  // The value does not fit into the buckets at the current scale, reduce the scale until the
+  // buckets span the index of the value.
+  int32_t start_index = (std::min)(buckets.StartIndex(), index);
+  int32_t end_index   = (std::max)(buckets.EndIndex(), index);
+  Downscale(GetScaleReduction(start_index, end_index, point_data_.max_buckets_));
+  buckets.Increment(indexer_.ComputeIndex(value), 1);
+}
+
+void Base2ExponentialHistogramAggregation::Downscale(int32_t by) noexcept
+{
+  if (by <= 0)
+  {
+    return;
+  }
+  for (auto buckets : {&positive_buckets_, &negative_buckets_})
+  {
+    if (buckets->Empty())
+    {
+      continue;
+    }
+    AdaptingCircularBufferCounter downscaled(buckets->MaxSize());
+    for (int32_t i = buckets->StartIndex(); i <= buckets->EndIndex(); i++)
+    {
+      uint64_t count = buckets->Get(i);
+      if (count)
+      {
+        downscaled.Increment(i >> by, count);
+      }
+    }
+    *buckets = std::move(downscaled);
+  }
+  point_data_.scale_ -= by;
+  indexer_ = Base2ExponentialHistogramIndexer(point_data_.scale_);
+}
+
+std::unique_ptr<Aggregation> Base2ExponentialHistogramAggregation::Merge(
+    const Aggregation &delta) const noexcept
+{
+  auto curr_value  = nostd::get<ExponentialHistogramPointData>(ToPoint());
+  auto delta_value = nostd::get<ExponentialHistogramPointData>(
+      (static_cast<const Base2ExponentialHistogramAggregation &>(delta).ToPoint()));
+
+  ExponentialHistogramPointData merge;
+  merge.max_buckets_    = curr_value.max_buckets_;
+  merge.sum_            = curr_value.sum_ + delta_value.sum_;
+  merge.count_          = curr_value.count_ + delta_value.count_;
+  merge.zero_count_     = curr_value.zero_count_ + delta_value.zero_count_;
+  merge.zero_threshold_ = (std::max)(curr_value.zero_threshold_, delta_value.zero_threshold_);
+  merge.record_min_max_ = curr_value.record_min_max_ && delta_value.record_min_max_;
+  if (merge.record_min_max_)
+  {
+    merge.min_ = (std::min)(curr_value.min_, delta_value.min_);
+    merge.max_ = (std::max)(curr_value.max_, delta_value.max_);
+  }
+  CombinePointBuckets(curr_value, delta_value, false, merge);
+  return std::unique_ptr<Aggregation>(new Base2ExponentialHistogramAggregation(merge));
+}
+
+std::unique_ptr<Aggregation> Base2ExponentialHistogramAggregation::Diff(
+    const Aggregation &next) const noexcept
+{
+  auto curr_value = nostd::get<ExponentialHistogramPointData>(ToPoint());
+  auto next_value = nostd::get<ExponentialHistogramPointData>(
+      (static_cast<const Base2ExponentialHistogramAggregation &>(next).ToPoint()));
+
+  ExponentialHistogramPointData diff;
+  diff.max_buckets_    = curr_value.max_buckets_;
+  diff.sum_            = next_value.sum_ - curr_value.sum_;
+  diff.count_          = next_value.count_ - curr_value.count_;
+  diff.zero_count_     = next_value.zero_count_ - curr_value.zero_count_;
+  diff.zero_threshold_ = next_value.zero_threshold_;
+  diff.record_min_max_ = false;
+  CombinePointBuckets(next_value, curr_value, true, diff);
+  return std::unique_ptr<Aggregation>(new Base2ExponentialHistogramAggregation(diff));
+}
+
+PointType Base2ExponentialHistogramAggregation::ToPoint() const noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  ExponentialHistogramPointData point_data{point_data_};
+  point_data.positive_buckets_ = ToBuckets(positive_buckets_);
+  point_data.negative_buckets_ = ToBuckets(negative_buckets_);
+  return point_data;
+}
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -6,10 +6,12 @@
 #include "opentelemetry/version.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <iomanip>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <new>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
@@ -17,6 +19,153 @@ namespace sdk
 namespace metrics
 {
 
+namespace
+{
+
+const std::vector<double> &GetDefaultBoundaries()
+{
+  static const std::vector<double> boundaries = {0.0,    5.0,    10.0,   25.0,   50.0,
+                                                 75.0,   100.0,  250.0,  500.0,  750.0,
+                                                 1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
+  return boundaries;
+}
+
+std::unique_ptr<std::atomic<uint64_t>[]> MakeAtomicCounts(const std::vector<uint64_t> &counts)
+{
+  std::unique_ptr<std::atomic<uint64_t>[]> atomic_counts(new std::atomic<uint64_t>[counts.size()]);
+  for (size_t i = 0; i < counts.size(); i++)
+  {
+    atomic_counts[i].store(counts[i], std::memory_order_relaxed);
+  }
+  return atomic_counts;
+}
+
+std::vector<uint64_t> LoadAtomicCounts(const std::atomic<uint64_t> *atomic_counts, size_t size)
+{
+  std::vector<uint64_t> counts(size);
+  for (size_t i = 0; i < size; i++)
+  {
+    counts[i] = atomic_counts[i].load(std::memory_order_relaxed);
+  }
+  return counts;
+}
+
+template <class T>
+T GetValueOr(const ValueType &value, T default_value)
+{
+  return nostd::holds_alternative<T>(value) ? nostd::get<T>(value) : default_value;
+}
+
+void AtomicAdd(std::atomic<int64_t> &target, int64_t value)
+{
+  target.fetch_add(value, std::memory_order_relaxed);
+}
+
+void AtomicAdd(std::atomic<double> &target, double value)
+{
+  double current = target.load(std::memory_order_relaxed);
+  while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+  {
+  }
+}
+
+template <class T>
+void AtomicMin(std::atomic<T> &target, T value)
+{
+  T current = target.load(std::memory_order_relaxed);
+  while (value < current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+template <class T>
+void AtomicMax(std::atomic<T> &target, T value)
+{
+  T current = target.load(std::memory_order_relaxed);
+  while (value > current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+// Adds a histogram to the point, as HistogramMerge() does, if their buckets and value type match.
+// count_at(i) returns the count of the bucket i of the added histogram.
+template <class T, class CountAt>
+bool AddHistogram(HistogramPointData &point,
+                  size_t size,
+                  CountAt count_at,
+                  uint64_t count,
+                  T sum,
+                  bool record_min_max,
+                  T min,
+                  T max)
+{
+  if (point.counts_.size() != size || !nostd::holds_alternative<T>(point.sum_))
+  {
+    return false;
+  }
+  for (size_t i = 0; i < size; i++)
+  {
+    point.counts_[i] += count_at(i);
+  }
+  point.count_ += count;
+  point.sum_            = nostd::get<T>(point.sum_) + sum;
+  point.record_min_max_ = point.record_min_max_ && record_min_max;
+  if (point.record_min_max_)
+  {
+    point.min_ = (std::min)(nostd::get<T>(point.min_), min);
+    point.max_ = (std::max)(nostd::get<T>(point.max_), max);
+  }
+  return true;
+}
+
+template <class T>
+bool AddHistogram(HistogramPointData &point, const HistogramPointData &delta)
+{
+  return AddHistogram<T>(
+      point, delta.counts_.size(), [&delta](size_t i) { return delta.counts_[i]; }, delta.count_,
+      nostd::get<T>(delta.sum_), delta.record_min_max_, nostd::get<T>(delta.min_),
+      nostd::get<T>(delta.max_));
+}
+
+// Returns a per-thread point with the given buckets and no measurement, whose buckets are reused
+// by the following calls on the thread.
+template <class T>
+HistogramPointData &GetEmptyHistogramPoint(size_t size)
+{
+  static thread_local HistogramPointData point;
+  point.counts_.assign(size, 0);
+  point.count_          = 0;
+  point.sum_            = T{0};
+  point.record_min_max_ = true;
+  point.min_            = (std::numeric_limits<T>::max)();
+  point.max_            = (std::numeric_limits<T>::lowest)();
+  return point;
+}
+
+// Allocates a block aligned on a cache line, preceded by the address of the allocation.
+void *AllocateCacheAligned(std::size_t size)
+{
+  constexpr std::uintptr_t kCacheLineSize = 64;
+  void *block = ::operator new(size + sizeof(void *) + kCacheLineSize - 1);
+  std::uintptr_t address =
+      (reinterpret_cast<std::uintptr_t>(block) + sizeof(void *) + kCacheLineSize - 1) &
+      ~(kCacheLineSize - 1);
+  reinterpret_cast<void **>(address)[-1] = block;
+  return reinterpret_cast<void *>(address);
+}
+
+void FreeCacheAligned(void *ptr) noexcept
+{
+  if (ptr != nullptr)
+  {
+    ::operator delete(static_cast<void **>(ptr)[-1]);
+  }
+}
+
+}  // namespace
+
 LongHistogramAggregation::LongHistogramAggregation(const AggregationConfig *aggregation_config)
 {
   auto ac = static_cast<const HistogramAggregationConfig *>(aggregation_config);
@@ -26,14 +175,14 @@ LongHistogramAggregation::LongHistogramAggregation(const AggregationConfig *aggr
   }
   else
   {
-    point_data_.boundaries_ = {0.0,   5.0,   10.0,   25.0,   50.0,   75.0,   100.0,  250.0,
-                               500.0, 750.0, 1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
+    point_data_.boundaries_ = GetDefaultBoundaries();
   }
 
   if (ac)
   {
     record_min_max_ = ac->record_min_max_;
   }
+  bucket_indexer_             = HistogramBucketIndexer(point_data_.boundaries_);
   point_data_.counts_         = std::vector<uint64_t>(point_data_.boundaries_.size() + 1, 0);
   point_data_.sum_            = (int64_t)0;
   point_data_.count_          = 0;
@@ -43,11 +192,15 @@ LongHistogramAggregation::LongHistogramAggregation(const AggregationConfig *aggr
 }
 
 LongHistogramAggregation::LongHistogramAggregation(HistogramPointData &&data)
-    : point_data_{std::move(data)}, record_min_max_{point_data_.record_min_max_}
+    : point_data_{std::move(data)},
+      record_min_max_{point_data_.record_min_max_},
+      bucket_indexer_{point_data_.boundaries_}
 {}
 
 LongHistogramAggregation::LongHistogramAggregation(const HistogramPointData &data)
-    : point_data_{data}, record_min_max_{point_data_.record_min_max_}
+    : point_data_{data},
+      record_min_max_{point_data_.record_min_max_},
+      bucket_indexer_{point_data_.boundaries_}
 {}
 
 void LongHistogramAggregation::Aggregate(int64_t value,
@@ -61,7 +214,7 @@ void LongHistogramAggregation::Aggregate(int64_t value,
     point_data_.min_ = (std::min)(nostd::get<int64_t>(point_data_.min_), value);
     point_data_.max_ = (std::max)(nostd::get<int64_t>(point_data_.max_), value);
   }
-  size_t index = BucketBinarySearch(value, point_data_.boundaries_);
+  size_t index = bucket_indexer_.ComputeIndex(static_cast<double>(value));
   point_data_.counts_[index] += 1;
 }
 
@@ -79,6 +232,34 @@ std::unique_ptr<Aggregation> LongHistogramAggregation::Merge(
   return std::unique_ptr<Aggregation>(aggr);
 }
 
+bool LongHistogramAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  if (&delta == this)
+  {
+    return false;
+  }
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  return delta.AddToHistogramPoint(point_data_);
+}
+
+bool LongHistogramAggregation::AddToHistogramPoint(HistogramPointData &point) const noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  return AddHistogram<int64_t>(point, point_data_);
+}
+
+bool LongHistogramAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  std::fill(point_data_.counts_.begin(), point_data_.counts_.end(), 0);
+  point_data_.sum_            = (int64_t)0;
+  point_data_.count_          = 0;
+  point_data_.record_min_max_ = record_min_max_;
+  point_data_.min_            = (std::numeric_limits<int64_t>::max)();
+  point_data_.max_            = (std::numeric_limits<int64_t>::min)();
+  return true;
+}
+
 std::unique_ptr<Aggregation> LongHistogramAggregation::Diff(const Aggregation &next) const noexcept
 {
   auto curr_value = nostd::get<HistogramPointData>(ToPoint());
@@ -107,13 +288,13 @@ DoubleHistogramAggregation::DoubleHistogramAggregation(const AggregationConfig *
   }
   else
   {
-    point_data_.boundaries_ = {0.0,   5.0,   10.0,   25.0,   50.0,   75.0,   100.0,  250.0,
-                               500.0, 750.0, 1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
+    point_data_.boundaries_ = GetDefaultBoundaries();
   }
   if (ac)
   {
     record_min_max_ = ac->record_min_max_;
   }
+  bucket_indexer_             = HistogramBucketIndexer(point_data_.boundaries_);
   point_data_.counts_         = std::vector<uint64_t>(point_data_.boundaries_.size() + 1, 0);
   point_data_.sum_            = 0.0;
   point_data_.count_          = 0;
@@ -123,11 +304,11 @@ DoubleHistogramAggregation::DoubleHistogramAggregation(const AggregationConfig *
 }
 
 DoubleHistogramAggregation::DoubleHistogramAggregation(HistogramPointData &&data)
-    : point_data_{std::move(data)}
+    : point_data_{std::move(data)}, bucket_indexer_{point_data_.boundaries_}
 {}
 
 DoubleHistogramAggregation::DoubleHistogramAggregation(const HistogramPointData &data)
-    : point_data_{data}
+    : point_data_{data}, bucket_indexer_{point_data_.boundaries_}
 {}
 
 void DoubleHistogramAggregation::Aggregate(double value,
@@ -141,7 +322,7 @@ void DoubleHistogramAggregation::Aggregate(double value,
     point_data_.min_ = (std::min)(nostd::get<double>(point_data_.min_), value);
     point_data_.max_ = (std::max)(nostd::get<double>(point_data_.max_), value);
   }
-  size_t index = BucketBinarySearch(value, point_data_.boundaries_);
+  size_t index = bucket_indexer_.ComputeIndex(value);
   point_data_.counts_[index] += 1;
 }
 
@@ -159,6 +340,34 @@ std::unique_ptr<Aggregation> DoubleHistogramAggregation::Merge(
   return std::unique_ptr<Aggregation>(aggr);
 }
 
+bool DoubleHistogramAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  if (&delta == this)
+  {
+    return false;
+  }
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  return delta.AddToHistogramPoint(point_data_);
+}
+
+bool DoubleHistogramAggregation::AddToHistogramPoint(HistogramPointData &point) const noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  return AddHistogram<double>(point, point_data_);
+}
+
+bool DoubleHistogramAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  std::fill(point_data_.counts_.begin(), point_data_.counts_.end(), 0);
+  point_data_.sum_            = 0.0;
+  point_data_.count_          = 0;
+  point_data_.record_min_max_ = record_min_max_;
+  point_data_.min_            = (std::numeric_limits<double>::max)();
+  point_data_.max_            = (std::numeric_limits<double>::min)();
+  return true;
+}
+
 std::unique_ptr<Aggregation> DoubleHistogramAggregation::Diff(
     const Aggregation &next) const noexcept
 {
@@ -179,6 +388,296 @@ PointType DoubleHistogramAggregation::ToPoint() const noexcept
   return point_data_;
 }
 
+void *LongAtomicHistogramAggregation::operator new(std::size_t size)
+{
+  return AllocateCacheAligned(size);
+}
+
+void LongAtomicHistogramAggregation::operator delete(void *ptr) noexcept
+{
+  FreeCacheAligned(ptr);
+}
+
+LongAtomicHistogramAggregation::LongAtomicHistogramAggregation(
+    const AggregationConfig *aggregation_config)
+{
+  auto ac = static_cast<const HistogramAggregationConfig *>(aggregation_config);
+  if (ac && ac->boundaries_.size())
+  {
+    boundaries_ = ac->boundaries_;
+  }
+  else
+  {
+    boundaries_ = GetDefaultBoundaries();
+  }
+  if (ac)
+  {
+    record_min_max_ = ac->record_min_max_;
+  }
+  bucket_indexer_ = HistogramBucketIndexer(boundaries_);
+  counts_         = MakeAtomicCounts(std::vector<uint64_t>(boundaries_.size() + 1, 0));
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store((std::numeric_limits<int64_t>::max)(), std::memory_order_relaxed);
+  max_.store((std::numeric_limits<int64_t>::lowest)(), std::memory_order_relaxed);
+}
+
+LongAtomicHistogramAggregation::LongAtomicHistogramAggregation(const HistogramPointData &data)
+    : boundaries_{data.boundaries_},
+      record_min_max_{data.record_min_max_},
+      bucket_indexer_{boundaries_}
+{
+  std::vector<uint64_t> counts = data.counts_;
+  counts.resize(boundaries_.size() + 1, 0);
+  counts_ = MakeAtomicCounts(counts);
+  count_.store(data.count_, std::memory_order_relaxed);
+  sum_.store(GetValueOr<int64_t>(data.sum_, 0), std::memory_order_relaxed);
+  min_.store(GetValueOr<int64_t>(data.min_, (std::numeric_limits<int64_t>::max)()),
+             std::memory_order_relaxed);
+  max_.store(GetValueOr<int64_t>(data.max_, (std::numeric_limits<int64_t>::lowest)()),
+             std::memory_order_relaxed);
+}
+
+void LongAtomicHistogramAggregation::Aggregate(int64_t value,
+                                               const PointAttributes & /* attributes */) noexcept
+{
+  size_t index = bucket_indexer_.ComputeIndex(static_cast<double>(value));
+  counts_[index].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  AtomicAdd(sum_, value);
+  if (record_min_max_)
+  {
+    AtomicMin(min_, value);
+    AtomicMax(max_, value);
+  }
+}
+
+std::unique_ptr<Aggregation> LongAtomicHistogramAggregation::Merge(
+    const Aggregation &delta) const noexcept
+{
+  auto curr_value  = nostd::get<HistogramPointData>(ToPoint());
+  auto delta_value = nostd::get<HistogramPointData>(delta.ToPoint());
+  HistogramPointData merge;
+  merge.counts_.resize(curr_value.counts_.size());
+  HistogramMerge<int64_t>(curr_value, delta_value, merge);
+  return std::unique_ptr<Aggregation>(new LongAtomicHistogramAggregation(merge));
+}
+
+bool LongAtomicHistogramAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  HistogramPointData &delta_value = GetEmptyHistogramPoint<int64_t>(boundaries_.size() + 1);
+  // Min and max can not stop being recorded in place, as measurements may be in flight.
+  if (!delta.AddToHistogramPoint(delta_value) ||
+      (record_min_max_ && !delta_value.record_min_max_))
+  {
+    return false;
+  }
+  for (size_t i = 0; i < delta_value.counts_.size(); i++)
+  {
+    counts_[i].fetch_add(delta_value.counts_[i], std::memory_order_relaxed);
+  }
+  count_.fetch_add(delta_value.count_, std::memory_order_relaxed);
+  AtomicAdd(sum_, nostd::get<int64_t>(delta_value.sum_));
+  if (record_min_max_)
+  {
+    AtomicMin(min_, nostd::get<int64_t>(delta_value.min_));
+    AtomicMax(max_, nostd::get<int64_t>(delta_value.max_));
+  }
+  return true;
+}
+
+bool LongAtomicHistogramAggregation::AddToHistogramPoint(HistogramPointData &point) const noexcept
+{
+  return AddHistogram<int64_t>(
+      point, boundaries_.size() + 1,
+      [this](size_t i) { return counts_[i].load(std::memory_order_relaxed); },
+      count_.load(std::memory_order_relaxed), sum_.load(std::memory_order_relaxed),
+      record_min_max_, min_.load(std::memory_order_relaxed), max_.load(std::memory_order_relaxed));
+}
+
+bool LongAtomicHistogramAggregation::Reset() noexcept
+{
+  for (size_t i = 0; i < boundaries_.size() + 1; i++)
+  {
+    counts_[i].store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store((std::numeric_limits<int64_t>::max)(), std::memory_order_relaxed);
+  max_.store((std::numeric_limits<int64_t>::lowest)(), std::memory_order_relaxed);
+  return true;
+}
+
+std::unique_ptr<Aggregation> LongAtomicHistogramAggregation::Diff(
+    const Aggregation &next) const noexcept
+{
+  auto curr_value = nostd::get<HistogramPointData>(ToPoint());
+  auto next_value = nostd::get<HistogramPointData>(next.ToPoint());
+  HistogramPointData diff;
+  diff.counts_.resize(curr_value.counts_.size());
+  HistogramDiff<int64_t>(curr_value, next_value, diff);
+  diff.sum_ = nostd::get<int64_t>(next_value.sum_) - nostd::get<int64_t>(curr_value.sum_);
+  return std::unique_ptr<Aggregation>(new LongAtomicHistogramAggregation(diff));
+}
+
+PointType LongAtomicHistogramAggregation::ToPoint() const noexcept
+{
+  HistogramPointData point_data;
+  point_data.boundaries_     = boundaries_;
+  point_data.counts_         = LoadAtomicCounts(counts_.get(), boundaries_.size() + 1);
+  point_data.sum_            = sum_.load(std::memory_order_relaxed);
+  point_data.count_          = count_.load(std::memory_order_relaxed);
+  point_data.record_min_max_ = record_min_max_;
+  point_data.min_            = min_.load(std::memory_order_relaxed);
+  point_data.max_            = max_.load(std::memory_order_relaxed);
+  return point_data;
+}
+
+void *DoubleAtomicHistogramAggregation::operator new(std::size_t size)
+{
+  return AllocateCacheAligned(size);
+}
+
+void DoubleAtomicHistogramAggregation::operator delete(void *ptr) noexcept
+{
+  FreeCacheAligned(ptr);
+}
+
+DoubleAtomicHistogramAggregation::DoubleAtomicHistogramAggregation(
+    const AggregationConfig *aggregation_config)
+{
+  auto ac = static_cast<const HistogramAggregationConfig *>(aggregation_config);
+  if (ac && ac->boundaries_.size())
+  {
+    boundaries_ = ac->boundaries_;
+  }
+  else
+  {
+    boundaries_ = GetDefaultBoundaries();
+  }
+  if (ac)
+  {
+    record_min_max_ = ac->record_min_max_;
+  }
+  bucket_indexer_ = HistogramBucketIndexer(boundaries_);
+  counts_         = MakeAtomicCounts(std::vector<uint64_t>(boundaries_.size() + 1, 0));
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0.0, std::memory_order_relaxed);
+  min_.store((std::numeric_limits<double>::max)(), std::memory_order_relaxed);
+  max_.store((std::numeric_limits<double>::lowest)(), std::memory_order_relaxed);
+}
+
+DoubleAtomicHistogramAggregation::DoubleAtomicHistogramAggregation(const HistogramPointData &data)
+    : boundaries_{data.boundaries_},
+      record_min_max_{data.record_min_max_},
+      bucket_indexer_{boundaries_}
+{
+  std::vector<uint64_t> counts = data.counts_;
+  counts.resize(boundaries_.size() + 1, 0);
+  counts_ = MakeAtomicCounts(counts);
+  count_.store(data.count_, std::memory_order_relaxed);
+  sum_.store(GetValueOr<double>(data.sum_, 0.0), std::memory_order_relaxed);
+  min_.store(GetValueOr<double>(data.min_, (std::numeric_limits<double>::max)()),
+             std::memory_order_relaxed);
+  max_.store(GetValueOr<double>(data.max_, (std::numeric_limits<double>::lowest)()),
+             std::memory_order_relaxed);
+}
+
+void DoubleAtomicHistogramAggregation::Aggregate(double value,
+                                                 const PointAttributes & /* attributes */) noexcept
+{
+  size_t index = bucket_indexer_.ComputeIndex(value);
+  counts_[index].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  AtomicAdd(sum_, value);
+  if (record_min_max_)
+  {
+    AtomicMin(min_, value);
+    AtomicMax(max_, value);
+  }
+}
+
+std::unique_ptr<Aggregation> DoubleAtomicHistogramAggregation::Merge(
+    const Aggregation &delta) const noexcept
+{
+  auto curr_value  = nostd::get<HistogramPointData>(ToPoint());
+  auto delta_value = nostd::get<HistogramPointData>(delta.ToPoint());
+  HistogramPointData merge;
+  merge.counts_.resize(curr_value.counts_.size());
+  HistogramMerge<double>(curr_value, delta_value, merge);
+  return std::unique_ptr<Aggregation>(new DoubleAtomicHistogramAggregation(merge));
+}
+
+bool DoubleAtomicHistogramAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  HistogramPointData &delta_value = GetEmptyHistogramPoint<double>(boundaries_.size() + 1);
+  // Min and max can not stop being recorded in place, as measurements may be in flight.
+  if (!delta.AddToHistogramPoint(delta_value) ||
+      (record_min_max_ && !delta_value.record_min_max_))
+  {
+    return false;
+  }
+  for (size_t i = 0; i < delta_value.counts_.size(); i++)
+  {
+    counts_[i].fetch_add(delta_value.counts_[i], std::memory_order_relaxed);
+  }
+  count_.fetch_add(delta_value.count_, std::memory_order_relaxed);
+  AtomicAdd(sum_, nostd::get<double>(delta_value.sum_));
+  if (record_min_max_)
+  {
+    AtomicMin(min_, nostd::get<double>(delta_value.min_));
+    AtomicMax(max_, nostd::get<double>(delta_value.max_));
+  }
+  return true;
+}
+
+bool DoubleAtomicHistogramAggregation::AddToHistogramPoint(HistogramPointData &point) const noexcept
+{
+  return AddHistogram<double>(
+      point, boundaries_.size() + 1,
+      [this](size_t i) { return counts_[i].load(std::memory_order_relaxed); },
+      count_.load(std::memory_order_relaxed), sum_.load(std::memory_order_relaxed),
+      record_min_max_, min_.load(std::memory_order_relaxed), max_.load(std::memory_order_relaxed));
+}
+
+bool DoubleAtomicHistogramAggregation::Reset() noexcept
+{
+  for (size_t i = 0; i < boundaries_.size() + 1; i++)
+  {
+    counts_[i].store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0.0, std::memory_order_relaxed);
+  min_.store((std::numeric_limits<double>::max)(), std::memory_order_relaxed);
+  max_.store((std::numeric_limits<double>::lowest)(), std::memory_order_relaxed);
+  return true;
+}
+
+std::unique_ptr<Aggregation> DoubleAtomicHistogramAggregation::Diff(
+    const Aggregation &next) const noexcept
+{
+  auto curr_value = nostd::get<HistogramPointData>(ToPoint());
+  auto next_value = nostd::get<HistogramPointData>(next.ToPoint());
+  HistogramPointData diff;
+  diff.counts_.resize(curr_value.counts_.size());
+  HistogramDiff<double>(curr_value, next_value, diff);
+  diff.sum_ = nostd::get<double>(next_value.sum_) - nostd::get<double>(curr_value.sum_);
+  return std::unique_ptr<Aggregation>(new DoubleAtomicHistogramAggregation(diff));
+}
+
+PointType DoubleAtomicHistogramAggregation::ToPoint() const noexcept
+{
+  HistogramPointData point_data;
+  point_data.boundaries_     = boundaries_;
+  point_data.counts_         = LoadAtomicCounts(counts_.get(), boundaries_.size() + 1);
+  point_data.sum_            = sum_.load(std::memory_order_relaxed);
+  point_data.count_          = count_.load(std::memory_order_relaxed);
+  point_data.record_min_max_ = record_min_max_;
+  point_data.min_            = min_.load(std::memory_order_relaxed);
+  point_data.max_            = max_.load(std::memory_order_relaxed);
+  return point_data;
+}
+
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,128 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+namespace
+{
+
+// Returns whether the boundaries are evenly spaced, up to the rounding of their values.
+bool IsUniform(const std::vector<double> &boundaries)
+{
+  const double width = (boundaries.back() - boundaries.front()) / (boundaries.size() - 1);
+  if (!(width > 0) || !std::isfinite(width))
+  {
+    return false;
+  }
+  for (size_t i = 1; i < boundaries.size(); i++)
+  {
+    double expected = boundaries.front() + width * i;
+    if (std::fabs(boundaries[i] - expected) > width * 1e-6)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Fills the nodes of the Eytzinger layout from the sorted boundaries, with an in-order traversal.
+size_t FillEytzinger(const std::vector<double> &boundaries,
+                     size_t sorted_index,
+                     size_t k,
+                     std::vector<double> &table,
+                     std::vector<size_t> &sorted_indexes)
+{
+  if (k < table.size())
+  {
+    sorted_index      = FillEytzinger(boundaries, sorted_index, 2 * k, table, sorted_indexes);
+    table[k]          = boundaries[sorted_index];
+    sorted_indexes[k] = sorted_index;
+    sorted_index      = FillEytzinger(boundaries, sorted_index + 1, 2 * k + 1, table,
+                                      sorted_indexes);
+  }
+  return sorted_index;
+}
+
+}  // namespace
+
+HistogramBucketIndexer::HistogramBucketIndexer(const std::vector<double> &boundaries)
+{
+  std::vector<double> table;
+  if (boundaries.size() <= kMaxLinearBoundaries)
+  {
+    strategy_ = Strategy::kLinear;
+    table     = boundaries;
+    table.resize((boundaries.size() + 3) / 4 * 4, std::numeric_limits<double>::infinity());
+  }
+  else if (IsUniform(boundaries))
+  {
+    strategy_       = Strategy::kUniform;
+    table           = boundaries;
+    first_boundary_ = boundaries.front();
+    inverse_width_  = (boundaries.size() - 1) / (boundaries.back() - boundaries.front());
+  }
+  else if (boundaries.size() < kMinEytzingerBoundaries)
+  {
+    strategy_ = Strategy::kBinarySearch;
+    table     = boundaries;
+  }
+  else
+  {
+    strategy_ = Strategy::kEytzinger;
+    table.resize(boundaries.size() + 1);
+    sorted_indexes_.resize(boundaries.size() + 1);
+    sorted_indexes_[0] = boundaries.size();
+    FillEytzinger(boundaries, 0, 1, table, sorted_indexes_);
+  }
+  SetTable(table.data(), table.size());
+}
+
+HistogramBucketIndexer::HistogramBucketIndexer(const HistogramBucketIndexer &other)
+    : strategy_(other.strategy_),
+      sorted_indexes_(other.sorted_indexes_),
+      first_boundary_(other.first_boundary_),
+      inverse_width_(other.inverse_width_)
+{
+  SetTable(other.table_, other.table_size_);
+}
+
+HistogramBucketIndexer &HistogramBucketIndexer::operator=(const HistogramBucketIndexer &other)
+{
+  if (this != &other)
+  {
+    strategy_       = other.strategy_;
+    sorted_indexes_ = other.sorted_indexes_;
+    first_boundary_ = other.first_boundary_;
+    inverse_width_  = other.inverse_width_;
+    SetTable(other.table_, other.table_size_);
+  }
+  return *this;
+}
+
+void HistogramBucketIndexer::SetTable(const double *table, size_t size)
+{
+  constexpr size_t kCacheLineDoubles = 64 / sizeof(double);
+  std::vector<double> storage(size + kCacheLineDoubles - 1);
+  std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.data());
+  size_t offset          = ((64 - address % 64) % 64) / sizeof(double);
+  std::copy(table, table + size, storage.begin() + offset);
+  storage_    = std::move(storage);
+  table_      = storage_.data() + offset;
+  table_size_ = size;
+}
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -52,6 +52,26 @@ std::unique_ptr<Aggregation> LongLastValueAggregation::Merge(
   }
 }
 
+bool LongLastValueAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  LastValuePointData delta_data = std::move(nostd::get<LastValuePointData>(delta.ToPoint()));
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  if (point_data_.sample_ts_.time_since_epoch() <= delta_data.sample_ts_.time_since_epoch())
+  {
+    point_data_ = std::move(delta_data);
+  }
+  return true;
+}
+
+bool LongLastValueAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.is_lastvalue_valid_ = false;
+  point_data_.value_              = (int64_t)0;
+  point_data_.sample_ts_          = {};
+  return true;
+}
+
 std::unique_ptr<Aggregation> LongLastValueAggregation::Diff(const Aggregation &next) const noexcept
 {
   if (nostd::get<LastValuePointData>(ToPoint()).sample_ts_.time_since_epoch() >
@@ -112,6 +132,26 @@ std::unique_ptr<Aggregation> DoubleLastValueAggregation::Merge(
   }
 }
 
+bool DoubleLastValueAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  LastValuePointData delta_data = std::move(nostd::get<LastValuePointData>(delta.ToPoint()));
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  if (point_data_.sample_ts_.time_since_epoch() <= delta_data.sample_ts_.time_since_epoch())
+  {
+    point_data_ = std::move(delta_data);
+  }
+  return true;
+}
+
+bool DoubleLastValueAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.is_lastvalue_valid_ = false;
+  point_data_.value_              = 0.0;
+  point_data_.sample_ts_          = {};
+  return true;
+}
+
 std::unique_ptr<Aggregation> DoubleLastValueAggregation::Diff(
     const Aggregation &next) const noexcept
 {
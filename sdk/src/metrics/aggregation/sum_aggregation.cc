@@ -15,6 +15,19 @@ namespace sdk
 namespace metrics
 {
 
+namespace
+{
+
+void AtomicAdd(std::atomic<double> &target, double value)
+{
+  double current = target.load(std::memory_order_relaxed);
+  while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+  {
+  }
+}
+
+}  // namespace
+
 LongSumAggregation::LongSumAggregation(bool is_monotonic)
 {
   point_data_.value_        = (int64_t)0;
@@ -51,6 +64,21 @@ std::unique_ptr<Aggregation> LongSumAggregation::Merge(const Aggregation &delta)
   return aggr;
 }
 
+bool LongSumAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  int64_t delta_value = nostd::get<int64_t>(nostd::get<SumPointData>(delta.ToPoint()).value_);
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.value_ = nostd::get<int64_t>(point_data_.value_) + delta_value;
+  return true;
+}
+
+bool LongSumAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.value_ = (int64_t)0;
+  return true;
+}
+
 std::unique_ptr<Aggregation> LongSumAggregation::Diff(const Aggregation &next) const noexcept
 {
   int64_t diff_value =
@@ -106,6 +134,21 @@ std::unique_ptr<Aggregation> DoubleSumAggregation::Merge(const Aggregation &delt
   return aggr;
 }
 
+bool DoubleSumAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  double delta_value = nostd::get<double>(nostd::get<SumPointData>(delta.ToPoint()).value_);
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.value_ = nostd::get<double>(point_data_.value_) + delta_value;
+  return true;
+}
+
+bool DoubleSumAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_.value_ = 0.0;
+  return true;
+}
+
 std::unique_ptr<Aggregation> DoubleSumAggregation::Diff(const Aggregation &next) const noexcept
 {
   double diff_value =
@@ -124,6 +167,134 @@ PointType DoubleSumAggregation::ToPoint() const noexcept
   return point_data_;
 }
 
+LongAtomicSumAggregation::LongAtomicSumAggregation(bool is_monotonic)
+    : is_monotonic_(is_monotonic), value_(0)
+{}
+
+LongAtomicSumAggregation::LongAtomicSumAggregation(const SumPointData &data)
+    : is_monotonic_(data.is_monotonic_), value_(nostd::get<int64_t>(data.value_))
+{}
+
+void LongAtomicSumAggregation::Aggregate(int64_t value,
+                                         const PointAttributes & /* attributes */) noexcept
+{
+  if (is_monotonic_ && value < 0)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        " LongAtomicSumAggregation::Aggregate Negative value ignored for Monotonic increasing "
+        "measurement. Value"
+        << value);
+    return;
+  }
+  value_.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::unique_ptr<Aggregation> LongAtomicSumAggregation::Merge(
+    const Aggregation &delta) const noexcept
+{
+  int64_t merge_value = nostd::get<int64_t>(nostd::get<SumPointData>(delta.ToPoint()).value_) +
+                        value_.load(std::memory_order_relaxed);
+  SumPointData merge;
+  merge.is_monotonic_ = is_monotonic_;
+  merge.value_        = merge_value;
+  return std::unique_ptr<Aggregation>(new LongAtomicSumAggregation(merge));
+}
+
+bool LongAtomicSumAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  value_.fetch_add(nostd::get<int64_t>(nostd::get<SumPointData>(delta.ToPoint()).value_),
+                   std::memory_order_relaxed);
+  return true;
+}
+
+bool LongAtomicSumAggregation::Reset() noexcept
+{
+  value_.store(0, std::memory_order_relaxed);
+  return true;
+}
+
+std::unique_ptr<Aggregation> LongAtomicSumAggregation::Diff(const Aggregation &next) const noexcept
+{
+  int64_t diff_value = nostd::get<int64_t>(nostd::get<SumPointData>(next.ToPoint()).value_) -
+                       value_.load(std::memory_order_relaxed);
+  SumPointData diff;
+  diff.is_monotonic_ = is_monotonic_;
+  diff.value_        = diff_value;
+  return std::unique_ptr<Aggregation>(new LongAtomicSumAggregation(diff));
+}
+
+PointType LongAtomicSumAggregation::ToPoint() const noexcept
+{
+  SumPointData point_data;
+  point_data.value_        = value_.load(std::memory_order_relaxed);
+  point_data.is_monotonic_ = is_monotonic_;
+  return point_data;
+}
+
+DoubleAtomicSumAggregation::DoubleAtomicSumAggregation(bool is_monotonic)
+    : is_monotonic_(is_monotonic), value_(0.0)
+{}
+
+DoubleAtomicSumAggregation::DoubleAtomicSumAggregation(const SumPointData &data)
+    : is_monotonic_(data.is_monotonic_), value_(nostd::get<double>(data.value_))
+{}
+
+void DoubleAtomicSumAggregation::Aggregate(double value,
+                                           const PointAttributes & /* attributes */) noexcept
+{
+  if (is_monotonic_ && value < 0)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        " DoubleAtomicSumAggregation::Aggregate Negative value ignored for Monotonic increasing "
+        "measurement. Value"
+        << value);
+    return;
+  }
+  AtomicAdd(value_, value);
+}
+
+std::unique_ptr<Aggregation> DoubleAtomicSumAggregation::Merge(
+    const Aggregation &delta) const noexcept
+{
+  double merge_value = nostd::get<double>(nostd::get<SumPointData>(delta.ToPoint()).value_) +
+                       value_.load(std::memory_order_relaxed);
+  SumPointData merge;
+  merge.is_monotonic_ = is_monotonic_;
+  merge.value_        = merge_value;
+  return std::unique_ptr<Aggregation>(new DoubleAtomicSumAggregation(merge));
+}
+
+bool DoubleAtomicSumAggregation::MergeInPlace(const Aggregation &delta) noexcept
+{
+  AtomicAdd(value_, nostd::get<double>(nostd::get<SumPointData>(delta.ToPoint()).value_));
+  return true;
+}
+
+bool DoubleAtomicSumAggregation::Reset() noexcept
+{
+  value_.store(0.0, std::memory_order_relaxed);
+  return true;
+}
+
+std::unique_ptr<Aggregation> DoubleAtomicSumAggregation::Diff(
+    const Aggregation &next) const noexcept
+{
+  double diff_value = nostd::get<double>(nostd::get<SumPointData>(next.ToPoint()).value_) -
+                      value_.load(std::memory_order_relaxed);
+  SumPointData diff;
+  diff.is_monotonic_ = is_monotonic_;
+  diff.value_        = diff_value;
+  return std::unique_ptr<Aggregation>(new DoubleAtomicSumAggregation(diff));
+}
+
+PointType DoubleAtomicSumAggregation::ToPoint() const noexcept
+{
+  SumPointData point_data;
+  point_data.value_        = value_.load(std::memory_order_relaxed);
+  point_data.is_monotonic_ = is_monotonic_;
+  return point_data;
+}
+
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
@@ -327,7 +327,8 @@ std::unique_ptr<SyncWritableMetricStorage> Meter::RegisterSyncMetricStorage(
 
         auto storage = std::shared_ptr<SyncMetricStorage>(new SyncMetricStorage(
             view_instr_desc, view.GetAggregationType(), &view.GetAttributesProcessor(),
-            ExemplarReservoir::GetNoExemplarReservoir(), view.GetAggregationConfig()));
+            ExemplarReservoir::GetNoExemplarReservoir(), view.GetAggregationConfig(),
+            kAggregationCardinalityLimit, view.GetStorageShardCount()));
         storage_registry_[instrument_descriptor.name_] = storage;
         multi_storage->AddStorage(storage);
         return true;
@@ -3,12 +3,191 @@
 
 #include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
 
+#include <atomic>
+
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
 {
 namespace metrics
 {
 
+class SyncMetricStorage::BoundStorage : public BoundSyncWritableMetricStorage
+{
+public:
+  BoundStorage(std::shared_ptr<BoundEntry> entry, InstrumentValueType value_type)
+      : entry_(std::move(entry)), value_type_(value_type)
+  {}
+
+  void RecordLong(int64_t value) noexcept override
+  {
+    if (value_type_ != InstrumentValueType::kLong)
+    {
+      return;
+    }
+    if (entry_->is_sum)
+    {
+      entry_->long_sum.fetch_add(value, std::memory_order_relaxed);
+      entry_->has_records.store(true, std::memory_order_release);
+      return;
+    }
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(entry_->lock);
+    entry_->aggregation->Aggregate(value);
+    entry_->has_records.store(true, std::memory_order_relaxed);
+  }
+
+  void RecordDouble(double value) noexcept override
+  {
+    if (value_type_ != InstrumentValueType::kDouble)
+    {
+      return;
+    }
+    if (entry_->is_sum)
+    {
+      double current = entry_->double_sum.load(std::memory_order_relaxed);
+      while (!entry_->double_sum.compare_exchange_weak(current, current + value,
+                                                       std::memory_order_relaxed))
+      {
+      }
+      entry_->has_records.store(true, std::memory_order_release);
+      return;
+    }
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(entry_->lock);
+    entry_->aggregation->Aggregate(value);
+    entry_->has_records.store(true, std::memory_order_relaxed);
+  }
+
+private:
+  std::shared_ptr<BoundEntry> entry_;
+  InstrumentValueType value_type_;
+};
+
+std::unique_ptr<BoundSyncWritableMetricStorage> SyncMetricStorage::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  auto hash = opentelemetry::sdk::common::GetHashForAttributeMap(
+      attributes, [this](nostd::string_view key) {
+        if (attributes_processor_)
+        {
+          return attributes_processor_->isPresent(key);
+        }
+        else
+        {
+          return true;
+        }
+      });
+  MetricAttributes bound_attributes = attributes_processor_
+                                          ? attributes_processor_->process(attributes)
+                                          : MetricAttributes{attributes};
+  std::shared_ptr<BoundEntry> entry(
+      new BoundEntry(std::move(bound_attributes), hash, is_sum_aggregation_));
+  if (!entry->is_sum)
+  {
+    entry->aggregation = create_default_aggregation_();
+  }
+  {
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(bound_entries_lock_);
+    bound_entries_.push_back(entry);
+  }
+  return std::unique_ptr<BoundSyncWritableMetricStorage>(
+      new BoundStorage(std::move(entry), instrument_descriptor_.value_type_));
+}
+
+void SyncMetricStorage::CollectBoundEntries(AttributesHashMap &delta_metrics) noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(bound_entries_lock_);
+  for (auto it = bound_entries_.begin(); it != bound_entries_.end();)
+  {
+    BoundEntry &entry = **it;
+    if (entry.is_sum)
+    {
+      // The flag is set after the sum is updated, so a measurement racing with the collection
+      // is either drained now, or leaves the flag set for the next collection.
+      if (entry.has_records.exchange(false, std::memory_order_acquire))
+      {
+        Aggregation *aggregation = delta_metrics.GetOrSetDefault(
+            entry.attributes, create_default_aggregation_, entry.hash);
+        if (instrument_descriptor_.value_type_ == InstrumentValueType::kLong)
+        {
+          aggregation->Aggregate(entry.long_sum.exchange(0, std::memory_order_relaxed));
+        }
+        else
+        {
+          aggregation->Aggregate(entry.double_sum.exchange(0.0, std::memory_order_relaxed));
+        }
+      }
+    }
+    else
+    {
+      std::unique_ptr<Aggregation> aggregation;
+      {
+        std::lock_guard<opentelemetry::common::SpinLockMutex> entry_guard(entry.lock);
+        if (entry.has_records.load(std::memory_order_relaxed))
+        {
+          aggregation       = std::move(entry.aggregation);
+          entry.aggregation = create_default_aggregation_();
+          entry.has_records.store(false, std::memory_order_relaxed);
+        }
+      }
+      if (aggregation)
+      {
+        delta_metrics.Merge(entry.attributes, *aggregation, create_default_aggregation_,
+                            entry.hash);
+      }
+    }
+
+    // the bound storage was released, and its last measurements are collected now.
+    if (it->use_count() == 1)
+    {
+      it = bound_entries_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+size_t SyncMetricStorage::GetThreadShardIndex() noexcept
+{
+  // Threads are assigned to shards in round-robin order on their first recording.
+  static std::atomic<size_t> next_index{0};
+  static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+std::shared_ptr<AttributesHashMap> SyncMetricStorage::SwapShardHashMap(Shard &shard) noexcept
+{
+  std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(shard.lock);
+  std::shared_ptr<AttributesHashMap> hashmap = std::move(shard.attributes_hashmap);
+  if (shard.inactive_hashmap)
+  {
+    shard.attributes_hashmap = std::move(shard.inactive_hashmap);
+  }
+  else
+  {
+    shard.attributes_hashmap.reset(new AttributesHashMap(attributes_limit_));
+  }
+  return hashmap;
+}
+
+void SyncMetricStorage::RecycleHashMap(opentelemetry::sdk::common::SharedSpinLockMutex &lock,
+                                       std::shared_ptr<AttributesHashMap> &inactive_hashmap,
+                                       std::shared_ptr<AttributesHashMap> hashmap) noexcept
+{
+  // The hashmap is still referenced when it is stashed for other collectors.
+  if (hashmap.use_count() != 1)
+  {
+    return;
+  }
+  // Clearing resets the series of the hashmap in place, and is done outside of the lock.
+  hashmap->Clear();
+  std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(lock);
+  if (!inactive_hashmap)
+  {
+    inactive_hashmap = std::move(hashmap);
+  }
+}
+
 bool SyncMetricStorage::Collect(CollectorHandle *collector,
                                 nostd::span<std::shared_ptr<CollectorHandle>> collectors,
                                 opentelemetry::common::SystemTimestamp sdk_start_ts,
@@ -19,14 +198,42 @@ bool SyncMetricStorage::Collect(CollectorHandle *collector,
   // this will also empty the delta metrics hashmap, and make it available for
   // recordings
   std::shared_ptr<AttributesHashMap> delta_metrics = nullptr;
+  if (shard_count_ == 1)
   {
-    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(attribute_hashmap_lock_);
-    delta_metrics = std::move(attributes_hashmap_);
-    attributes_hashmap_.reset(new AttributesHashMap);
+    delta_metrics = SwapShardHashMap(shards_[0]);
   }
+  else
+  {
+    // Swap out each shard under its own lock, so that recording threads are only blocked for
+    // the duration of the swap, and merge the shards outside of the locks.
+    {
+      std::lock_guard<opentelemetry::sdk::common::SharedSpinLockMutex> guard(merged_hashmap_lock_);
+      delta_metrics = std::move(inactive_merged_hashmap_);
+    }
+    if (!delta_metrics)
+    {
+      delta_metrics.reset(new AttributesHashMap(attributes_limit_));
+    }
+    for (size_t i = 0; i < shard_count_; i++)
+    {
+      std::shared_ptr<AttributesHashMap> shard_metrics = SwapShardHashMap(shards_[i]);
+      delta_metrics->Merge(*shard_metrics, create_default_aggregation_);
+      RecycleHashMap(shards_[i].lock, shards_[i].inactive_hashmap, std::move(shard_metrics));
+    }
+  }
+  CollectBoundEntries(*delta_metrics);
 
-  return temporal_metric_storage_.buildMetrics(collector, collectors, sdk_start_ts, collection_ts,
-                                               std::move(delta_metrics), callback);
+  bool result = temporal_metric_storage_.buildMetrics(collector, collectors, sdk_start_ts,
+                                                      collection_ts, delta_metrics, callback);
+  if (shard_count_ == 1)
+  {
+    RecycleHashMap(shards_[0].lock, shards_[0].inactive_hashmap, std::move(delta_metrics));
+  }
+  else
+  {
+    RecycleHashMap(merged_hashmap_lock_, inactive_merged_hashmap_, std::move(delta_metrics));
+  }
+  return result;
 }
 
 }  // namespace metrics
@@ -24,7 +24,12 @@ TemporalMetricStorage::TemporalMetricStorage(InstrumentDescriptor instrument_des
     : instrument_descriptor_(instrument_descriptor),
       aggregation_type_(aggregation_type),
       aggregation_config_(aggregation_config)
-{}
+{
+  create_default_aggregation_ = [this]() -> std::unique_ptr<Aggregation> {
+    return DefaultAggregation::CreateAggregation(aggregation_type_, instrument_descriptor_,
+                                                 aggregation_config_);
+  };
+}
 
 bool TemporalMetricStorage::buildMetrics(CollectorHandle *collector,
                                          nostd::span<std::shared_ptr<CollectorHandle>> collectors,
@@ -56,78 +61,57 @@ bool TemporalMetricStorage::buildMetrics(CollectorHandle *collector,
     return true;
   }
   auto unreported_list = std::move(present->second);
-  // Iterate over the unreporter metrics for `collector` and store result in `merged_metrics`
-  std::unique_ptr<AttributesHashMap> merged_metrics(new AttributesHashMap);
-  for (auto &agg_hashmap : unreported_list)
-  {
-    agg_hashmap->GetAllEnteries(
-        [&merged_metrics, this](const MetricAttributes &attributes, Aggregation &aggregation) {
-          auto hash = opentelemetry::sdk::common::GetHashForAttributeMap(attributes);
-          auto agg  = merged_metrics->Get(hash);
-          if (agg)
-          {
-            merged_metrics->Set(attributes, agg->Merge(aggregation), hash);
-          }
-          else
-          {
-            merged_metrics->Set(attributes,
-                                DefaultAggregation::CreateAggregation(
-                                    aggregation_type_, instrument_descriptor_, aggregation_config_)
-                                    ->Merge(aggregation),
-                                hash);
-          }
-          return true;
-        });
-  }
-  // Get the last reported metrics for the `collector` from `last reported metrics` stash
+
+  // The unreported metrics are merged using the hashes the delta hashmaps were built with.
   //   - If the aggregation_temporarily for the collector is cumulative
-  //       - Merge the last reported metrics with unreported metrics (which is in merged_metrics),
-  //           Final result of merge would be in merged_metrics.
-  //       - Move the final merge to the `last reported metrics` stash.
+  //       - Merge the unreported metrics in place into the `last reported metrics` stash, so
+  //           that existing series keep their aggregation and only new series allocate one.
   //   - If the aggregation_temporarily is delta
-  //       - Store the unreported metrics for `collector` (which is in merged_mtrics) to
-  //          `last reported metrics` stash.
-
-  auto reported = last_reported_metrics_.find(collector);
-  if (reported != last_reported_metrics_.end())
+  //       - Export the unreported metrics, merged into a new hashmap only if there are several
+  //           of them, and only keep the collection timestamp in the `last reported metrics`
+  //           stash.
+  std::shared_ptr<AttributesHashMap> delta_to_export;
+  AttributesHashMap *result_to_export = nullptr;
+  auto reported                       = last_reported_metrics_.find(collector);
+  if (aggregation_temporarily == AggregationTemporality::kCumulative)
   {
-    auto last_aggr_hashmap = std::move(last_reported_metrics_[collector].attributes_map);
-    if (aggregation_temporarily == AggregationTemporality::kCumulative)
+    if (reported == last_reported_metrics_.end() || !reported->second.attributes_map)
     {
-      // merge current delta to previous cumulative
-      last_aggr_hashmap->GetAllEnteries(
-          [&merged_metrics, this](const MetricAttributes &attributes, Aggregation &aggregation) {
-            auto hash = opentelemetry::sdk::common::GetHashForAttributeMap(attributes);
-            auto agg  = merged_metrics->Get(hash);
-            if (agg)
-            {
-              merged_metrics->Set(attributes, agg->Merge(aggregation), hash);
-            }
-            else
-            {
-              auto def_agg = DefaultAggregation::CreateAggregation(
-                  aggregation_type_, instrument_descriptor_, aggregation_config_);
-              merged_metrics->Set(attributes, def_agg->Merge(aggregation), hash);
-            }
-            return true;
-          });
+      last_reported_metrics_[collector] =
+          LastReportedMetrics{std::unique_ptr<AttributesHashMap>(new AttributesHashMap),
+                              collection_ts};
+      reported = last_reported_metrics_.find(collector);
     }
-    else
+    for (auto &agg_hashmap : unreported_list)
     {
-      last_collection_ts = last_reported_metrics_[collector].collection_ts;
+      reported->second.attributes_map->Merge(*agg_hashmap, create_default_aggregation_);
     }
-    last_reported_metrics_[collector] =
-        LastReportedMetrics{std::move(merged_metrics), collection_ts};
+    reported->second.collection_ts = collection_ts;
+    result_to_export               = reported->second.attributes_map.get();
   }
   else
   {
-    last_reported_metrics_.insert(
-        std::make_pair(collector, LastReportedMetrics{std::move(merged_metrics), collection_ts}));
+    if (reported != last_reported_metrics_.end())
+    {
+      last_collection_ts = reported->second.collection_ts;
+    }
+    if (unreported_list.size() == 1)
+    {
+      delta_to_export = std::move(unreported_list.front());
+    }
+    else
+    {
+      delta_to_export.reset(new AttributesHashMap);
+      for (auto &agg_hashmap : unreported_list)
+      {
+        delta_to_export->Merge(*agg_hashmap, create_default_aggregation_);
+      }
+    }
+    last_reported_metrics_[collector] = LastReportedMetrics{nullptr, collection_ts};
+    result_to_export                  = delta_to_export.get();
   }
 
   // Generate the MetricData from the final merged_metrics, and invoke callback over it.
-
-  AttributesHashMap *result_to_export = (last_reported_metrics_[collector]).attributes_map.get();
   MetricData metric_data;
   metric_data.instrument_descriptor   = instrument_descriptor_;
   metric_data.aggregation_temporality = aggregation_temporarily;
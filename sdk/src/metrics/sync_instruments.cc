@@ -438,6 +438,163 @@ void DoubleHistogram::Record(double value) noexcept
 }
 #endif
 
+BoundLongCounter LongCounter::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[LongCounter::Bind(A)] Attributes not bound - invalid storage for: "
+                           << instrument_descriptor_.name_);
+    return BoundLongCounter(instrument_descriptor_, nullptr);
+  }
+  return BoundLongCounter(instrument_descriptor_, storage_->Bind(attributes));
+}
+
+void BoundLongCounter::Add(uint64_t value) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[BoundLongCounter::Add(V)] Value not recorded - invalid storage for: "
+                           << instrument_descriptor_.name_);
+    return;
+  }
+  return storage_->RecordLong(value);
+}
+
+BoundDoubleCounter DoubleCounter::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[DoubleCounter::Bind(A)] Attributes not bound - invalid storage for: "
+                           << instrument_descriptor_.name_);
+    return BoundDoubleCounter(instrument_descriptor_, nullptr);
+  }
+  return BoundDoubleCounter(instrument_descriptor_, storage_->Bind(attributes));
+}
+
+void BoundDoubleCounter::Add(double value) noexcept
+{
+  if (value < 0)
+  {
+    OTEL_INTERNAL_LOG_WARN("[BoundDoubleCounter::Add(V)] Value not recorded - negative value for: "
+                           << instrument_descriptor_.name_);
+    return;
+  }
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[BoundDoubleCounter::Add(V)] Value not recorded - invalid storage for: "
+                           << instrument_descriptor_.name_);
+    return;
+  }
+  return storage_->RecordDouble(value);
+}
+
+BoundLongUpDownCounter LongUpDownCounter::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[LongUpDownCounter::Bind(A)] Attributes not bound - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return BoundLongUpDownCounter(instrument_descriptor_, nullptr);
+  }
+  return BoundLongUpDownCounter(instrument_descriptor_, storage_->Bind(attributes));
+}
+
+void BoundLongUpDownCounter::Add(int64_t value) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[BoundLongUpDownCounter::Add(V)] Value not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  return storage_->RecordLong(value);
+}
+
+BoundDoubleUpDownCounter DoubleUpDownCounter::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[DoubleUpDownCounter::Bind(A)] Attributes not bound - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return BoundDoubleUpDownCounter(instrument_descriptor_, nullptr);
+  }
+  return BoundDoubleUpDownCounter(instrument_descriptor_, storage_->Bind(attributes));
+}
+
+void BoundDoubleUpDownCounter::Add(double value) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[BoundDoubleUpDownCounter::Add(V)] Value not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  return storage_->RecordDouble(value);
+}
+
+BoundLongHistogram LongHistogram::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[LongHistogram::Bind(A)] Attributes not bound - invalid storage for: "
+                           << instrument_descriptor_.name_);
+    return BoundLongHistogram(instrument_descriptor_, nullptr);
+  }
+  return BoundLongHistogram(instrument_descriptor_, storage_->Bind(attributes));
+}
+
+void BoundLongHistogram::Record(uint64_t value) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[BoundLongHistogram::Record(V)] Value not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  return storage_->RecordLong(value);
+}
+
+BoundDoubleHistogram DoubleHistogram::Bind(
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN("[DoubleHistogram::Bind(A)] Attributes not bound - invalid storage for: "
+                           << instrument_descriptor_.name_);
+    return BoundDoubleHistogram(instrument_descriptor_, nullptr);
+  }
+  return BoundDoubleHistogram(instrument_descriptor_, storage_->Bind(attributes));
+}
+
+void BoundDoubleHistogram::Record(double value) noexcept
+{
+  if (value < 0)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[BoundDoubleHistogram::Record(V)] Value not recorded - negative value for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[BoundDoubleHistogram::Record(V)] Value not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  return storage_->RecordDouble(value);
+}
+
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
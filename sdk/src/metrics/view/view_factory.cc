@@ -56,9 +56,21 @@ std::unique_ptr<View> ViewFactory::Create(const std::string &name,
                                           AggregationType aggregation_type,
                                           std::shared_ptr<AggregationConfig> aggregation_config,
                                           std::unique_ptr<AttributesProcessor> attributes_processor)
+{
+  return Create(name, description, unit, aggregation_type, aggregation_config,
+                std::move(attributes_processor), 1);
+}
+
+std::unique_ptr<View> ViewFactory::Create(const std::string &name,
+                                          const std::string &description,
+                                          const std::string &unit,
+                                          AggregationType aggregation_type,
+                                          std::shared_ptr<AggregationConfig> aggregation_config,
+                                          std::unique_ptr<AttributesProcessor> attributes_processor,
+                                          size_t storage_shard_count)
 {
   std::unique_ptr<View> view(new View(name, description, unit, aggregation_type, aggregation_config,
-                                      std::move(attributes_processor)));
+                                      std::move(attributes_processor), storage_shard_count));
   return view;
 }
 
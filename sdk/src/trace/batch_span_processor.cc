@@ -8,7 +8,9 @@
 #include "opentelemetry/sdk/trace/batch_span_processor_options.h"
 #include "opentelemetry/sdk/trace/exporter.h"
 #include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/sdk/trace/shared_span_data.h"
 
+#include <algorithm>
 #include <vector>
 
 using opentelemetry::sdk::common::AtomicUniquePtr;
@@ -22,13 +24,51 @@ namespace sdk
 namespace trace
 {
 
+namespace
+{
+
+size_t GetShardCount(const BatchSpanProcessorOptions &options)
+{
+  return options.queue_shard_count == 0 ? 1 : options.queue_shard_count;
+}
+
+size_t GetShardSize(const BatchSpanProcessorOptions &options)
+{
+  size_t shard_count = GetShardCount(options);
+  return (options.max_queue_size + shard_count - 1) / shard_count;
+}
+
+// If a shard gets at least half full, or holds its part of a batch, a preemptive notification
+// is sent to the worker thread to start a new export cycle.
+size_t GetShardNotifySize(const BatchSpanProcessorOptions &options)
+{
+  size_t batch_size = options.max_export_batch_size / GetShardCount(options);
+  return (std::max)(size_t{1}, (std::min)(GetShardSize(options) / 2, batch_size));
+}
+
+std::vector<std::unique_ptr<CircularBuffer<Recordable>>> MakeAdditionalShards(
+    const BatchSpanProcessorOptions &options)
+{
+  std::vector<std::unique_ptr<CircularBuffer<Recordable>>> shards;
+  for (size_t i = 1; i < GetShardCount(options); i++)
+  {
+    shards.emplace_back(new CircularBuffer<Recordable>(GetShardSize(options)));
+  }
+  return shards;
+}
+
+}  // namespace
+
 BatchSpanProcessor::BatchSpanProcessor(std::unique_ptr<SpanExporter> &&exporter,
                                        const BatchSpanProcessorOptions &options)
     : exporter_(std::move(exporter)),
       max_queue_size_(options.max_queue_size),
       schedule_delay_millis_(options.schedule_delay_millis),
       max_export_batch_size_(options.max_export_batch_size),
-      buffer_(max_queue_size_),
+      shard_count_(GetShardCount(options)),
+      shard_notify_size_(GetShardNotifySize(options)),
+      buffer_(GetShardSize(options)),
+      additional_shards_(MakeAdditionalShards(options)),
       synchronization_data_(std::make_shared<SynchronizationData>()),
       worker_thread_(&BatchSpanProcessor::DoBackgroundWork, this)
 {}
@@ -50,22 +90,89 @@ void BatchSpanProcessor::OnEnd(std::unique_ptr<Recordable> &&span) noexcept
     return;
   }
 
-  if (buffer_.Add(span) == false)
+  CircularBuffer<Recordable> &shard = GetShard();
+  if (shard.Add(span) == false)
   {
     OTEL_INTERNAL_LOG_WARN("BatchSpanProcessor queue is full - dropping span.");
     return;
   }
 
-  // If the queue gets at least half full a preemptive notification is
+  // If the shard gets at least half full a preemptive notification is
   // sent to the worker thread to start a new export cycle.
-  size_t buffer_size = buffer_.size();
-  if (buffer_size >= max_queue_size_ / 2 || buffer_size >= max_export_batch_size_)
+  if (shard.size() < shard_notify_size_)
+  {
+    return;
+  }
+  if (shard_count_ == 1)
+  {
+    // signal the worker thread
+    synchronization_data_->cv.notify_one();
+    return;
+  }
+  // With several shards, only the first thread to reach the threshold signals the worker thread
+  // until it wakes up. As no other thread signals it, the worker mutex is taken before, so that
+  // the signal is not lost if it is sent between the worker checking the queue and waiting.
+  if (!synchronization_data_->is_background_worker_notified.load(std::memory_order_relaxed) &&
+      !synchronization_data_->is_background_worker_notified.exchange(true,
+                                                                     std::memory_order_acq_rel))
   {
+    {
+      std::lock_guard<std::mutex> guard(synchronization_data_->cv_m);
+    }
     // signal the worker thread
     synchronization_data_->cv.notify_one();
   }
 }
 
+CircularBuffer<Recordable> &BatchSpanProcessor::GetShard() noexcept
+{
+  if (shard_count_ == 1)
+  {
+    return buffer_;
+  }
+  // Threads are assigned to shards in round-robin order on their first span.
+  static std::atomic<size_t> next_index{0};
+  static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return GetShard(index % shard_count_);
+}
+
+size_t BatchSpanProcessor::GetQueueSize() const noexcept
+{
+  size_t size = buffer_.size();
+  for (const auto &shard : additional_shards_)
+  {
+    size += shard->size();
+  }
+  return size;
+}
+
+void BatchSpanProcessor::ConsumeSpans(size_t max_spans,
+                                      std::vector<std::unique_ptr<Recordable>> &spans) noexcept
+{
+  // Start from the next shard on every batch, so that no shard is starved when the batches are
+  // filled by the first shards.
+  size_t first_shard   = next_consumed_shard_;
+  next_consumed_shard_ = (next_consumed_shard_ + 1) % shard_count_;
+  for (size_t i = 0; i < shard_count_ && spans.size() < max_spans; i++)
+  {
+    CircularBuffer<Recordable> &shard = GetShard((first_shard + i) % shard_count_);
+    size_t num_records = (std::min)(shard.size(), max_spans - spans.size());
+    if (num_records == 0)
+    {
+      continue;
+    }
+    shard.Consume(num_records,
+                  [&](CircularBufferRange<AtomicUniquePtr<Recordable>> range) noexcept {
+                    range.ForEach([&](AtomicUniquePtr<Recordable> &ptr) {
+                      std::unique_ptr<Recordable> swap_ptr = std::unique_ptr<Recordable>(nullptr);
+                      ptr.Swap(swap_ptr);
+                      spans.push_back(std::unique_ptr<Recordable>(swap_ptr.release()));
+                      return true;
+                    });
+                  });
+  }
+}
+
 bool BatchSpanProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept
 {
   if (synchronization_data_->is_shutdown.load() == true)
@@ -152,10 +259,11 @@ void BatchSpanProcessor::DoBackgroundWork()
         return true;
       }
 
-      return !buffer_.empty();
+      return GetQueueSize() != 0;
     });
     synchronization_data_->is_force_wakeup_background_worker.store(false,
                                                                    std::memory_order_release);
+    synchronization_data_->is_background_worker_notified.store(false, std::memory_order_release);
 
     if (synchronization_data_->is_shutdown.load() == true)
     {
@@ -181,14 +289,15 @@ void BatchSpanProcessor::Export()
     size_t num_records_to_export;
     bool notify_force_flush =
         synchronization_data_->is_force_flush_pending.exchange(false, std::memory_order_acq_rel);
+    size_t queue_size = GetQueueSize();
     if (notify_force_flush)
     {
-      num_records_to_export = buffer_.size();
+      num_records_to_export = queue_size;
     }
     else
     {
       num_records_to_export =
-          buffer_.size() >= max_export_batch_size_ ? max_export_batch_size_ : buffer_.size();
+          queue_size >= max_export_batch_size_ ? max_export_batch_size_ : queue_size;
     }
 
     if (num_records_to_export == 0)
@@ -196,15 +305,11 @@ void BatchSpanProcessor::Export()
       NotifyCompletion(notify_force_flush, exporter_, synchronization_data_);
       break;
     }
-    buffer_.Consume(num_records_to_export,
-                    [&](CircularBufferRange<AtomicUniquePtr<Recordable>> range) noexcept {
-                      range.ForEach([&](AtomicUniquePtr<Recordable> &ptr) {
-                        std::unique_ptr<Recordable> swap_ptr = std::unique_ptr<Recordable>(nullptr);
-                        ptr.Swap(swap_ptr);
-                        spans_arr.push_back(std::unique_ptr<Recordable>(swap_ptr.release()));
-                        return true;
-                      });
-                    });
+    ConsumeSpans(num_records_to_export, spans_arr);
+    for (auto &span : spans_arr)
+    {
+      SharedSpanData::Convert(span, *exporter_);
+    }
 
     exporter_->Export(nostd::span<std::unique_ptr<Recordable>>(spans_arr.data(), spans_arr.size()));
     NotifyCompletion(notify_force_flush, exporter_, synchronization_data_);
@@ -241,7 +346,7 @@ void BatchSpanProcessor::DrainQueue()
 {
   while (true)
   {
-    if (buffer_.empty() &&
+    if (GetQueueSize() == 0 &&
         false == synchronization_data_->is_force_flush_pending.load(std::memory_order_acquire))
     {
       break;
@@ -0,0 +1,141 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/trace/shared_span_data.h"
+#include "opentelemetry/common/key_value_iterable.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace
+{
+using opentelemetry::common::AttributeValue;
+using opentelemetry::sdk::common::OwnedAttributeValue;
+
+// Views an owned attribute value as an AttributeValue. The values of std::vector<bool> and
+// std::vector<std::string> are not stored as AttributeValue expects, so they are viewed through
+// buffers that are valid until the next call.
+class OwnedAttributeValueView
+{
+public:
+  template <class T>
+  AttributeValue operator()(const T &value) const
+  {
+    return AttributeValue(value);
+  }
+
+  AttributeValue operator()(const std::string &value) const
+  {
+    return AttributeValue(nostd::string_view(value));
+  }
+
+  template <class T>
+  AttributeValue operator()(const std::vector<T> &values) const
+  {
+    return AttributeValue(nostd::span<const T>(values.data(), values.size()));
+  }
+
+  AttributeValue operator()(const std::vector<bool> &values) const
+  {
+    bools_.reset(new bool[values.size()]);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      bools_[i] = values[i];
+    }
+    return AttributeValue(nostd::span<const bool>(bools_.get(), values.size()));
+  }
+
+  AttributeValue operator()(const std::vector<std::string> &values) const
+  {
+    strings_.assign(values.begin(), values.end());
+    return AttributeValue(nostd::span<const nostd::string_view>(strings_.data(), strings_.size()));
+  }
+
+private:
+  mutable std::unique_ptr<bool[]> bools_;
+  mutable std::vector<nostd::string_view> strings_;
+};
+
+// A KeyValueIterable over the attributes of a span, event or link of a SpanData.
+class OwnedAttributesIterable final : public opentelemetry::common::KeyValueIterable
+{
+public:
+  explicit OwnedAttributesIterable(
+      const std::unordered_map<std::string, OwnedAttributeValue> &attributes) noexcept
+      : attributes_(attributes)
+  {}
+
+  bool ForEachKeyValue(nostd::function_ref<bool(nostd::string_view, AttributeValue)> callback)
+      const noexcept override
+  {
+    OwnedAttributeValueView view;
+    for (const auto &attribute : attributes_)
+    {
+      if (!callback(attribute.first, nostd::visit(view, attribute.second)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  size_t size() const noexcept override { return attributes_.size(); }
+
+private:
+  const std::unordered_map<std::string, OwnedAttributeValue> &attributes_;
+};
+}  // namespace
+
+void SharedSpanData::CopyTo(Recordable &recordable) const noexcept
+{
+  recordable.SetIdentity(span_data_->GetSpanContext(), span_data_->GetParentSpanId());
+  recordable.SetName(span_data_->GetName());
+  recordable.SetSpanKind(span_data_->GetSpanKind());
+  recordable.SetStatus(span_data_->GetStatus(), span_data_->GetDescription());
+  recordable.SetResource(span_data_->GetResource());
+  recordable.SetInstrumentationScope(span_data_->GetInstrumentationScope());
+  recordable.SetStartTime(span_data_->GetStartTime());
+  recordable.SetDuration(span_data_->GetDuration());
+
+  OwnedAttributeValueView view;
+  for (const auto &attribute : span_data_->GetAttributes())
+  {
+    recordable.SetAttribute(attribute.first, nostd::visit(view, attribute.second));
+  }
+  for (const auto &event : span_data_->GetEvents())
+  {
+    recordable.AddEvent(event.GetName(), event.GetTimestamp(),
+                        OwnedAttributesIterable(event.GetAttributes()));
+  }
+  for (const auto &link : span_data_->GetLinks())
+  {
+    recordable.AddLink(link.GetSpanContext(), OwnedAttributesIterable(link.GetAttributes()));
+  }
+}
+
+void SharedSpanData::Convert(std::unique_ptr<Recordable> &recordable,
+                             SpanExporter &exporter) noexcept
+{
+  const SharedSpanData *shared_span_data =
+      recordable != nullptr ? recordable->GetSharedSpanData() : nullptr;
+  if (shared_span_data == nullptr)
+  {
+    return;
+  }
+  std::unique_ptr<Recordable> exporter_recordable = exporter.MakeRecordable();
+  if (exporter_recordable != nullptr)
+  {
+    shared_span_data->CopyTo(*exporter_recordable);
+  }
+  recordable = std::move(exporter_recordable);
+}
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -47,17 +47,18 @@ SteadyTimestamp NowOr(const SteadyTimestamp &steady)
 }
 }  // namespace
 
-Span::Span(std::shared_ptr<Tracer> &&tracer,
-           nostd::string_view name,
-           const common::KeyValueIterable &attributes,
-           const opentelemetry::trace::SpanContextKeyValueIterable &links,
-           const opentelemetry::trace::StartSpanOptions &options,
-           const opentelemetry::trace::SpanContext &parent_span_context,
-           std::unique_ptr<opentelemetry::trace::SpanContext> span_context) noexcept
+template <class MutexType>
+BasicSpan<MutexType>::BasicSpan(std::shared_ptr<Tracer> &&tracer,
+                                nostd::string_view name,
+                                const common::KeyValueIterable &attributes,
+                                const opentelemetry::trace::SpanContextKeyValueIterable &links,
+                                const opentelemetry::trace::StartSpanOptions &options,
+                                const opentelemetry::trace::SpanContext &parent_span_context,
+                                const opentelemetry::trace::SpanContext &span_context) noexcept
     : tracer_{std::move(tracer)},
       recordable_{tracer_->GetProcessor().MakeRecordable()},
       start_steady_time{options.start_steady_time},
-      span_context_(std::move(span_context)),
+      span_context_(span_context),
       has_ended_{false}
 {
   if (recordable_ == nullptr)
@@ -66,9 +67,9 @@ Span::Span(std::shared_ptr<Tracer> &&tracer,
   }
   recordable_->SetName(name);
   recordable_->SetInstrumentationScope(tracer_->GetInstrumentationScope());
-  recordable_->SetIdentity(*span_context_, parent_span_context.IsValid()
-                                               ? parent_span_context.span_id()
-                                               : opentelemetry::trace::SpanId());
+  recordable_->SetIdentity(span_context_, parent_span_context.IsValid()
+                                              ? parent_span_context.span_id()
+                                              : opentelemetry::trace::SpanId());
 
   attributes.ForEachKeyValue([&](nostd::string_view key, common::AttributeValue value) noexcept {
     recordable_->SetAttribute(key, value);
@@ -88,14 +89,17 @@ Span::Span(std::shared_ptr<Tracer> &&tracer,
   tracer_->GetProcessor().OnStart(*recordable_, parent_span_context);
 }
 
-Span::~Span()
+template <class MutexType>
+BasicSpan<MutexType>::~BasicSpan()
 {
   End();
 }
 
-void Span::SetAttribute(nostd::string_view key, const common::AttributeValue &value) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::SetAttribute(nostd::string_view key,
+                                        const common::AttributeValue &value) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -104,9 +108,10 @@ void Span::SetAttribute(nostd::string_view key, const common::AttributeValue &va
   recordable_->SetAttribute(key, value);
 }
 
-void Span::AddEvent(nostd::string_view name) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::AddEvent(nostd::string_view name) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -114,9 +119,10 @@ void Span::AddEvent(nostd::string_view name) noexcept
   recordable_->AddEvent(name);
 }
 
-void Span::AddEvent(nostd::string_view name, SystemTimestamp timestamp) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::AddEvent(nostd::string_view name, SystemTimestamp timestamp) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -124,9 +130,11 @@ void Span::AddEvent(nostd::string_view name, SystemTimestamp timestamp) noexcept
   recordable_->AddEvent(name, timestamp);
 }
 
-void Span::AddEvent(nostd::string_view name, const common::KeyValueIterable &attributes) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::AddEvent(nostd::string_view name,
+                                    const common::KeyValueIterable &attributes) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -134,11 +142,12 @@ void Span::AddEvent(nostd::string_view name, const common::KeyValueIterable &att
   recordable_->AddEvent(name, attributes);
 }
 
-void Span::AddEvent(nostd::string_view name,
-                    SystemTimestamp timestamp,
-                    const common::KeyValueIterable &attributes) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::AddEvent(nostd::string_view name,
+                                    SystemTimestamp timestamp,
+                                    const common::KeyValueIterable &attributes) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -147,10 +156,11 @@ void Span::AddEvent(nostd::string_view name,
 }
 
 #if OPENTELEMETRY_ABI_VERSION_NO >= 2
-void Span::AddLink(const opentelemetry::trace::SpanContext &target,
-                   const opentelemetry::common::KeyValueIterable &attrs) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::AddLink(const opentelemetry::trace::SpanContext &target,
+                                   const opentelemetry::common::KeyValueIterable &attrs) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -159,9 +169,11 @@ void Span::AddLink(const opentelemetry::trace::SpanContext &target,
   recordable_->AddLink(target, attrs);
 }
 
-void Span::AddLinks(const opentelemetry::trace::SpanContextKeyValueIterable &links) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::AddLinks(
+    const opentelemetry::trace::SpanContextKeyValueIterable &links) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -175,9 +187,11 @@ void Span::AddLinks(const opentelemetry::trace::SpanContextKeyValueIterable &lin
 }
 #endif
 
-void Span::SetStatus(opentelemetry::trace::StatusCode code, nostd::string_view description) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::SetStatus(opentelemetry::trace::StatusCode code,
+                                     nostd::string_view description) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -185,9 +199,10 @@ void Span::SetStatus(opentelemetry::trace::StatusCode code, nostd::string_view d
   recordable_->SetStatus(code, description);
 }
 
-void Span::UpdateName(nostd::string_view name) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::UpdateName(nostd::string_view name) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   if (recordable_ == nullptr)
   {
     return;
@@ -195,9 +210,10 @@ void Span::UpdateName(nostd::string_view name) noexcept
   recordable_->SetName(name);
 }
 
-void Span::End(const opentelemetry::trace::EndSpanOptions &options) noexcept
+template <class MutexType>
+void BasicSpan<MutexType>::End(const opentelemetry::trace::EndSpanOptions &options) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
 
   if (has_ended_ == true)
   {
@@ -218,11 +234,15 @@ void Span::End(const opentelemetry::trace::EndSpanOptions &options) noexcept
   recordable_.reset();
 }
 
-bool Span::IsRecording() const noexcept
+template <class MutexType>
+bool BasicSpan<MutexType>::IsRecording() const noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::lock_guard<MutexType> lock_guard{mu_};
   return recordable_ != nullptr;
 }
+
+template class BasicSpan<std::mutex>;
+template class BasicSpan<common::SpinLockMutex>;
 }  // namespace trace
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
@@ -5,6 +5,7 @@
 
 #include <mutex>
 
+#include "opentelemetry/common/spin_lock_mutex.h"
 #include "opentelemetry/sdk/trace/tracer.h"
 #include "opentelemetry/version.h"
 
@@ -13,18 +14,24 @@ namespace sdk
 {
 namespace trace
 {
-class Span final : public opentelemetry::trace::Span
+/**
+ * The SDK span, whose recordable is guarded by a MutexType.
+ *
+ * See the span_spin_lock option of TracerContext.
+ */
+template <class MutexType>
+class BasicSpan final : public opentelemetry::trace::Span
 {
 public:
-  Span(std::shared_ptr<Tracer> &&tracer,
-       nostd::string_view name,
-       const opentelemetry::common::KeyValueIterable &attributes,
-       const opentelemetry::trace::SpanContextKeyValueIterable &links,
-       const opentelemetry::trace::StartSpanOptions &options,
-       const opentelemetry::trace::SpanContext &parent_span_context,
-       std::unique_ptr<opentelemetry::trace::SpanContext> span_context) noexcept;
+  BasicSpan(std::shared_ptr<Tracer> &&tracer,
+            nostd::string_view name,
+            const opentelemetry::common::KeyValueIterable &attributes,
+            const opentelemetry::trace::SpanContextKeyValueIterable &links,
+            const opentelemetry::trace::StartSpanOptions &options,
+            const opentelemetry::trace::SpanContext &parent_span_context,
+            const opentelemetry::trace::SpanContext &span_context) noexcept;
 
-  ~Span() override;
+  ~BasicSpan() override;
 
   // opentelemetry::trace::Span
   void SetAttribute(nostd::string_view key,
@@ -60,17 +67,20 @@ class Span final : public opentelemetry::trace::Span
 
   opentelemetry::trace::SpanContext GetContext() const noexcept override
   {
-    return *span_context_.get();
+    return span_context_;
   }
 
 private:
   std::shared_ptr<Tracer> tracer_;
-  mutable std::mutex mu_;
+  mutable MutexType mu_;
   std::unique_ptr<Recordable> recordable_;
   opentelemetry::common::SteadyTimestamp start_steady_time;
-  std::unique_ptr<opentelemetry::trace::SpanContext> span_context_;
+  opentelemetry::trace::SpanContext span_context_;
   bool has_ended_;
 };
+
+using Span         = BasicSpan<std::mutex>;
+using SpinLockSpan = BasicSpan<opentelemetry::common::SpinLockMutex>;
 }  // namespace trace
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
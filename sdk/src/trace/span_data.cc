@@ -0,0 +1,46 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/trace/span_data.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+// The spare attribute nodes depend on the standard library the SDK is built with, so these are
+// kept out of the header, where they could be compiled differently by the application.
+void SpanData::SetAttribute(opentelemetry::sdk::common::AttributeMap &attributes,
+                            nostd::string_view key,
+                            const opentelemetry::common::AttributeValue &value) noexcept
+{
+#ifdef __cpp_lib_node_extract
+  if (!spare_attributes_.empty())
+  {
+    // Reuse a spare node, and its key capacity, for the key
+    auto node = spare_attributes_.extract(spare_attributes_.begin());
+    node.key().assign(key.data(), key.size());
+    auto result = attributes.insert(std::move(node));
+    result.position->second = nostd::visit(opentelemetry::sdk::common::AttributeConverter(), value);
+    if (!result.inserted)
+    {
+      spare_attributes_.insert(std::move(result.node));
+    }
+    return;
+  }
+#endif
+  attributes.SetAttribute(key, value);
+}
+
+void SpanData::ClearAttributes(opentelemetry::sdk::common::AttributeMap &attributes) noexcept
+{
+#ifdef __cpp_lib_node_extract
+  spare_attributes_.merge(attributes);
+#endif
+  attributes.clear();
+}
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,65 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/trace/span_data_pool.h"
+
+#include <mutex>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+SpanDataPool::SpanDataPool(size_t max_size) noexcept : max_size_(max_size) {}
+
+std::unique_ptr<Recordable> SpanDataPool::MakeRecordable() noexcept
+{
+  {
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+    if (!free_recordables_.empty())
+    {
+      std::unique_ptr<Recordable> recordable(free_recordables_.back().release());
+      free_recordables_.pop_back();
+      return recordable;
+    }
+  }
+  return std::unique_ptr<Recordable>(new SpanData);
+}
+
+void SpanDataPool::Recycle(const nostd::span<std::unique_ptr<Recordable>> &recordables) noexcept
+{
+  // Reset the recordables outside of the lock, as it releases their attributes, events and links.
+  std::vector<std::unique_ptr<SpanData>> reset_recordables;
+  reset_recordables.reserve(recordables.size());
+  for (auto &recordable : recordables)
+  {
+    if (recordable == nullptr)
+    {
+      continue;
+    }
+    std::unique_ptr<SpanData> span_data(static_cast<SpanData *>(recordable.release()));
+    span_data->Reset();
+    reset_recordables.push_back(std::move(span_data));
+  }
+
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  for (auto &span_data : reset_recordables)
+  {
+    if (free_recordables_.size() >= max_size_)
+    {
+      break;
+    }
+    free_recordables_.push_back(std::move(span_data));
+  }
+}
+
+size_t SpanDataPool::GetSize() noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  return free_recordables_.size();
+}
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -8,11 +8,80 @@
 
 #include "src/trace/span.h"
 
+#include <memory>
+#include <new>
+
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
 {
 namespace trace
 {
+namespace
+{
+/**
+ * The span returned when the sampler drops a span. Unlike NoopSpan, the span context is stored in
+ * the span itself, and the span does not keep the tracer alive.
+ */
+class NonRecordingSpan final : public opentelemetry::trace::Span
+{
+public:
+  explicit NonRecordingSpan(const opentelemetry::trace::SpanContext &span_context) noexcept
+      : span_context_(span_context)
+  {}
+
+  void SetAttribute(nostd::string_view /* key */,
+                    const opentelemetry::common::AttributeValue & /* value */) noexcept override
+  {}
+
+  void AddEvent(nostd::string_view /* name */) noexcept override {}
+
+  void AddEvent(nostd::string_view /* name */,
+                opentelemetry::common::SystemTimestamp /* timestamp */) noexcept override
+  {}
+
+  void AddEvent(nostd::string_view /* name */,
+                const opentelemetry::common::KeyValueIterable & /* attributes */) noexcept override
+  {}
+
+  void AddEvent(nostd::string_view /* name */,
+                opentelemetry::common::SystemTimestamp /* timestamp */,
+                const opentelemetry::common::KeyValueIterable & /* attributes */) noexcept override
+  {}
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  void AddLink(const opentelemetry::trace::SpanContext & /* target */,
+               const opentelemetry::common::KeyValueIterable & /* attrs */) noexcept override
+  {}
+
+  void AddLinks(
+      const opentelemetry::trace::SpanContextKeyValueIterable & /* links */) noexcept override
+  {}
+#endif
+
+  void SetStatus(opentelemetry::trace::StatusCode /* code */,
+                 nostd::string_view /* description */) noexcept override
+  {}
+
+  void UpdateName(nostd::string_view /* name */) noexcept override {}
+
+  void End(const opentelemetry::trace::EndSpanOptions & /* options */) noexcept override {}
+
+  bool IsRecording() const noexcept override { return false; }
+
+  opentelemetry::trace::SpanContext GetContext() const noexcept override { return span_context_; }
+
+private:
+  const opentelemetry::trace::SpanContext span_context_;
+};
+
+// The span returned when a span cannot be allocated.
+nostd::shared_ptr<opentelemetry::trace::Span> GetNoopSpan() noexcept
+{
+  static nostd::shared_ptr<opentelemetry::trace::Span> noop_span(
+      new NonRecordingSpan(opentelemetry::trace::SpanContext::GetInvalid()));
+  return noop_span;
+}
+}  // namespace
 
 Tracer::Tracer(std::shared_ptr<TracerContext> context,
                std::unique_ptr<InstrumentationScope> instrumentation_scope) noexcept
@@ -25,32 +94,37 @@ nostd::shared_ptr<opentelemetry::trace::Span> Tracer::StartSpan(
     const opentelemetry::trace::SpanContextKeyValueIterable &links,
     const opentelemetry::trace::StartSpanOptions &options) noexcept
 {
-  opentelemetry::trace::SpanContext parent_context = GetCurrentSpan()->GetContext();
+  // The current span is only looked up when the options do not provide the parent.
+  opentelemetry::trace::SpanContext parent_context{false, false};
+  bool use_current_span = true;
   if (nostd::holds_alternative<opentelemetry::trace::SpanContext>(options.parent))
   {
-    auto span_context = nostd::get<opentelemetry::trace::SpanContext>(options.parent);
+    const auto &span_context = nostd::get<opentelemetry::trace::SpanContext>(options.parent);
     if (span_context.IsValid())
     {
-      parent_context = span_context;
+      parent_context   = span_context;
+      use_current_span = false;
     }
   }
   else if (nostd::holds_alternative<context::Context>(options.parent))
   {
-    auto context = nostd::get<context::Context>(options.parent);
+    const auto &context = nostd::get<context::Context>(options.parent);
     // fetch span context from parent span stored in the context
     auto span_context = opentelemetry::trace::GetSpan(context)->GetContext();
     if (span_context.IsValid())
     {
-      parent_context = span_context;
+      parent_context   = span_context;
+      use_current_span = false;
     }
     else
     {
-      if (opentelemetry::trace::IsRootSpan(context))
-      {
-        parent_context = opentelemetry::trace::SpanContext{false, false};
-      }
+      use_current_span = !opentelemetry::trace::IsRootSpan(context);
     }
   }
+  if (use_current_span)
+  {
+    parent_context = GetCurrentSpan()->GetContext();
+  }
 
   opentelemetry::trace::TraceId trace_id;
   opentelemetry::trace::SpanId span_id = GetIdGenerator().GenerateSpanId();
@@ -73,29 +147,43 @@ nostd::shared_ptr<opentelemetry::trace::Span> Tracer::StartSpan(
           ? opentelemetry::trace::TraceFlags{opentelemetry::trace::TraceFlags::kIsSampled}
           : opentelemetry::trace::TraceFlags{};
 
-  auto span_context =
-      std::unique_ptr<opentelemetry::trace::SpanContext>(new opentelemetry::trace::SpanContext(
-          trace_id, span_id, trace_flags, false,
-          sampling_result.trace_state
-              ? sampling_result.trace_state
-              : is_parent_span_valid ? parent_context.trace_state()
-                                     : opentelemetry::trace::TraceState::GetDefault()));
+  opentelemetry::trace::SpanContext span_context(
+      trace_id, span_id, trace_flags, false,
+      sampling_result.trace_state
+          ? sampling_result.trace_state
+          : is_parent_span_valid ? parent_context.trace_state()
+                                 : opentelemetry::trace::TraceState::GetDefault());
 
   if (!sampling_result.IsRecording())
   {
     // create no-op span with valid span-context.
-
     auto noop_span = nostd::shared_ptr<opentelemetry::trace::Span>{
-        new (std::nothrow)
-            opentelemetry::trace::NoopSpan(this->shared_from_this(), std::move(span_context))};
+        new (std::nothrow) NonRecordingSpan(span_context)};
+    if (!noop_span)
+    {
+      return GetNoopSpan();
+    }
     return noop_span;
   }
   else
   {
-
-    auto span = nostd::shared_ptr<opentelemetry::trace::Span>{
-        new (std::nothrow) Span{this->shared_from_this(), name, attributes, links, options,
-                                parent_context, std::move(span_context)}};
+    nostd::shared_ptr<opentelemetry::trace::Span> span;
+    if (context_->GetSpanSpinLock())
+    {
+      span = nostd::shared_ptr<opentelemetry::trace::Span>{
+          new (std::nothrow) SpinLockSpan{this->shared_from_this(), name, attributes, links,
+                                          options, parent_context, span_context}};
+    }
+    else
+    {
+      span = nostd::shared_ptr<opentelemetry::trace::Span>{
+          new (std::nothrow) Span{this->shared_from_this(), name, attributes, links, options,
+                                  parent_context, span_context}};
+    }
+    if (!span)
+    {
+      return GetNoopSpan();
+    }
 
     // if the attributes is not nullptr, add attributes to the span.
     if (sampling_result.attributes)
@@ -14,11 +14,13 @@ namespace resource = opentelemetry::sdk::resource;
 TracerContext::TracerContext(std::vector<std::unique_ptr<SpanProcessor>> &&processors,
                              resource::Resource resource,
                              std::unique_ptr<Sampler> sampler,
-                             std::unique_ptr<IdGenerator> id_generator) noexcept
+                             std::unique_ptr<IdGenerator> id_generator,
+                             bool span_spin_lock) noexcept
     : resource_(resource),
       sampler_(std::move(sampler)),
       id_generator_(std::move(id_generator)),
-      processor_(std::unique_ptr<SpanProcessor>(new MultiSpanProcessor(std::move(processors))))
+      processor_(std::unique_ptr<SpanProcessor>(new MultiSpanProcessor(std::move(processors)))),
+      span_spin_lock_(span_spin_lock)
 {}
 
 Sampler &TracerContext::GetSampler() const noexcept
@@ -36,6 +38,11 @@ opentelemetry::sdk::trace::IdGenerator &TracerContext::GetIdGenerator() const no
   return *id_generator_;
 }
 
+bool TracerContext::GetSpanSpinLock() const noexcept
+{
+  return span_spin_lock_;
+}
+
 void TracerContext::AddProcessor(std::unique_ptr<SpanProcessor> processor) noexcept
 {
 
@@ -43,8 +43,21 @@ std::unique_ptr<TracerContext> TracerContextFactory::Create(
     std::unique_ptr<Sampler> sampler,
     std::unique_ptr<IdGenerator> id_generator)
 {
-  std::unique_ptr<TracerContext> context(new TracerContext(
-      std::move(processors), resource, std::move(sampler), std::move(id_generator)));
+  return Create(std::move(processors), resource, std::move(sampler), std::move(id_generator),
+                false);
+}
+
+std::unique_ptr<TracerContext> TracerContextFactory::Create(
+    std::vector<std::unique_ptr<SpanProcessor>> &&processors,
+    const opentelemetry::sdk::resource::Resource &resource,
+    std::unique_ptr<Sampler> sampler,
+    std::unique_ptr<IdGenerator> id_generator,
+    bool span_spin_lock)
+{
+  std::unique_ptr<TracerContext> context(new TracerContext(std::move(processors), resource,
+                                                           std::move(sampler),
+                                                           std::move(id_generator),
+                                                           span_spin_lock));
   return context;
 }
 
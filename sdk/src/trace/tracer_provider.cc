@@ -25,21 +25,23 @@ TracerProvider::TracerProvider(std::unique_ptr<TracerContext> context) noexcept
 TracerProvider::TracerProvider(std::unique_ptr<SpanProcessor> processor,
                                resource::Resource resource,
                                std::unique_ptr<Sampler> sampler,
-                               std::unique_ptr<IdGenerator> id_generator) noexcept
+                               std::unique_ptr<IdGenerator> id_generator,
+                               bool span_spin_lock) noexcept
 {
   std::vector<std::unique_ptr<SpanProcessor>> processors;
   processors.push_back(std::move(processor));
   context_ = std::make_shared<TracerContext>(std::move(processors), resource, std::move(sampler),
-                                             std::move(id_generator));
+                                             std::move(id_generator), span_spin_lock);
 }
 
 TracerProvider::TracerProvider(std::vector<std::unique_ptr<SpanProcessor>> &&processors,
                                resource::Resource resource,
                                std::unique_ptr<Sampler> sampler,
-                               std::unique_ptr<IdGenerator> id_generator) noexcept
+                               std::unique_ptr<IdGenerator> id_generator,
+                               bool span_spin_lock) noexcept
 {
   context_ = std::make_shared<TracerContext>(std::move(processors), resource, std::move(sampler),
-                                             std::move(id_generator));
+                                             std::move(id_generator), span_spin_lock);
 }
 
 TracerProvider::~TracerProvider()
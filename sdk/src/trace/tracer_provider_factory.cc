@@ -47,8 +47,19 @@ std::unique_ptr<opentelemetry::trace::TracerProvider> TracerProviderFactory::Cre
     std::unique_ptr<Sampler> sampler,
     std::unique_ptr<IdGenerator> id_generator)
 {
-  std::unique_ptr<trace_api::TracerProvider> provider(new trace_sdk::TracerProvider(
-      std::move(processor), resource, std::move(sampler), std::move(id_generator)));
+  return Create(std::move(processor), resource, std::move(sampler), std::move(id_generator), false);
+}
+
+std::unique_ptr<opentelemetry::trace::TracerProvider> TracerProviderFactory::Create(
+    std::unique_ptr<SpanProcessor> processor,
+    const opentelemetry::sdk::resource::Resource &resource,
+    std::unique_ptr<Sampler> sampler,
+    std::unique_ptr<IdGenerator> id_generator,
+    bool span_spin_lock)
+{
+  std::unique_ptr<trace_api::TracerProvider> provider(
+      new trace_sdk::TracerProvider(std::move(processor), resource, std::move(sampler),
+                                    std::move(id_generator), span_spin_lock));
   return provider;
 }
 
@@ -82,8 +93,20 @@ std::unique_ptr<opentelemetry::trace::TracerProvider> TracerProviderFactory::Cre
     std::unique_ptr<Sampler> sampler,
     std::unique_ptr<IdGenerator> id_generator)
 {
-  std::unique_ptr<trace_api::TracerProvider> provider(new trace_sdk::TracerProvider(
-      std::move(processors), resource, std::move(sampler), std::move(id_generator)));
+  return Create(std::move(processors), resource, std::move(sampler), std::move(id_generator),
+                false);
+}
+
+std::unique_ptr<opentelemetry::trace::TracerProvider> TracerProviderFactory::Create(
+    std::vector<std::unique_ptr<SpanProcessor>> &&processors,
+    const opentelemetry::sdk::resource::Resource &resource,
+    std::unique_ptr<Sampler> sampler,
+    std::unique_ptr<IdGenerator> id_generator,
+    bool span_spin_lock)
+{
+  std::unique_ptr<trace_api::TracerProvider> provider(
+      new trace_sdk::TracerProvider(std::move(processors), resource, std::move(sampler),
+                                    std::move(id_generator), span_spin_lock));
   return provider;
 }
 
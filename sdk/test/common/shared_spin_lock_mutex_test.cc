@@ -0,0 +1,53 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/common/shared_spin_lock_mutex.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using opentelemetry::sdk::common::SharedSpinLockGuard;
+using opentelemetry::sdk::common::SharedSpinLockMutex;
+
+TEST(SharedSpinLockMutexTest, ReadersShareTheLock)
+{
+  SharedSpinLockMutex mutex;
+  SharedSpinLockGuard first(mutex);
+  std::thread reader([&mutex]() { SharedSpinLockGuard second(mutex); });
+  reader.join();
+}
+
+TEST(SharedSpinLockMutexTest, WritersAreExclusive)
+{
+  SharedSpinLockMutex mutex;
+  std::atomic<int> readers{0};
+  bool overlapped = false;
+  int value       = 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++)
+  {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 1000; j++)
+      {
+        {
+          std::lock_guard<SharedSpinLockMutex> guard(mutex);
+          overlapped = overlapped || readers.load() != 0;
+          ++value;
+        }
+        SharedSpinLockGuard guard(mutex);
+        readers.fetch_add(1);
+        readers.fetch_sub(1);
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_FALSE(overlapped);
+  EXPECT_EQ(value, 4000);
+}
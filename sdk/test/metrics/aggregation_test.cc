@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
 #include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/histogram_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/lastvalue_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/sum_aggregation.h"
@@ -218,3 +222,296 @@ TEST(Aggregation, DoubleHistogramAggregation)
   EXPECT_EQ(histogram_data.counts_[4], 0);  // aggr2(28.1) - aggr1(25.1)
   EXPECT_EQ(histogram_data.counts_[7], 1);  // aggr2(105.0) - aggr1(0)
 }
+
+TEST(Aggregation, Base2ExponentialHistogramAggregation)
+{
+  Base2ExponentialHistogramAggregationConfig config;
+  config.max_scale_   = 0;
+  config.max_buckets_ = 4;
+  Base2ExponentialHistogramAggregation aggr(&config);
+  auto data = aggr.ToPoint();
+  ASSERT_TRUE(nostd::holds_alternative<ExponentialHistogramPointData>(data));
+  auto histogram_data = nostd::get<ExponentialHistogramPointData>(data);
+  EXPECT_EQ(histogram_data.count_, 0);
+  EXPECT_EQ(histogram_data.scale_, 0);
+  EXPECT_TRUE(histogram_data.positive_buckets_.counts_.empty());
+
+  aggr.Aggregate(2.0, {});         // (1, 2] at scale 0
+  aggr.Aggregate(int64_t{4}, {});  // (2, 4]
+  aggr.Aggregate(8.0, {});         // (4, 8]
+  aggr.Aggregate(0.0, {});
+  aggr.Aggregate(-3.0, {});
+  histogram_data = nostd::get<ExponentialHistogramPointData>(aggr.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 5);
+  EXPECT_EQ(histogram_data.sum_, 11);
+  EXPECT_EQ(histogram_data.min_, -3);
+  EXPECT_EQ(histogram_data.max_, 8);
+  EXPECT_EQ(histogram_data.zero_count_, 1);
+  EXPECT_EQ(histogram_data.scale_, 0);
+  EXPECT_EQ(histogram_data.positive_buckets_.offset_, 0);
+  EXPECT_EQ(histogram_data.positive_buckets_.counts_, (std::vector<uint64_t>{1, 1, 1}));
+  EXPECT_EQ(histogram_data.negative_buckets_.offset_, 1);
+  EXPECT_EQ(histogram_data.negative_buckets_.counts_, (std::vector<uint64_t>{1}));
+
+  // 32 lies in bucket 4, which needs 5 buckets at scale 0: the scale is reduced to -1, where
+  // buckets are (1, 4], (4, 16], (16, 64].
+  aggr.Aggregate(32.0, {});
+  histogram_data = nostd::get<ExponentialHistogramPointData>(aggr.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 6);
+  EXPECT_EQ(histogram_data.scale_, -1);
+  EXPECT_EQ(histogram_data.positive_buckets_.offset_, 0);
+  EXPECT_EQ(histogram_data.positive_buckets_.counts_, (std::vector<uint64_t>{2, 1, 1}));
+  EXPECT_EQ(histogram_data.negative_buckets_.offset_, 0);
+  EXPECT_EQ(histogram_data.negative_buckets_.counts_, (std::vector<uint64_t>{1}));
+
+  // Non finite values are ignored
+  aggr.Aggregate(std::numeric_limits<double>::infinity(), {});
+  aggr.Aggregate(std::numeric_limits<double>::quiet_NaN(), {});
+  histogram_data = nostd::get<ExponentialHistogramPointData>(aggr.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 6);
+
+  // Merge, at the lowest scale of both aggregations
+  Base2ExponentialHistogramAggregation aggr1(&config);
+  aggr1.Aggregate(2.0, {});
+  aggr1.Aggregate(4.0, {});
+  auto aggr2     = aggr.Merge(aggr1);
+  histogram_data = nostd::get<ExponentialHistogramPointData>(aggr2->ToPoint());
+  EXPECT_EQ(histogram_data.count_, 8);
+  EXPECT_EQ(histogram_data.sum_, 49);
+  EXPECT_EQ(histogram_data.scale_, -1);
+  EXPECT_EQ(histogram_data.zero_count_, 1);
+  EXPECT_EQ(histogram_data.positive_buckets_.offset_, 0);
+  EXPECT_EQ(histogram_data.positive_buckets_.counts_, (std::vector<uint64_t>{4, 1, 1}));
+  EXPECT_EQ(histogram_data.negative_buckets_.counts_, (std::vector<uint64_t>{1}));
+  EXPECT_EQ(histogram_data.min_, -3);
+  EXPECT_EQ(histogram_data.max_, 32);
+
+  // Recording into the merged aggregation keeps its scale
+  aggr2->Aggregate(64.0, {});
+  histogram_data = nostd::get<ExponentialHistogramPointData>(aggr2->ToPoint());
+  EXPECT_EQ(histogram_data.scale_, -1);
+  EXPECT_EQ(histogram_data.positive_buckets_.counts_, (std::vector<uint64_t>{4, 1, 2}));
+
+  // Diff
+  auto aggr3     = aggr1.Diff(*aggr2);
+  histogram_data = nostd::get<ExponentialHistogramPointData>(aggr3->ToPoint());
+  EXPECT_EQ(histogram_data.count_, 7);
+  EXPECT_EQ(histogram_data.scale_, -1);
+  EXPECT_EQ(histogram_data.zero_count_, 1);
+  EXPECT_EQ(histogram_data.positive_buckets_.offset_, 0);
+  EXPECT_EQ(histogram_data.positive_buckets_.counts_, (std::vector<uint64_t>{2, 1, 2}));
+  EXPECT_EQ(histogram_data.negative_buckets_.counts_, (std::vector<uint64_t>{1}));
+}
+
+TEST(Aggregation, Base2ExponentialHistogramAggregationFullRange)
+{
+  Base2ExponentialHistogramAggregationConfig config;
+  config.max_buckets_ = 2;
+  Base2ExponentialHistogramAggregation aggr(&config);
+
+  // The smallest subnormal and the largest double span three buckets at the minimum scale
+  aggr.Aggregate(std::numeric_limits<double>::denorm_min(), {});
+  aggr.Aggregate((std::numeric_limits<double>::min)(), {});
+  aggr.Aggregate((std::numeric_limits<double>::max)(), {});
+  auto histogram_data = nostd::get<ExponentialHistogramPointData>(aggr.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 3);
+  EXPECT_EQ(histogram_data.max_buckets_, 3);
+  EXPECT_EQ(histogram_data.scale_, -10);
+  EXPECT_EQ(histogram_data.positive_buckets_.offset_, -2);
+  EXPECT_EQ(histogram_data.positive_buckets_.counts_, (std::vector<uint64_t>{1, 1, 1}));
+}
+
+TEST(Aggregation, LongAtomicSumAggregation)
+{
+  LongAtomicSumAggregation aggr(true);
+  auto sum_data = nostd::get<SumPointData>(aggr.ToPoint());
+  ASSERT_TRUE(nostd::holds_alternative<int64_t>(sum_data.value_));
+  EXPECT_EQ(nostd::get<int64_t>(sum_data.value_), 0);
+  aggr.Aggregate((int64_t)12, {});
+  aggr.Aggregate((int64_t)-1, {});  // ignored for monotonic sums
+  sum_data = nostd::get<SumPointData>(aggr.ToPoint());
+  EXPECT_EQ(nostd::get<int64_t>(sum_data.value_), 12);
+  EXPECT_TRUE(sum_data.is_monotonic_);
+
+  // Merge and Diff accept the lock based aggregation
+  LongSumAggregation aggr1(true);
+  aggr1.Aggregate((int64_t)30, {});
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(aggr.Merge(aggr1)->ToPoint()).value_),
+            42);
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(aggr.Diff(aggr1)->ToPoint()).value_),
+            18);
+}
+
+TEST(Aggregation, DoubleAtomicSumAggregation)
+{
+  DoubleAtomicSumAggregation aggr(false);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++)
+  {
+    threads.emplace_back([&aggr]() {
+      for (int j = 0; j < 1000; j++)
+      {
+        aggr.Aggregate(0.5, {});
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  aggr.Aggregate(-1.0, {});
+  auto sum_data = nostd::get<SumPointData>(aggr.ToPoint());
+  ASSERT_TRUE(nostd::holds_alternative<double>(sum_data.value_));
+  EXPECT_EQ(nostd::get<double>(sum_data.value_), 1999.0);
+  EXPECT_FALSE(sum_data.is_monotonic_);
+}
+
+TEST(Aggregation, LongAtomicHistogramAggregation)
+{
+  LongAtomicHistogramAggregation aggr;
+  auto histogram_data = nostd::get<HistogramPointData>(aggr.ToPoint());
+  ASSERT_TRUE(nostd::holds_alternative<int64_t>(histogram_data.sum_));
+  EXPECT_EQ(histogram_data.count_, 0);
+  EXPECT_EQ(histogram_data.counts_.size(), 16);
+
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < 4; i++)
+  {
+    threads.emplace_back([&aggr, i]() {
+      for (int j = 0; j < 1000; j++)
+      {
+        aggr.Aggregate(i * 100 + 12, {});  // lies in the buckets at index 3, 7 and 8
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  histogram_data = nostd::get<HistogramPointData>(aggr.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 4000);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.sum_), 648000);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.min_), 12);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.max_), 312);
+  EXPECT_EQ(histogram_data.counts_[3], 1000);
+  EXPECT_EQ(histogram_data.counts_[7], 2000);
+  EXPECT_EQ(histogram_data.counts_[8], 1000);
+
+  // Merge
+  LongHistogramAggregation aggr1;
+  aggr1.Aggregate((int64_t)1, {});
+  aggr1.Aggregate((int64_t)500, {});
+  auto aggr2     = aggr.Merge(aggr1);
+  histogram_data = nostd::get<HistogramPointData>(aggr2->ToPoint());
+  EXPECT_EQ(histogram_data.count_, 4002);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.sum_), 648501);
+  EXPECT_EQ(histogram_data.counts_[1], 1);
+  EXPECT_EQ(histogram_data.counts_[8], 1001);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.min_), 1);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.max_), 500);
+
+  // Diff
+  auto aggr3     = aggr.Diff(*aggr2);
+  histogram_data = nostd::get<HistogramPointData>(aggr3->ToPoint());
+  EXPECT_EQ(histogram_data.count_, 2);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.sum_), 501);
+  EXPECT_EQ(histogram_data.counts_[1], 1);
+  EXPECT_EQ(histogram_data.counts_[3], 0);
+  EXPECT_EQ(histogram_data.counts_[8], 1);
+}
+
+TEST(Aggregation, DoubleAtomicHistogramAggregation)
+{
+  HistogramAggregationConfig config;
+  config.boundaries_ = {10.0, 20.0};
+  config.lock_free_  = true;
+  DoubleAtomicHistogramAggregation aggr(&config);
+  aggr.Aggregate(-5.0, {});
+  aggr.Aggregate(15.5, {});
+  aggr.Aggregate(42.0, {});
+  auto histogram_data = nostd::get<HistogramPointData>(aggr.ToPoint());
+  EXPECT_EQ(histogram_data.boundaries_, config.boundaries_);
+  EXPECT_EQ(histogram_data.counts_, (std::vector<uint64_t>{1, 1, 1}));
+  EXPECT_EQ(histogram_data.count_, 3);
+  EXPECT_EQ(nostd::get<double>(histogram_data.sum_), 52.5);
+  EXPECT_EQ(nostd::get<double>(histogram_data.min_), -5.0);
+  EXPECT_EQ(nostd::get<double>(histogram_data.max_), 42.0);
+}
+
+TEST(Aggregation, MergeInPlace)
+{
+  LongSumAggregation sum(true);
+  sum.Aggregate((int64_t)10, {});
+  LongAtomicSumAggregation atomic_sum(true);
+  atomic_sum.Aggregate((int64_t)5, {});
+  EXPECT_TRUE(sum.MergeInPlace(atomic_sum));
+  EXPECT_TRUE(atomic_sum.MergeInPlace(sum));
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(sum.ToPoint()).value_), 15);
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(atomic_sum.ToPoint()).value_), 20);
+
+  HistogramAggregationConfig config;
+  config.boundaries_ = {10.0, 100.0};
+  DoubleHistogramAggregation histogram(&config);
+  histogram.Aggregate(5.0, {});
+  DoubleHistogramAggregation delta(&config);
+  delta.Aggregate(50.0, {});
+  delta.Aggregate(500.0, {});
+  EXPECT_TRUE(histogram.MergeInPlace(delta));
+  auto histogram_data = nostd::get<HistogramPointData>(histogram.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 3);
+  EXPECT_EQ(nostd::get<double>(histogram_data.sum_), 555.0);
+  EXPECT_EQ(nostd::get<double>(histogram_data.min_), 5.0);
+  EXPECT_EQ(nostd::get<double>(histogram_data.max_), 500.0);
+  EXPECT_EQ(histogram_data.counts_, (std::vector<uint64_t>{1, 1, 1}));
+
+  // Histograms with different boundaries are not merged in place.
+  DoubleHistogramAggregation other(nullptr);
+  EXPECT_FALSE(histogram.MergeInPlace(other));
+
+  // Aggregations without in place merge fall back to Merge.
+  Base2ExponentialHistogramAggregation exponential;
+  EXPECT_FALSE(exponential.MergeInPlace(exponential));
+}
+
+TEST(Aggregation, Reset)
+{
+  LongSumAggregation sum(true);
+  sum.Aggregate((int64_t)10, {});
+  EXPECT_TRUE(sum.Reset());
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(sum.ToPoint()).value_), 0);
+
+  DoubleLastValueAggregation last_value;
+  last_value.Aggregate(1.5, {});
+  EXPECT_TRUE(last_value.Reset());
+  EXPECT_FALSE(nostd::get<LastValuePointData>(last_value.ToPoint()).is_lastvalue_valid_);
+
+  HistogramAggregationConfig config;
+  config.boundaries_ = {10.0, 100.0};
+  LongAtomicHistogramAggregation atomic_histogram(&config);
+  atomic_histogram.Aggregate((int64_t)50, {});
+  EXPECT_TRUE(atomic_histogram.Reset());
+  atomic_histogram.Aggregate((int64_t)-1, {});
+  auto histogram_data = nostd::get<HistogramPointData>(atomic_histogram.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 1);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.sum_), -1);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.min_), -1);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.max_), -1);
+  EXPECT_EQ(histogram_data.counts_, (std::vector<uint64_t>{1, 0, 0}));
+
+  // Merged in place into a histogram, from a histogram of the other kind.
+  LongHistogramAggregation histogram(&config);
+  histogram.Aggregate((int64_t)500, {});
+  EXPECT_TRUE(atomic_histogram.MergeInPlace(histogram));
+  EXPECT_TRUE(histogram.Reset());
+  EXPECT_TRUE(histogram.MergeInPlace(atomic_histogram));
+  histogram_data = nostd::get<HistogramPointData>(histogram.ToPoint());
+  EXPECT_EQ(histogram_data.count_, 2);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.sum_), 499);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.min_), -1);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.max_), 500);
+  EXPECT_EQ(histogram_data.counts_, (std::vector<uint64_t>{1, 0, 1}));
+
+  // Aggregations which can not be reset are recreated instead.
+  Base2ExponentialHistogramAggregation exponential;
+  EXPECT_FALSE(exponential.Reset());
+}
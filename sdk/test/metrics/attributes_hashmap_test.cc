@@ -73,3 +73,43 @@ TEST(AttributesHashMap, BasicTests)
       });
   EXPECT_EQ(count, hash_map.Size());
 }
+
+TEST(AttributesHashMap, ClearKeepsSeries)
+{
+  AttributesHashMap hash_map;
+  size_t created = 0;
+  std::function<std::unique_ptr<Aggregation>()> create_default_aggregation =
+      [&created]() -> std::unique_ptr<Aggregation> {
+    created++;
+    return std::unique_ptr<Aggregation>(new DropAggregation);
+  };
+  MetricAttributes m1 = {{"k1", "v1"}};
+  auto hash1          = opentelemetry::sdk::common::GetHashForAttributeMap(m1);
+  MetricAttributes m2 = {{"k2", "v2"}};
+  auto hash2          = opentelemetry::sdk::common::GetHashForAttributeMap(m2);
+
+  Aggregation *aggregation1 = hash_map.GetOrSetDefault(m1, create_default_aggregation, hash1);
+  hash_map.GetOrSetDefault(m2, create_default_aggregation, hash2);
+  EXPECT_EQ(created, 2);
+
+  // Cleared series are not visible, until they are set again with their aggregation.
+  hash_map.Clear();
+  EXPECT_EQ(hash_map.Size(), 0);
+  EXPECT_FALSE(hash_map.Has(hash1));
+  EXPECT_EQ(hash_map.Get(hash1), nullptr);
+  EXPECT_TRUE(hash_map.GetAllEnteries(
+      [](const MetricAttributes & /* attributes */, Aggregation & /* aggregation */) {
+        ADD_FAILURE();
+        return true;
+      }));
+  EXPECT_EQ(hash_map.GetOrSetDefault(m1, create_default_aggregation, hash1), aggregation1);
+  EXPECT_EQ(created, 2);
+  EXPECT_EQ(hash_map.Size(), 1);
+
+  // The series not set since the previous Clear are removed.
+  hash_map.Clear();
+  hash_map.GetOrSetDefault(m2, create_default_aggregation, hash2);
+  EXPECT_EQ(created, 3);
+  EXPECT_EQ(hash_map.GetOrSetDefault(m1, create_default_aggregation, hash1), aggregation1);
+  EXPECT_EQ(hash_map.Size(), 2);
+}
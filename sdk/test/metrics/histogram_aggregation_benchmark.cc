@@ -3,14 +3,21 @@
 
 #include "common.h"
 
+#include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/sdk/metrics/meter.h"
 #include "opentelemetry/sdk/metrics/meter_context.h"
 #include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/sdk/metrics/view/instrument_selector.h"
+#include "opentelemetry/sdk/metrics/view/meter_selector.h"
+#include "opentelemetry/sdk/metrics/view/view.h"
 
 #include <benchmark/benchmark.h>
+#include <cmath>
 #include <random>
 
 using namespace opentelemetry;
@@ -19,6 +26,34 @@ using namespace opentelemetry::sdk::metrics;
 
 namespace
 {
+
+// Boundary layouts covering each lookup strategy of the HistogramBucketIndexer, for measurements
+// in [0, 1000000]: the 15 default boundaries, 50 exponential boundaries and 200 uniform ones.
+std::vector<double> GetBoundaries(size_t size)
+{
+  std::vector<double> boundaries;
+  if (size == 15)
+  {
+    boundaries = {0.0,   5.0,   10.0,   25.0,   50.0,   75.0,   100.0,  250.0,
+                  500.0, 750.0, 1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
+  }
+  else if (size == 50)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      boundaries.push_back(std::pow(1.32, static_cast<double>(i)));
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      boundaries.push_back(5000.0 * static_cast<double>(i));
+    }
+  }
+  return boundaries;
+}
+
 void BM_HistogramAggregation(benchmark::State &state)
 {
   MeterProvider mp;
@@ -27,6 +62,16 @@ void BM_HistogramAggregation(benchmark::State &state)
   std::unique_ptr<MockMetricExporter> exporter(new MockMetricExporter());
   std::shared_ptr<MetricReader> reader{new MockMetricReader(std::move(exporter))};
   mp.AddMetricReader(reader);
+
+  std::shared_ptr<HistogramAggregationConfig> config(new HistogramAggregationConfig());
+  config->boundaries_ = GetBoundaries(static_cast<size_t>(state.range(0)));
+  std::unique_ptr<View> view{new View("view1", "view1_description", "histogram1_unit",
+                                      AggregationType::kHistogram, config)};
+  std::unique_ptr<InstrumentSelector> instrument_selector{
+      new InstrumentSelector(InstrumentType::kHistogram, "histogram1", "histogram1_unit")};
+  std::unique_ptr<MeterSelector> meter_selector{new MeterSelector("meter1", "version1", "schema1")};
+  mp.AddView(std::move(instrument_selector), std::move(meter_selector), std::move(view));
+
   auto h = m->CreateDoubleHistogram("histogram1", "histogram1_description", "histogram1_unit");
   std::default_random_engine generator;
   std::uniform_int_distribution<int> distribution(0, 1000000);
@@ -72,7 +117,45 @@ void BM_HistogramAggregation(benchmark::State &state)
   }
 }
 
-BENCHMARK(BM_HistogramAggregation);
+BENCHMARK(BM_HistogramAggregation)->Arg(15)->Arg(50)->Arg(200);
+
+std::vector<double> GetMeasurements()
+{
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int> distribution(0, 1000000);
+  std::vector<double> measurements(1024);
+  for (auto &measurement : measurements)
+  {
+    measurement = (double)distribution(generator);
+  }
+  return measurements;
+}
+
+void BM_HistogramBucketBinarySearch(benchmark::State &state)
+{
+  auto boundaries   = GetBoundaries(static_cast<size_t>(state.range(0)));
+  auto measurements = GetMeasurements();
+  size_t i          = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(BucketBinarySearch(measurements[i++ & 1023], boundaries));
+  }
+}
+
+BENCHMARK(BM_HistogramBucketBinarySearch)->Arg(15)->Arg(50)->Arg(200);
+
+void BM_HistogramBucketIndexer(benchmark::State &state)
+{
+  HistogramBucketIndexer indexer{GetBoundaries(static_cast<size_t>(state.range(0)))};
+  auto measurements = GetMeasurements();
+  size_t i          = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(indexer.ComputeIndex(measurements[i++ & 1023]));
+  }
+}
+
+BENCHMARK(BM_HistogramBucketIndexer)->Arg(15)->Arg(50)->Arg(200);
 
 }  // namespace
 BENCHMARK_MAIN();
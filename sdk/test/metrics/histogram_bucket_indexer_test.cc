@@ -0,0 +1,137 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace opentelemetry::sdk::metrics;
+
+namespace
+{
+
+size_t LowerBoundIndex(const std::vector<double> &boundaries, double value)
+{
+  return std::lower_bound(boundaries.begin(), boundaries.end(), value) - boundaries.begin();
+}
+
+// Checks that the indexer matches std::lower_bound on and around every boundary, on special
+// values, and on random values covering the range of the boundaries.
+void ExpectLowerBound(const std::vector<double> &boundaries)
+{
+  const HistogramBucketIndexer indexer{boundaries};
+  std::vector<double> values = {0.0,
+                                -1.0,
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::lowest()};
+  for (double boundary : boundaries)
+  {
+    values.push_back(boundary);
+    values.push_back(std::nextafter(boundary, -std::numeric_limits<double>::infinity()));
+    values.push_back(std::nextafter(boundary, std::numeric_limits<double>::infinity()));
+  }
+  std::default_random_engine generator;
+  std::uniform_real_distribution<double> distribution(boundaries.front() - 10,
+                                                      boundaries.back() + 10);
+  for (int i = 0; i < 1000; i++)
+  {
+    values.push_back(distribution(generator));
+  }
+
+  for (double value : values)
+  {
+    EXPECT_EQ(indexer.ComputeIndex(value), LowerBoundIndex(boundaries, value)) << value;
+  }
+  EXPECT_EQ(indexer.ComputeIndex(std::numeric_limits<double>::quiet_NaN()), 0);
+}
+
+std::vector<double> MakeBoundaries(size_t size, double start, double factor, double step)
+{
+  std::vector<double> boundaries;
+  double boundary = start;
+  for (size_t i = 0; i < size; i++)
+  {
+    boundaries.push_back(boundary);
+    boundary = boundary * factor + step;
+  }
+  return boundaries;
+}
+
+}  // namespace
+
+TEST(HistogramBucketIndexerTest, Empty)
+{
+  const HistogramBucketIndexer indexer{{}};
+  EXPECT_EQ(indexer.GetStrategy(), HistogramBucketIndexer::Strategy::kLinear);
+  EXPECT_EQ(indexer.ComputeIndex(-1.0), 0);
+  EXPECT_EQ(indexer.ComputeIndex(1.0), 0);
+}
+
+TEST(HistogramBucketIndexerTest, Linear)
+{
+  std::vector<double> boundaries = {0.0,   5.0,   10.0,   25.0,   50.0,   75.0,   100.0,  250.0,
+                                    500.0, 750.0, 1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
+  EXPECT_EQ(HistogramBucketIndexer{boundaries}.GetStrategy(),
+            HistogramBucketIndexer::Strategy::kLinear);
+  ExpectLowerBound(boundaries);
+  ExpectLowerBound({1.0});
+  ExpectLowerBound({-3.0, 2.0, 7.5});
+  ExpectLowerBound(MakeBoundaries(HistogramBucketIndexer::kMaxLinearBoundaries, 1, 1.5, 0));
+}
+
+TEST(HistogramBucketIndexerTest, Uniform)
+{
+  for (double step : {1.0, 0.1, 7.3})
+  {
+    auto boundaries = MakeBoundaries(200, -50, 1, step);
+    EXPECT_EQ(HistogramBucketIndexer{boundaries}.GetStrategy(),
+              HistogramBucketIndexer::Strategy::kUniform);
+    ExpectLowerBound(boundaries);
+  }
+}
+
+TEST(HistogramBucketIndexerTest, BinarySearch)
+{
+  for (size_t size : {17, 33, 50, 63})
+  {
+    auto boundaries = MakeBoundaries(size, 1, 1.1, 0);
+    EXPECT_EQ(HistogramBucketIndexer{boundaries}.GetStrategy(),
+              HistogramBucketIndexer::Strategy::kBinarySearch);
+    ExpectLowerBound(boundaries);
+  }
+}
+
+TEST(HistogramBucketIndexerTest, Eytzinger)
+{
+  for (size_t size : {64, 65, 200})
+  {
+    auto boundaries = MakeBoundaries(size, 1, 1.1, 0);
+    EXPECT_EQ(HistogramBucketIndexer{boundaries}.GetStrategy(),
+              HistogramBucketIndexer::Strategy::kEytzinger);
+    ExpectLowerBound(boundaries);
+  }
+}
+
+TEST(HistogramBucketIndexerTest, Copy)
+{
+  for (size_t size : {3, 50, 200})
+  {
+    auto boundaries = MakeBoundaries(size, 1, 1.1, 0);
+    HistogramBucketIndexer copy{{}};
+    {
+      const HistogramBucketIndexer indexer{boundaries};
+      copy = indexer;
+    }
+    const HistogramBucketIndexer copy_constructed{copy};
+    for (size_t i = 0; i < size; i++)
+    {
+      EXPECT_EQ(copy.ComputeIndex(boundaries[i]), i);
+      EXPECT_EQ(copy_constructed.ComputeIndex(boundaries[i]), i);
+    }
+  }
+}
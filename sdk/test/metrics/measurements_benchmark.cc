@@ -6,6 +6,8 @@
 #include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
+#include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 
 #include <benchmark/benchmark.h>
 #include <memory>
@@ -82,5 +84,62 @@ void BM_MeasurementsTest(benchmark::State &state)
 }
 BENCHMARK(BM_MeasurementsTest);
 
+// Records into a single counter storage from state.range(0) threads, with the storage split into
+// state.range(1) shards, to compare the throughput of the sharded and unsharded storage as the
+// number of recording threads grows.
+void BM_SyncMetricStorageThreads(benchmark::State &state)
+{
+  size_t num_threads              = static_cast<size_t>(state.range(0));
+  size_t shard_count              = static_cast<size_t>(state.range(1));
+  size_t measurements_per_thread  = 10000;
+  InstrumentDescriptor instr_desc = {"counter1", "counter1_description", "counter1_unit",
+                                     InstrumentType::kCounter, InstrumentValueType::kDouble};
+  DefaultAttributesProcessor attributes_processor;
+  SyncMetricStorage storage(instr_desc, AggregationType::kSum, &attributes_processor,
+                            ExemplarReservoir::GetNoExemplarReservoir(), nullptr,
+                            kAggregationCardinalityLimit, shard_count);
+  std::map<std::string, uint32_t> attributes[100];
+  size_t total_index = 0;
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    for (uint32_t j = 0; j < 10; j++)
+      attributes[total_index++] = {{"dim1", i}, {"dim2", j}};
+  }
+  std::vector<std::thread> threads;
+  while (state.KeepRunning())
+  {
+    threads.clear();
+    for (size_t i = 0; i < num_threads; i++)
+    {
+      threads.push_back(std::thread([&storage, &attributes, measurements_per_thread, i]() {
+        for (size_t j = 0; j < measurements_per_thread; j++)
+        {
+          storage.RecordDouble(
+              1.0,
+              opentelemetry::common::KeyValueIterableView<std::map<std::string, uint32_t>>(
+                  attributes[(i + j) % 100]),
+              opentelemetry::context::Context{});
+        }
+      }));
+    }
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_threads * measurements_per_thread);
+}
+BENCHMARK(BM_SyncMetricStorageThreads)
+    ->Args({1, 1})
+    ->Args({2, 1})
+    ->Args({2, 2})
+    ->Args({4, 1})
+    ->Args({4, 4})
+    ->Args({8, 1})
+    ->Args({8, 8})
+    ->Args({16, 1})
+    ->Args({16, 16})
+    ->UseRealTime();
+
 }  // namespace
 BENCHMARK_MAIN();
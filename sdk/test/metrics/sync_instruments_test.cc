@@ -2,14 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "opentelemetry/sdk/metrics/sync_instruments.h"
+#include "common.h"
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
 #include "opentelemetry/sdk/metrics/exemplar/no_exemplar_reservoir.h"
 #include "opentelemetry/sdk/metrics/state/multi_metric_storage.h"
+#include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
+#include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
 using namespace opentelemetry;
 using namespace opentelemetry::sdk::instrumentationscope;
@@ -140,3 +146,98 @@ TEST(SyncInstruments, DoubleHistogram)
   histogram.Record(10.10, opentelemetry::common::KeyValueIterableView<M>({}),
                    opentelemetry::context::Context{});
 }
+
+class BoundSyncInstrumentsTest : public ::testing::Test
+{
+protected:
+  // Returns a storage collected through the storage_ pointer once owned by an instrument.
+  std::unique_ptr<SyncWritableMetricStorage> CreateStorage(
+      const InstrumentDescriptor &instrument_descriptor)
+  {
+    storage_ = new SyncMetricStorage(instrument_descriptor, AggregationType::kDefault,
+                                     &attributes_processor_,
+                                     ExemplarReservoir::GetNoExemplarReservoir(), nullptr);
+    return std::unique_ptr<SyncWritableMetricStorage>(storage_);
+  }
+
+  std::vector<PointDataAttributes> Collect()
+  {
+    std::vector<PointDataAttributes> points;
+    std::vector<std::shared_ptr<CollectorHandle>> collectors{collector_};
+    storage_->Collect(collector_.get(), collectors, std::chrono::system_clock::now(),
+                      std::chrono::system_clock::now(), [&](const MetricData &metric_data) {
+                        for (const auto &point : metric_data.point_data_attr_)
+                        {
+                          points.push_back(point);
+                        }
+                        return true;
+                      });
+    return points;
+  }
+
+  DefaultAttributesProcessor attributes_processor_;
+  std::shared_ptr<CollectorHandle> collector_{
+      new MockCollectorHandle(AggregationTemporality::kCumulative)};
+  SyncMetricStorage *storage_ = nullptr;
+};
+
+TEST_F(BoundSyncInstrumentsTest, LongCounter)
+{
+  InstrumentDescriptor instrument_descriptor = {
+      "long_counter", "description", "1", InstrumentType::kCounter, InstrumentValueType::kLong};
+  LongCounter counter(instrument_descriptor, CreateStorage(instrument_descriptor));
+  M attributes = {{"abc", "123"}, {"xyz", "456"}};
+
+  auto bound_counter = counter.Bind(opentelemetry::common::KeyValueIterableView<M>(attributes));
+  bound_counter.Add(10);
+  counter.Add(5, opentelemetry::common::KeyValueIterableView<M>(attributes));
+
+  auto points = Collect();
+  ASSERT_EQ(points.size(), 1u);
+  EXPECT_EQ(nostd::get<std::string>(points[0].attributes.find("abc")->second), "123");
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(points[0].point_data).value_), 15);
+
+  // The cumulative point is still reported after an interval without measurements.
+  points = Collect();
+  ASSERT_EQ(points.size(), 1u);
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(points[0].point_data).value_), 15);
+}
+
+TEST_F(BoundSyncInstrumentsTest, DoubleUpDownCounterNetZero)
+{
+  InstrumentDescriptor instrument_descriptor = {"double_updowncounter", "description", "1",
+                                                InstrumentType::kUpDownCounter,
+                                                InstrumentValueType::kDouble};
+  DoubleUpDownCounter counter(instrument_descriptor, CreateStorage(instrument_descriptor));
+
+  auto bound_counter = counter.Bind(opentelemetry::common::KeyValueIterableView<M>({}));
+  bound_counter.Add(1.5);
+  bound_counter.Add(-1.5);
+
+  // A series recording a net zero delta is still reported.
+  auto points = Collect();
+  ASSERT_EQ(points.size(), 1u);
+  EXPECT_EQ(nostd::get<double>(nostd::get<SumPointData>(points[0].point_data).value_), 0.0);
+}
+
+TEST_F(BoundSyncInstrumentsTest, DoubleHistogram)
+{
+  InstrumentDescriptor instrument_descriptor = {"double_histogram", "description", "1",
+                                                InstrumentType::kHistogram,
+                                                InstrumentValueType::kDouble};
+  DoubleHistogram histogram(instrument_descriptor, CreateStorage(instrument_descriptor));
+
+  auto bound_histogram = histogram.Bind(
+      opentelemetry::common::KeyValueIterableView<M>({{"abc", "123"}, {"xyz", "456"}}));
+  bound_histogram.Record(10.10);
+  bound_histogram.Record(20.20);
+  bound_histogram.Record(-10.10);  // This is ignored.
+
+  auto points = Collect();
+  ASSERT_EQ(points.size(), 1u);
+  const auto &data = nostd::get<HistogramPointData>(points[0].point_data);
+  EXPECT_EQ(data.count_, 2u);
+  EXPECT_DOUBLE_EQ(nostd::get<double>(data.sum_), 30.30);
+  EXPECT_DOUBLE_EQ(nostd::get<double>(data.min_), 10.10);
+  EXPECT_DOUBLE_EQ(nostd::get<double>(data.max_), 20.20);
+}
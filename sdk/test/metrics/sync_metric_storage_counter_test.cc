@@ -13,6 +13,7 @@
 
 #include <gtest/gtest.h>
 #include <map>
+#include <thread>
 
 using namespace opentelemetry::sdk::metrics;
 using namespace opentelemetry::common;
@@ -302,3 +303,156 @@ INSTANTIATE_TEST_SUITE_P(WritableMetricStorageTestDouble,
                          WritableMetricStorageTestFixture,
                          ::testing::Values(AggregationTemporality::kCumulative,
                                            AggregationTemporality::kDelta));
+
+TEST_P(WritableMetricStorageTestFixture, ShardedLongCounterSumAggregation)
+{
+  AggregationTemporality temporality = GetParam();
+  auto sdk_start_ts                  = std::chrono::system_clock::now();
+  InstrumentDescriptor instr_desc    = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  std::map<std::string, std::string> attributes_get = {{"RequestType", "GET"}};
+  std::map<std::string, std::string> attributes_put = {{"RequestType", "PUT"}};
+  const size_t num_threads                          = 4;
+  const int64_t records_per_thread                  = 1000;
+
+  std::unique_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  opentelemetry::sdk::metrics::SyncMetricStorage storage(
+      instr_desc, AggregationType::kSum, default_attributes_processor.get(),
+      ExemplarReservoir::GetNoExemplarReservoir(), nullptr, kAggregationCardinalityLimit,
+      num_threads);
+
+  std::shared_ptr<CollectorHandle> collector(new MockCollectorHandle(temporality));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.push_back(collector);
+
+  for (int collection = 1; collection <= 2; collection++)
+  {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_threads; i++)
+    {
+      threads.push_back(std::thread([&]() {
+        for (int64_t j = 0; j < records_per_thread; j++)
+        {
+          storage.RecordLong(
+              1, KeyValueIterableView<std::map<std::string, std::string>>(attributes_get),
+              opentelemetry::context::Context{});
+          storage.RecordLong(
+              2, KeyValueIterableView<std::map<std::string, std::string>>(attributes_put),
+              opentelemetry::context::Context{});
+        }
+      }));
+    }
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+
+    int64_t expected_total_get_requests = num_threads * records_per_thread;
+    if (temporality == AggregationTemporality::kCumulative)
+    {
+      expected_total_get_requests *= collection;
+    }
+    size_t count_attributes = 0;
+    storage.Collect(
+        collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+        [&](const MetricData &metric_data) {
+          for (const auto &data_attr : metric_data.point_data_attr_)
+          {
+            const auto &data = opentelemetry::nostd::get<SumPointData>(data_attr.point_data);
+            if (opentelemetry::nostd::get<std::string>(
+                    data_attr.attributes.find("RequestType")->second) == "GET")
+            {
+              EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.value_),
+                        expected_total_get_requests);
+            }
+            else
+            {
+              EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.value_),
+                        2 * expected_total_get_requests);
+            }
+            count_attributes++;
+          }
+          return true;
+        });
+    EXPECT_EQ(count_attributes, 2);  // GET and PUT
+  }
+}
+
+TEST_P(WritableMetricStorageTestFixture, BoundLongCounterSumAggregation)
+{
+  AggregationTemporality temporality = GetParam();
+  auto sdk_start_ts                  = std::chrono::system_clock::now();
+  InstrumentDescriptor instr_desc    = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  std::map<std::string, std::string> attributes_get = {{"RequestType", "GET"}};
+  std::map<std::string, std::string> attributes_put = {{"RequestType", "PUT"}};
+
+  std::unique_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  opentelemetry::sdk::metrics::SyncMetricStorage storage(
+      instr_desc, AggregationType::kSum, default_attributes_processor.get(),
+      ExemplarReservoir::GetNoExemplarReservoir(), nullptr);
+
+  auto bound_get =
+      storage.Bind(KeyValueIterableView<std::map<std::string, std::string>>(attributes_get));
+  auto bound_put =
+      storage.Bind(KeyValueIterableView<std::map<std::string, std::string>>(attributes_put));
+
+  std::shared_ptr<CollectorHandle> collector(new MockCollectorHandle(temporality));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.push_back(collector);
+
+  int64_t expected_total_get_requests = 0;
+  int64_t expected_total_put_requests = 0;
+  for (int collection = 0; collection < 3; collection++)
+  {
+    if (temporality == AggregationTemporality::kDelta)
+    {
+      expected_total_get_requests = 0;
+      expected_total_put_requests = 0;
+    }
+    bound_get->RecordLong(10);
+    // measurements recorded through the bound and the unbound storage end up in the same series
+    storage.RecordLong(20, KeyValueIterableView<std::map<std::string, std::string>>(attributes_get),
+                       opentelemetry::context::Context{});
+    expected_total_get_requests += 30;
+    bound_put->RecordLong(40);
+    expected_total_put_requests += 40;
+
+    size_t count_attributes = 0;
+    storage.Collect(
+        collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+        [&](const MetricData &metric_data) {
+          for (const auto &data_attr : metric_data.point_data_attr_)
+          {
+            const auto &data = opentelemetry::nostd::get<SumPointData>(data_attr.point_data);
+            if (opentelemetry::nostd::get<std::string>(
+                    data_attr.attributes.find("RequestType")->second) == "GET")
+            {
+              EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.value_),
+                        expected_total_get_requests);
+            }
+            else
+            {
+              EXPECT_EQ(opentelemetry::nostd::get<int64_t>(data.value_),
+                        expected_total_put_requests);
+            }
+            count_attributes++;
+          }
+          return true;
+        });
+    EXPECT_EQ(count_attributes, 2);  // GET and PUT
+  }
+
+  // measurements recorded right before the bound storage is released are still collected.
+  bound_put->RecordLong(40);
+  bound_put.reset();
+  size_t count_attributes = 0;
+  storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                  [&](const MetricData &metric_data) {
+                    count_attributes = metric_data.point_data_attr_.size();
+                    return true;
+                  });
+  EXPECT_EQ(count_attributes, temporality == AggregationTemporality::kDelta ? 1 : 2);
+}
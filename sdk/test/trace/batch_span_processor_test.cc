@@ -313,6 +313,94 @@ TEST_F(BatchSpanProcessorTestPeer, TestManySpansLossLess)
   }
 }
 
+TEST_F(BatchSpanProcessorTestPeer, TestShardedQueue)
+{
+  /* Test that no spans are lost when threads end spans into a sharded queue */
+
+  std::shared_ptr<std::atomic<std::size_t>> shut_down_counter(new std::atomic<std::size_t>(0));
+  std::shared_ptr<std::atomic<bool>> is_shutdown(new std::atomic<bool>(false));
+  std::shared_ptr<std::vector<std::unique_ptr<sdk::trace::SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<sdk::trace::SpanData>>);
+
+  const int num_threads         = 4;
+  const int num_spans_by_thread = 256;
+  sdk::trace::BatchSpanProcessorOptions options{};
+  options.queue_shard_count = num_threads;
+
+  auto batch_processor =
+      std::shared_ptr<sdk::trace::BatchSpanProcessor>(new sdk::trace::BatchSpanProcessor(
+          std::unique_ptr<sdk::trace::SpanExporter>(
+              new MockSpanExporter(spans_received, shut_down_counter, is_shutdown)),
+          options));
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([this, &batch_processor, num_spans_by_thread]() {
+      auto test_spans = GetTestSpans(batch_processor, num_spans_by_thread);
+      for (int i = 0; i < num_spans_by_thread; ++i)
+      {
+        batch_processor->OnEnd(std::move(test_spans->at(i)));
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_TRUE(batch_processor->ForceFlush());
+
+  EXPECT_EQ(num_threads * num_spans_by_thread, spans_received->size());
+  for (int i = 0; i < num_spans_by_thread; ++i)
+  {
+    EXPECT_EQ(num_threads, std::count_if(spans_received->begin(), spans_received->end(),
+                                         [i](const std::unique_ptr<sdk::trace::SpanData> &span) {
+                                           return span->GetName() == "Span " + std::to_string(i);
+                                         }));
+  }
+}
+
+TEST_F(BatchSpanProcessorTestPeer, TestShardedQueueNotification)
+{
+  /* Test that the worker thread is woken up by each shard reaching its notification threshold,
+     long before schedule_delay_millis */
+
+  std::shared_ptr<std::atomic<std::size_t>> shut_down_counter(new std::atomic<std::size_t>(0));
+  std::shared_ptr<std::atomic<bool>> is_shutdown(new std::atomic<bool>(false));
+  std::shared_ptr<std::atomic<bool>> is_export_completed(new std::atomic<bool>(false));
+  std::shared_ptr<std::vector<std::unique_ptr<sdk::trace::SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<sdk::trace::SpanData>>);
+  const std::chrono::milliseconds export_delay(0);
+  const size_t num_rounds = 20;
+  sdk::trace::BatchSpanProcessorOptions options{};
+  options.schedule_delay_millis = std::chrono::milliseconds(60000);
+  options.queue_shard_count     = 2;
+  // a notification is sent for each span
+  options.max_export_batch_size = 2;
+
+  auto batch_processor =
+      std::shared_ptr<sdk::trace::BatchSpanProcessor>(new sdk::trace::BatchSpanProcessor(
+          std::unique_ptr<sdk::trace::SpanExporter>(new MockSpanExporter(
+              spans_received, shut_down_counter, is_shutdown, is_export_completed, export_delay)),
+          options));
+
+  auto test_spans = GetTestSpans(batch_processor, num_rounds);
+  for (size_t i = 0; i < num_rounds; ++i)
+  {
+    is_export_completed->store(false);
+    batch_processor->OnEnd(std::move(test_spans->at(i)));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!is_export_completed->load() && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(is_export_completed->load());
+  }
+  EXPECT_EQ(num_rounds, spans_received->size());
+}
+
 TEST_F(BatchSpanProcessorTestPeer, TestScheduleDelayMillis)
 {
   /* Test that max_export_batch_size spans are exported every schedule_delay_millis
@@ -0,0 +1,85 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+#include "opentelemetry/sdk/trace/samplers/always_on.h"
+#include "opentelemetry/sdk/trace/simple_processor.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/span_data_pool.h"
+#include "opentelemetry/sdk/trace/tracer.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentelemetry::sdk::trace;
+
+namespace
+{
+// An exporter dropping the exported spans, which makes its recordables from a pool if enabled.
+class DiscardSpanExporter final : public SpanExporter
+{
+public:
+  explicit DiscardSpanExporter(bool use_pool) : use_pool_(use_pool) {}
+
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    if (use_pool_)
+    {
+      return pool_.MakeRecordable();
+    }
+    return std::unique_ptr<Recordable>(new SpanData);
+  }
+
+  opentelemetry::sdk::common::ExportResult Export(
+      const opentelemetry::nostd::span<std::unique_ptr<Recordable>> &spans) noexcept override
+  {
+    if (use_pool_)
+    {
+      pool_.Recycle(spans);
+    }
+    return opentelemetry::sdk::common::ExportResult::kSuccess;
+  }
+
+  bool ForceFlush(std::chrono::microseconds) noexcept override { return true; }
+
+  bool Shutdown(std::chrono::microseconds) noexcept override { return true; }
+
+private:
+  bool use_pool_;
+  SpanDataPool pool_;
+};
+
+void BenchmarkSpanStartEnd(bool use_pool, benchmark::State &state)
+{
+  std::unique_ptr<SpanExporter> exporter(new DiscardSpanExporter(use_pool));
+  std::unique_ptr<SpanProcessor> processor(new SimpleSpanProcessor(std::move(exporter)));
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::move(processor));
+  auto resource = opentelemetry::sdk::resource::Resource::Create({});
+  auto context  = std::make_shared<TracerContext>(std::move(processors), resource,
+                                                 std::unique_ptr<Sampler>(new AlwaysOnSampler));
+  auto tracer   = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+
+  for (auto _ : state)
+  {
+    auto span = tracer->StartSpan("span name long enough to be allocated");
+    span->SetAttribute("attribute.key", "attribute value long enough to be allocated");
+    span->AddEvent("event");
+    span->End();
+  }
+}
+
+void BM_SpanStartEnd(benchmark::State &state)
+{
+  BenchmarkSpanStartEnd(false, state);
+}
+BENCHMARK(BM_SpanStartEnd);
+
+void BM_SpanStartEndWithPool(benchmark::State &state)
+{
+  BenchmarkSpanStartEnd(true, state);
+}
+BENCHMARK(BM_SpanStartEndWithPool);
+
+}  // namespace
+BENCHMARK_MAIN();
@@ -3,13 +3,16 @@
 
 #include "opentelemetry/sdk/trace/span_data.h"
 #include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/trace/span_data_pool.h"
 #include "opentelemetry/trace/span.h"
 #include "opentelemetry/trace/span_id.h"
 #include "opentelemetry/trace/trace_id.h"
 
 #include <gtest/gtest.h>
 
+using opentelemetry::sdk::trace::Recordable;
 using opentelemetry::sdk::trace::SpanData;
+using opentelemetry::sdk::trace::SpanDataPool;
 namespace trace_api = opentelemetry::trace;
 namespace common    = opentelemetry::common;
 namespace nostd     = opentelemetry::nostd;
@@ -133,3 +136,81 @@ TEST(SpanData, Links)
     EXPECT_EQ(nostd::get<int64_t>(data.GetLinks().at(0).GetAttributes().at(keys[i])), values[i]);
   }
 }
+
+TEST(SpanData, Reset)
+{
+  SpanData data;
+  data.SetName("span name");
+  data.SetStatus(trace_api::StatusCode::kOk, "description");
+  data.SetAttribute("attr1", (int64_t)314159);
+  data.AddEvent("event1", common::SystemTimestamp(std::chrono::system_clock::now()));
+  data.SetDuration(std::chrono::nanoseconds(1000));
+
+  data.Reset();
+  ASSERT_EQ(data.GetName(), "");
+  ASSERT_EQ(data.GetStatus(), trace_api::StatusCode::kUnset);
+  ASSERT_EQ(data.GetDescription(), "");
+  ASSERT_EQ(data.GetDuration(), std::chrono::nanoseconds(0));
+  ASSERT_EQ(data.GetAttributes().size(), 0);
+  ASSERT_EQ(data.GetEvents().size(), 0);
+}
+
+TEST(SpanData, ReuseAfterReset)
+{
+  SpanData data;
+  std::map<std::string, int64_t> attributes = {{"attr1", 1}, {"attr2", 2}};
+  data.SetAttribute("span attribute with a long key", (int64_t)1);
+  data.AddEvent("event1", common::SystemTimestamp(std::chrono::system_clock::now()),
+                common::KeyValueIterableView<std::map<std::string, int64_t>>(attributes));
+  data.AddLink(trace_api::SpanContext(false, false),
+               common::KeyValueIterableView<std::map<std::string, int64_t>>(attributes));
+  data.Reset();
+
+  // The storage kept by Reset() is reused with the new values.
+  std::map<std::string, int64_t> new_attributes = {{"attr2", 3}, {"attr3", 4}};
+  data.SetAttribute("attr1", (int64_t)5);
+  data.SetAttribute("attr1", (int64_t)6);
+  data.AddEvent("event2", common::SystemTimestamp(std::chrono::system_clock::now()),
+                common::KeyValueIterableView<std::map<std::string, int64_t>>(new_attributes));
+  data.AddEvent("event3", common::SystemTimestamp(std::chrono::system_clock::now()));
+  data.AddLink(trace_api::SpanContext(false, false),
+               common::KeyValueIterableView<std::map<std::string, int64_t>>(new_attributes));
+
+  ASSERT_EQ(data.GetAttributes().size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(data.GetAttributes().at("attr1")), 6);
+  ASSERT_EQ(data.GetEvents().size(), 2);
+  EXPECT_EQ(data.GetEvents().at(0).GetName(), "event2");
+  ASSERT_EQ(data.GetEvents().at(0).GetAttributes().size(), 2);
+  EXPECT_EQ(nostd::get<int64_t>(data.GetEvents().at(0).GetAttributes().at("attr2")), 3);
+  EXPECT_EQ(nostd::get<int64_t>(data.GetEvents().at(0).GetAttributes().at("attr3")), 4);
+  EXPECT_EQ(data.GetEvents().at(1).GetName(), "event3");
+  EXPECT_EQ(data.GetEvents().at(1).GetAttributes().size(), 0);
+  ASSERT_EQ(data.GetLinks().size(), 1);
+  ASSERT_EQ(data.GetLinks().at(0).GetAttributes().size(), 2);
+  EXPECT_EQ(nostd::get<int64_t>(data.GetLinks().at(0).GetAttributes().at("attr3")), 4);
+}
+
+TEST(SpanDataPool, Recycle)
+{
+  SpanDataPool pool(2);
+  ASSERT_EQ(pool.GetSize(), 0);
+
+  std::unique_ptr<Recordable> recordables[3];
+  for (auto &recordable : recordables)
+  {
+    recordable = pool.MakeRecordable();
+    recordable->SetName("span");
+  }
+  const Recordable *first_recordable  = recordables[0].get();
+  const Recordable *second_recordable = recordables[1].get();
+
+  // Only two of the recordables are kept.
+  pool.Recycle(recordables);
+  ASSERT_EQ(pool.GetSize(), 2);
+  ASSERT_EQ(recordables[0], nullptr);
+
+  auto recordable = pool.MakeRecordable();
+  ASSERT_EQ(pool.GetSize(), 1);
+  ASSERT_TRUE(recordable.get() == first_recordable || recordable.get() == second_recordable);
+  ASSERT_EQ(static_cast<SpanData *>(recordable.get())->GetName(), "");
+}
@@ -0,0 +1,127 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/samplers/always_off.h"
+#include "opentelemetry/sdk/trace/samplers/always_on.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/tracer.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentelemetry::sdk::trace;
+namespace trace_api = opentelemetry::trace;
+
+namespace
+{
+// A processor dropping the ended spans, to measure the cost of the tracer alone.
+class DiscardSpanProcessor final : public SpanProcessor
+{
+public:
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<Recordable>(new SpanData);
+  }
+
+  void OnStart(Recordable & /* span */,
+               const trace_api::SpanContext & /* parent_context */) noexcept override
+  {}
+
+  void OnEnd(std::unique_ptr<Recordable> && /* span */) noexcept override {}
+
+  bool ForceFlush(std::chrono::microseconds /* timeout */) noexcept override { return true; }
+
+  bool Shutdown(std::chrono::microseconds /* timeout */) noexcept override { return true; }
+};
+
+std::shared_ptr<trace_api::Tracer> MakeTracer(std::unique_ptr<Sampler> &&sampler,
+                                              bool span_spin_lock = false)
+{
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::unique_ptr<SpanProcessor>(new DiscardSpanProcessor));
+  auto resource = opentelemetry::sdk::resource::Resource::Create({});
+  auto context = std::make_shared<TracerContext>(
+      std::move(processors), resource, std::move(sampler),
+      std::unique_ptr<IdGenerator>(new RandomIdGenerator), span_spin_lock);
+  return std::shared_ptr<trace_api::Tracer>(new Tracer(context));
+}
+
+// Test to measure performance for starting and ending a root span
+void BM_TracerStartRootSpan(benchmark::State &state)
+{
+  auto tracer = MakeTracer(std::unique_ptr<Sampler>(new AlwaysOnSampler));
+  for (auto _ : state)
+  {
+    auto span = tracer->StartSpan("span");
+    span->End();
+  }
+}
+BENCHMARK(BM_TracerStartRootSpan);
+
+// Test to measure performance for starting and ending a child of the active span
+void BM_TracerStartChildSpan(benchmark::State &state)
+{
+  auto tracer = MakeTracer(std::unique_ptr<Sampler>(new AlwaysOnSampler));
+  auto parent = tracer->StartSpan("parent");
+  auto scope  = tracer->WithActiveSpan(parent);
+  for (auto _ : state)
+  {
+    auto span = tracer->StartSpan("span");
+    span->End();
+  }
+  parent->End();
+}
+BENCHMARK(BM_TracerStartChildSpan);
+
+// Test to measure performance for starting and ending a span with an explicit parent
+void BM_TracerStartSpanWithParent(benchmark::State &state)
+{
+  auto tracer = MakeTracer(std::unique_ptr<Sampler>(new AlwaysOnSampler));
+  auto parent = tracer->StartSpan("parent");
+  trace_api::StartSpanOptions options;
+  options.parent = parent->GetContext();
+  for (auto _ : state)
+  {
+    auto span = tracer->StartSpan("span", options);
+    span->End();
+  }
+  parent->End();
+}
+BENCHMARK(BM_TracerStartSpanWithParent);
+
+// Test to measure performance for starting and ending a span dropped by the sampler
+void BM_TracerStartDroppedSpan(benchmark::State &state)
+{
+  auto tracer = MakeTracer(std::unique_ptr<Sampler>(new AlwaysOffSampler));
+  for (auto _ : state)
+  {
+    auto span = tracer->StartSpan("span");
+    span->End();
+  }
+}
+BENCHMARK(BM_TracerStartDroppedSpan);
+
+// Test to measure performance for a span setting 20 attributes, guarded by a std::mutex (0) or a
+// spin lock (1)
+void BM_TracerAttributeHeavySpan(benchmark::State &state)
+{
+  auto tracer = MakeTracer(std::unique_ptr<Sampler>(new AlwaysOnSampler), state.range(0) != 0);
+  const char *keys[] = {"attr.0",  "attr.1",  "attr.2",  "attr.3",  "attr.4",
+                        "attr.5",  "attr.6",  "attr.7",  "attr.8",  "attr.9",
+                        "attr.10", "attr.11", "attr.12", "attr.13", "attr.14",
+                        "attr.15", "attr.16", "attr.17", "attr.18", "attr.19"};
+  for (auto _ : state)
+  {
+    auto span = tracer->StartSpan("span");
+    for (auto key : keys)
+    {
+      span->SetAttribute(key, 42);
+    }
+    span->End();
+  }
+}
+BENCHMARK(BM_TracerAttributeHeavySpan)->Arg(0)->Arg(1);
+
+}  // namespace
+BENCHMARK_MAIN();
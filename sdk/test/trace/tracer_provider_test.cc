@@ -7,6 +7,7 @@
 #include "opentelemetry/sdk/trace/samplers/always_on.h"
 #include "opentelemetry/sdk/trace/simple_processor.h"
 #include "opentelemetry/sdk/trace/tracer.h"
+#include "opentelemetry/sdk/trace/tracer_provider_factory.h"
 
 #include <gtest/gtest.h>
 
@@ -238,3 +239,27 @@ TEST(TracerProvider, ForceFlush)
 
   EXPECT_TRUE(tp1.ForceFlush());
 }
+
+TEST(TracerProvider, SpanSpinLock)
+{
+  std::unique_ptr<SpanProcessor> processor1(new SimpleSpanProcessor(nullptr));
+  TracerProvider tp1(std::move(processor1));
+#ifdef OPENTELEMETRY_RTTI_ENABLED
+  auto sdkTracer1 = dynamic_cast<Tracer *>(tp1.GetTracer("test").get());
+#else
+  auto sdkTracer1 = static_cast<Tracer *>(tp1.GetTracer("test").get());
+#endif
+  EXPECT_FALSE(sdkTracer1->GetSpanSpinLock());
+
+  std::unique_ptr<SpanProcessor> processor2(new SimpleSpanProcessor(nullptr));
+  auto tp2 = TracerProviderFactory::Create(
+      std::move(processor2), Resource::Create({}), std::unique_ptr<Sampler>(new AlwaysOnSampler),
+      std::unique_ptr<IdGenerator>(new RandomIdGenerator), true);
+  auto t2 = tp2->GetTracer("test");
+#ifdef OPENTELEMETRY_RTTI_ENABLED
+  auto sdkTracer2 = dynamic_cast<Tracer *>(t2.get());
+#else
+  auto sdkTracer2 = static_cast<Tracer *>(t2.get());
+#endif
+  EXPECT_TRUE(sdkTracer2->GetSpanSpinLock());
+}
@@ -4,6 +4,9 @@
 #include "opentelemetry/sdk/trace/tracer.h"
 #include "opentelemetry/exporters/memory/in_memory_span_exporter.h"
 #include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/sdk/trace/batch_span_processor.h"
+#include "opentelemetry/sdk/trace/batch_span_processor_options.h"
+#include "opentelemetry/sdk/trace/multi_span_processor.h"
 #include "opentelemetry/sdk/trace/samplers/always_off.h"
 #include "opentelemetry/sdk/trace/samplers/always_on.h"
 #include "opentelemetry/sdk/trace/samplers/parent.h"
@@ -13,6 +16,10 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace opentelemetry::sdk::trace;
 using namespace opentelemetry::sdk::resource;
 using opentelemetry::common::SteadyTimestamp;
@@ -1141,3 +1148,105 @@ TEST(Tracer, SpanCleanupWithScope)
   }
   EXPECT_EQ(4, span_data->GetSpans().size());
 }
+
+TEST(Tracer, SpanSpinLock)
+{
+  InMemorySpanExporter *exporter              = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> span_data = exporter->GetData();
+
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::unique_ptr<SpanProcessor>(
+      new SimpleSpanProcessor(std::unique_ptr<SpanExporter>{exporter})));
+  auto context = std::make_shared<TracerContext>(
+      std::move(processors), opentelemetry::sdk::resource::Resource::Create({}),
+      std::unique_ptr<Sampler>(new AlwaysOnSampler),
+      std::unique_ptr<IdGenerator>(new RandomIdGenerator), true);
+  EXPECT_TRUE(context->GetSpanSpinLock());
+  auto tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+
+  auto span = tracer->StartSpan("span 1");
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([&span, i] {
+      for (int j = 0; j < 100; ++j)
+      {
+        span->SetAttribute("attr." + std::to_string(i) + "." + std::to_string(j), j);
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_TRUE(span->IsRecording());
+  span->End();
+  EXPECT_FALSE(span->IsRecording());
+
+  auto spans = span_data->GetSpans();
+  ASSERT_EQ(1, spans.size());
+  EXPECT_EQ("span 1", spans.at(0)->GetName());
+  EXPECT_EQ(400, spans.at(0)->GetAttributes().size());
+}
+
+TEST(Tracer, SharedSpanData)
+{
+  InMemorySpanExporter *simple_exporter              = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> simple_span_data = simple_exporter->GetData();
+  InMemorySpanExporter *batch_exporter               = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> batch_span_data  = batch_exporter->GetData();
+
+  std::vector<std::unique_ptr<SpanProcessor>> shared_processors;
+  shared_processors.push_back(std::unique_ptr<SpanProcessor>(
+      new SimpleSpanProcessor(std::unique_ptr<SpanExporter>{simple_exporter})));
+  shared_processors.push_back(std::unique_ptr<SpanProcessor>(new BatchSpanProcessor(
+      std::unique_ptr<SpanExporter>{batch_exporter}, BatchSpanProcessorOptions())));
+  MultiSpanProcessorOptions options;
+  options.share_span_data = true;
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::unique_ptr<SpanProcessor>(
+      new MultiSpanProcessor(std::move(shared_processors), options)));
+  auto context = std::make_shared<TracerContext>(std::move(processors));
+  auto tracer  = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+
+  bool bools[]                 = {true, false};
+  nostd::string_view strings[] = {"a", "b"};
+  auto span = tracer->StartSpan("span 1", {{"attr1", 1}},
+                                {{SpanContext(false, false), {{"link_attr", "value"}}}});
+  span->SetAttribute("bools", nostd::span<const bool>(bools));
+  span->SetAttribute("strings", nostd::span<const nostd::string_view>(strings));
+  span->AddEvent("event 1", {{"event_attr", 3.5}});
+  span->SetStatus(trace_api::StatusCode::kError, "description");
+  span->End();
+  context->ForceFlush();
+
+  auto simple_spans = simple_span_data->GetSpans();
+  auto batch_spans  = batch_span_data->GetSpans();
+  ASSERT_EQ(1, simple_spans.size());
+  ASSERT_EQ(1, batch_spans.size());
+  for (auto *span_data : {simple_spans.at(0).get(), batch_spans.at(0).get()})
+  {
+    EXPECT_EQ("span 1", span_data->GetName());
+    EXPECT_EQ(span->GetContext().span_id(), span_data->GetSpanId());
+    EXPECT_EQ(trace_api::StatusCode::kError, span_data->GetStatus());
+    EXPECT_EQ("description", span_data->GetDescription());
+    EXPECT_NE(std::chrono::nanoseconds{0}, span_data->GetDuration());
+
+    auto &attributes = span_data->GetAttributes();
+    ASSERT_EQ(3, attributes.size());
+    EXPECT_EQ(1, nostd::get<int32_t>(attributes.at("attr1")));
+    EXPECT_EQ(std::vector<bool>({true, false}),
+              nostd::get<std::vector<bool>>(attributes.at("bools")));
+    EXPECT_EQ(std::vector<std::string>({"a", "b"}),
+              nostd::get<std::vector<std::string>>(attributes.at("strings")));
+
+    ASSERT_EQ(1, span_data->GetEvents().size());
+    EXPECT_EQ("event 1", span_data->GetEvents().at(0).GetName());
+    EXPECT_EQ(3.5,
+              nostd::get<double>(span_data->GetEvents().at(0).GetAttributes().at("event_attr")));
+
+    ASSERT_EQ(1, span_data->GetLinks().size());
+    EXPECT_EQ("value", nostd::get<std::string>(
+                           span_data->GetLinks().at(0).GetAttributes().at("link_attr")));
+  }
+}
@@ -171,6 +171,9 @@ class HttpClient : public opentelemetry::ext::http::client::HttpClient
 
   void SetMaxSessionsPerConnection(std::size_t max_requests_per_connection) noexcept override;
 
+  void SetConnectionOptions(
+      const opentelemetry::ext::http::client::HttpConnectionOptions &options) noexcept override;
+
   void CleanupSession(uint64_t session_id);
 
   std::shared_ptr<Session> session_;
@@ -88,6 +88,10 @@ bool HttpClient::FinishAllSessions() noexcept
 void HttpClient::SetMaxSessionsPerConnection(std::size_t /* max_requests_per_connection */) noexcept
 {}
 
+void HttpClient::SetConnectionOptions(
+    const opentelemetry::ext::http::client::HttpConnectionOptions & /* options */) noexcept
+{}
+
 void HttpClient::CleanupSession(uint64_t /* session_id */) {}
 
 }  // namespace nosend